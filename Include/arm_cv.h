@@ -49,5 +49,15 @@
  */
 #include "cv/feature_detection.h"
 
+/**
+ * @defgroup scratchPlanner Scratch Planner
+ */
+#include "cv/scratch_planner.h"
+
+/**
+ * @defgroup stripProcessing Strip Processing
+ */
+#include "cv/strip.h"
+
 
 #endif 
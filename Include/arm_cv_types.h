@@ -50,6 +50,8 @@ typedef struct _arm_cv_image {
  * @param   width     image width in pixels
  * @param   height    image height in pixels
  * @param   pData     pointer to the array containing the data for the pixels
+ * @param   stride    number of elements of pData between two consecutive rows, 0 when the rows are packed.
+ *                    Must be initialized, see ARM_CV_IMAGE_INIT
  * @return 
  *
  */
@@ -57,6 +59,7 @@ typedef struct _arm_cv_image_gray8 {
   uint16_t width;
   uint16_t height;
   channel_uint8_t* pData;
+  uint32_t stride;
 } arm_cv_image_gray8_t;
 
 /**
@@ -64,6 +67,8 @@ typedef struct _arm_cv_image_gray8 {
  * @param   width     image width in pixels
  * @param   height    image height in pixels
  * @param   pData     pointer to the array containing the data for the pixels
+ * @param   stride    number of elements of pData between two consecutive rows, 0 when the rows are packed.
+ *                    Must be initialized, see ARM_CV_IMAGE_INIT
  * @return 
  *
  */
@@ -71,6 +76,7 @@ typedef struct _arm_cv_image_gray16 {
   uint16_t width;
   uint16_t height;
   channel_uint16_t* pData;
+  uint32_t stride;
 } arm_cv_image_gray16_t;
 
 /**
@@ -78,6 +84,8 @@ typedef struct _arm_cv_image_gray16 {
  * @param   width     image width in pixels
  * @param   height    image height in pixels
  * @param   pData     pointer to the array containing the data for the pixels
+ * @param   stride    number of elements of pData between two consecutive rows, 0 when the rows are packed.
+ *                    Must be initialized, see ARM_CV_IMAGE_INIT
  * @return 
  *
  */
@@ -85,6 +93,7 @@ typedef struct _arm_cv_image_rgb24 {
   uint16_t width;
   uint16_t height;
   channel_uint8_t* pData;
+  uint32_t stride;
 } arm_cv_image_rgb24_t;
 
 /**
@@ -92,6 +101,8 @@ typedef struct _arm_cv_image_rgb24 {
  * @param   width     image width in pixels
  * @param   height    image height in pixels
  * @param   pData     pointer to the array containing the data for the pixels
+ * @param   stride    number of elements of pData between two consecutive rows, 0 when the rows are packed.
+ *                    Must be initialized, see ARM_CV_IMAGE_INIT
  * @return 
  *
  */
@@ -99,19 +110,47 @@ typedef struct _arm_cv_image_rgba {
   uint16_t width;
   uint16_t height;
   channel_uint8_t* pData;
+  uint32_t stride;
 } arm_cv_image_rgba_t;
 
+/**
+ * @brief   Structure for a RGB565 image
+ * @param   width     image width in pixels
+ * @param   height    image height in pixels
+ * @param   pData     pointer to the array containing the data for the pixels
+ * @param   stride    number of elements of pData between two consecutive rows, 0 when the rows are packed.
+ *                    Must be initialized, see ARM_CV_IMAGE_INIT
+ * @return
+ *
+ * @par Pixel format
+ *      A pixel is an uint16_t with red in bits 15 to 11,
+ *      green in bits 10 to 5 and blue in bits 4 to 0
+ *
+ */
+typedef struct _arm_cv_image_rgb565 {
+  uint16_t width;
+  uint16_t height;
+  uint16_t* pData;
+  uint32_t stride;
+} arm_cv_image_rgb565_t;
+
 /**
  * @brief   Structure for a unpacked YUV420 image
  * @param   width     image width in pixels
  * @param   height    image height in pixels
  * @param   pData     pointer to the array containing the data for the pixels
+ * @param   stride    number of elements of pData between two consecutive rows, 0 when the rows are packed.
+ *                    Must be initialized, see ARM_CV_IMAGE_INIT
  * @return 
  * 
  * @par The image is unpacked
  *      There are 3 planes : Y, U and V
  *      width and height are the dimensions of the image and not of the 
  *      tensor (different from OpenCV for instance)
+ * @par Stride
+ *      stride is the stride of the Y plane. The U and V planes have a
+ *      stride of stride / 2. The U plane starts at stride * height
+ *      and the V plane follows it.
  * @par Format details
  *      - YUV = YCbCr
  *      - ITU-R BT.601 full format.
@@ -125,24 +164,123 @@ typedef struct _arm_cv_image_yuv420 {
   uint16_t width;
   uint16_t height;
   channel_uint8_t* pData;
+  uint32_t stride;
 } arm_cv_image_yuv420_t;
 
+/**
+ * @brief   Structure for a semi-planar NV12 image
+ * @param   width     image width in pixels
+ * @param   height    image height in pixels
+ * @param   pData     pointer to the array containing the data for the pixels
+ * @param   stride    number of elements of pData between two consecutive rows, 0 when the rows are packed.
+ *                    Must be initialized, see ARM_CV_IMAGE_INIT
+ * @return
+ *
+ * @par The image is semi-planar
+ *      There are 2 planes : Y and the interleaved U,V.
+ *      The UV plane has height / 2 rows of width / 2 pairs
+ *      U,V. width and height are the dimensions of the image.
+ * @par Stride
+ *      stride is the stride of both planes. The UV plane
+ *      starts at stride * height.
+ * @par Format details
+ *      Same color space as arm_cv_image_yuv420_t
+ *
+ */
+typedef struct _arm_cv_image_nv12 {
+  uint16_t width;
+  uint16_t height;
+  channel_uint8_t* pData;
+  uint32_t stride;
+} arm_cv_image_nv12_t;
+
+/**
+ * @brief   Structure for a semi-planar NV21 image
+ * @param   width     image width in pixels
+ * @param   height    image height in pixels
+ * @param   pData     pointer to the array containing the data for the pixels
+ * @param   stride    number of elements of pData between two consecutive rows, 0 when the rows are packed.
+ *                    Must be initialized, see ARM_CV_IMAGE_INIT
+ * @return
+ *
+ * @par The image is semi-planar
+ *      Same as arm_cv_image_nv12_t with the pairs V,U in
+ *      the second plane.
+ *
+ */
+typedef struct _arm_cv_image_nv21 {
+  uint16_t width;
+  uint16_t height;
+  channel_uint8_t* pData;
+  uint32_t stride;
+} arm_cv_image_nv21_t;
+
+/**
+ * @brief   Structure for a packed YUYV (YUV422) image
+ * @param   width     image width in pixels
+ * @param   height    image height in pixels
+ * @param   pData     pointer to the array containing the data for the pixels
+ * @param   stride    number of elements of pData between two consecutive rows, 0 when the rows are packed.
+ *                    Must be initialized, see ARM_CV_IMAGE_INIT
+ * @return
+ *
+ * @par The image is packed
+ *      Two consecutive pixels of a row are stored as Y0,U,Y1,V
+ *      so a row is width * 2 elements long. width is even.
+ * @par Format details
+ *      Same color space as arm_cv_image_yuv420_t
+ *
+ */
+typedef struct _arm_cv_image_yuyv {
+  uint16_t width;
+  uint16_t height;
+  channel_uint8_t* pData;
+  uint32_t stride;
+} arm_cv_image_yuyv_t;
+
+/**
+ * @brief   Structure for a packed UYVY (YUV422) image
+ * @param   width     image width in pixels
+ * @param   height    image height in pixels
+ * @param   pData     pointer to the array containing the data for the pixels
+ * @param   stride    number of elements of pData between two consecutive rows, 0 when the rows are packed.
+ *                    Must be initialized, see ARM_CV_IMAGE_INIT
+ * @return
+ *
+ * @par The image is packed
+ *      Same as arm_cv_image_yuyv_t with two consecutive pixels
+ *      stored as U,Y0,V,Y1
+ *
+ */
+typedef struct _arm_cv_image_uyvy {
+  uint16_t width;
+  uint16_t height;
+  channel_uint8_t* pData;
+  uint32_t stride;
+} arm_cv_image_uyvy_t;
+
 /**
  * @brief   Structure for a unpacked BGR image
  * @param   width     image width in pixels
  * @param   height    image height in pixels
  * @param   pData     pointer to the array containing the data for the pixels
+ * @param   stride    number of elements of pData between two consecutive rows, 0 when the rows are packed.
+ *                    Must be initialized, see ARM_CV_IMAGE_INIT
  * @return 
  * 
  * @par The image is unpacked
  *      There are 3 planes : B,G,R
  *      width and height are the dimensions of the image and not of the 
+ * @par Stride
+ *      The 3 planes have the same stride and each plane is
+ *      stride * height elements long.
  *
  */
 typedef struct _arm_cv_image_bgr_8U3C {
   uint16_t width;
   uint16_t height;
   channel_uint8_t* pData;
+  uint32_t stride;
 } arm_cv_image_bgr_8U3C_t;
 
 /**
@@ -150,6 +288,8 @@ typedef struct _arm_cv_image_bgr_8U3C {
  * @param   width     image width in pixels
  * @param   height    image height in pixels
  * @param   pData     pointer to the array containing the data for the pixels
+ * @param   stride    number of elements of pData between two consecutive rows, 0 when the rows are packed.
+ *                    Must be initialized, see ARM_CV_IMAGE_INIT
  * @return 
  *
  */
@@ -157,8 +297,43 @@ typedef struct _arm_cv_image_q15 {
   uint16_t width;
   uint16_t height;
   q15_t* pData;
+  uint32_t stride;
 } arm_cv_image_q15_t;
 
+/**
+ * @brief   Structure for an uint32 image
+ * @param   width     image width in pixels
+ * @param   height    image height in pixels
+ * @param   pData     pointer to the array containing the data for the pixels
+ * @param   stride    number of elements of pData between two consecutive rows, 0 when the rows are packed.
+ *                    Must be initialized, see ARM_CV_IMAGE_INIT
+ * @return 
+ *
+ */
+typedef struct _arm_cv_image_u32 {
+  uint16_t width;
+  uint16_t height;
+  uint32_t* pData;
+  uint32_t stride;
+} arm_cv_image_u32_t;
+
+/**
+ * @brief   Structure for an uint64 image
+ * @param   width     image width in pixels
+ * @param   height    image height in pixels
+ * @param   pData     pointer to the array containing the data for the pixels
+ * @param   stride    number of elements of pData between two consecutive rows, 0 when the rows are packed.
+ *                    Must be initialized, see ARM_CV_IMAGE_INIT
+ * @return 
+ *
+ */
+typedef struct _arm_cv_image_u64 {
+  uint16_t width;
+  uint16_t height;
+  uint64_t* pData;
+  uint32_t stride;
+} arm_cv_image_u64_t;
+
 /**
  * @brief   Gradient in q15
  * @param   x     first component of the gradient
@@ -175,6 +350,8 @@ typedef struct _arm_cv_gradient_q15 {
  * @param   width     image width in pixels
  * @param   height    image height in pixels
  * @param   pData     pointeur to the array containing the data for the gradient
+ * @param   stride    number of elements of pData between two consecutive rows, 0 when the rows are packed.
+ *                    Must be initialized, see ARM_CV_IMAGE_INIT
  * @return 
  *
  */
@@ -182,8 +359,67 @@ typedef struct _arm_cv_image_grad_q15 {
   uint16_t width;
   uint16_t height;
   arm_cv_gradient_q15_t* pData;
+  uint32_t stride;
 } arm_cv_image_gradient_q15_t;
 
+/**
+ * @brief   Position of a horizontal strip in a frame
+ * @param   frameHeight   height of the full frame in pixels
+ * @param   firstRow      index in the frame of the first row of the strip
+ * @return
+ *
+ * @par Strip processing
+ *      The output image of a strip function contains the rows
+ *      firstRow to firstRow + height - 1 of the output frame.
+ *      The input image contains the same rows of the input frame
+ *      and the rows around the strip needed by the kernel, see
+ *      arm_cv_get_strip_first_input_row
+ */
+typedef struct _arm_cv_strip {
+  uint16_t frameHeight;
+  uint16_t firstRow;
+} arm_cv_strip_t;
+
+/**
+ * @brief   Initializer of an image with packed rows
+ * @param   w      image width in pixels
+ * @param   h      image height in pixels
+ * @param   data   pointer to the array containing the data for the pixels
+ * @return  initializer for any image type with pData, the stride is 0
+ *
+ * @par The stride must be initialized
+ *      The stride field was added to the existing image types. It is
+ *      an API and ABI break: the structs are bigger and code built
+ *      with the previous headers must be rebuilt. An image filled
+ *      field by field, or allocated without zero-initialization, has
+ *      an undefined stride and the kernels then read and write
+ *      outside of the buffers. Declare the images with this
+ *      initializer, or zero-initialize them, before setting the fields.
+ * @par Example
+ *      arm_cv_image_gray8_t img = ARM_CV_IMAGE_INIT(width, height, pData);
+ */
+#define ARM_CV_IMAGE_INIT(w, h, data) {(uint16_t)(w), (uint16_t)(h), (data), 0}
+
+/**
+ * @brief   Stride of an image
+ * @param   image        pointer to the image
+ * @param   nbChannels   number of elements of pData per pixel
+ * @return  number of elements of pData between two consecutive rows
+ *
+ */
+#define ARM_CV_IMAGE_STRIDE(image, nbChannels)                                   \
+  ((image)->stride ? (image)->stride : (uint32_t)(image)->width * (nbChannels))
+
+/**
+ * @brief   Check if the rows of an image are packed
+ * @param   image        pointer to the image
+ * @param   nbChannels   number of elements of pData per pixel
+ * @return  1 if there is no padding at the end of the rows
+ *
+ */
+#define ARM_CV_IMAGE_IS_PACKED(image, nbChannels)                                \
+  (ARM_CV_IMAGE_STRIDE(image, nbChannels) == (uint32_t)(image)->width * (nbChannels))
+
 
 
 #ifdef   __cplusplus
@@ -57,6 +57,91 @@ extern void arm_yuv420_to_gray8(const arm_cv_image_yuv420_t* ImageIn,
 extern void arm_yuv420_to_rgb24(const arm_cv_image_yuv420_t* ImageIn,
                                       arm_cv_image_rgb24_t* ImageOut);
 
+/**     
+ * @brief      YUV420 to packed RGB24 on a strip of the image
+ *
+ * @param[in]  ImageIn   The full input image
+ * @param      ImageOut  The rows of the strip in the output image
+ * @param[in]  strip     The position of the strip in the image
+ *             The first row and the number of rows of the strip are even
+ */
+extern void arm_yuv420_to_rgb24_strip(const arm_cv_image_yuv420_t* ImageIn,
+                                      arm_cv_image_rgb24_t* ImageOut,
+                                      const arm_cv_strip_t* strip);
+
+
+/**     
+ * @brief      NV12 to Grayscale
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ */
+extern void arm_nv12_to_gray8(const arm_cv_image_nv12_t* ImageIn,
+                                    arm_cv_image_gray8_t* ImageOut);
+
+/**     
+ * @brief      NV21 to Grayscale
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ */
+extern void arm_nv21_to_gray8(const arm_cv_image_nv21_t* ImageIn,
+                                    arm_cv_image_gray8_t* ImageOut);
+
+/**     
+ * @brief      NV12 to packed RGB24
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ */
+extern void arm_nv12_to_rgb24(const arm_cv_image_nv12_t* ImageIn,
+                                    arm_cv_image_rgb24_t* ImageOut);
+
+/**     
+ * @brief      NV21 to packed RGB24
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ */
+extern void arm_nv21_to_rgb24(const arm_cv_image_nv21_t* ImageIn,
+                                    arm_cv_image_rgb24_t* ImageOut);
+
+/**     
+ * @brief      YUYV to Grayscale
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ */
+extern void arm_yuyv_to_gray8(const arm_cv_image_yuyv_t* ImageIn,
+                                    arm_cv_image_gray8_t* ImageOut);
+
+/**     
+ * @brief      UYVY to Grayscale
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ */
+extern void arm_uyvy_to_gray8(const arm_cv_image_uyvy_t* ImageIn,
+                                    arm_cv_image_gray8_t* ImageOut);
+
+/**     
+ * @brief      YUYV to packed RGB24
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ */
+extern void arm_yuyv_to_rgb24(const arm_cv_image_yuyv_t* ImageIn,
+                                    arm_cv_image_rgb24_t* ImageOut);
+
+/**     
+ * @brief      UYVY to packed RGB24
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ */
+extern void arm_uyvy_to_rgb24(const arm_cv_image_uyvy_t* ImageIn,
+                                    arm_cv_image_rgb24_t* ImageOut);
+
 
 /**     
  * @brief      Unpacked BGR 8U3C to Grayscale
@@ -67,6 +152,17 @@ extern void arm_yuv420_to_rgb24(const arm_cv_image_yuv420_t* ImageIn,
 extern void arm_bgr_8U3C_to_gray8(const arm_cv_image_bgr_8U3C_t* ImageIn,
                                         arm_cv_image_gray8_t* ImageOut);
 
+/**     
+ * @brief      Unpacked BGR 8U3C to Grayscale on a strip of the image
+ *
+ * @param[in]  ImageIn   The full input image
+ * @param      ImageOut  The rows of the strip in the output image
+ * @param[in]  strip     The position of the strip in the image
+ */
+extern void arm_bgr_8U3C_to_gray8_strip(const arm_cv_image_bgr_8U3C_t* ImageIn,
+                                        arm_cv_image_gray8_t* ImageOut,
+                                        const arm_cv_strip_t* strip);
+
 
 /**     
  * @brief      Unpacked BGR 8U3C to RGB24
@@ -77,6 +173,17 @@ extern void arm_bgr_8U3C_to_gray8(const arm_cv_image_bgr_8U3C_t* ImageIn,
 extern void arm_bgr_8U3C_to_rgb24(const arm_cv_image_bgr_8U3C_t* ImageIn,
                                         arm_cv_image_rgb24_t* ImageOut);
 
+/**     
+ * @brief      Unpacked BGR 8U3C to RGB24 on a strip of the image
+ *
+ * @param[in]  ImageIn   The full input image
+ * @param      ImageOut  The rows of the strip in the output image
+ * @param[in]  strip     The position of the strip in the image
+ */
+extern void arm_bgr_8U3C_to_rgb24_strip(const arm_cv_image_bgr_8U3C_t* ImageIn,
+                                        arm_cv_image_rgb24_t* ImageOut,
+                                        const arm_cv_strip_t* strip);
+
 /**     
  * @brief      Grayscale to RGB24
  *
@@ -97,6 +204,336 @@ extern void arm_gray8_to_rgb24(const arm_cv_image_gray8_t* ImageIn,
 extern void arm_rgb24_to_gray8(const arm_cv_image_rgb24_t* ImageIn,
                                      arm_cv_image_gray8_t* ImageOut);
 
+/**     
+ * @brief      Grayscale to RGB565
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ */
+extern void arm_gray8_to_rgb565(const arm_cv_image_gray8_t* ImageIn,
+                                      arm_cv_image_rgb565_t* ImageOut);
+
+/**     
+ * @brief      RGB24 to RGB565
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ */
+extern void arm_rgb24_to_rgb565(const arm_cv_image_rgb24_t* ImageIn,
+                                      arm_cv_image_rgb565_t* ImageOut);
+
+/**     
+ * @brief      RGB565 to Grayscale
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ */
+extern void arm_rgb565_to_gray8(const arm_cv_image_rgb565_t* ImageIn,
+                                      arm_cv_image_gray8_t* ImageOut);
+
+/**     
+ * @brief      RGB565 to RGB24
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ */
+extern void arm_rgb565_to_rgb24(const arm_cv_image_rgb565_t* ImageIn,
+                                      arm_cv_image_rgb24_t* ImageOut);
+
+/**
+ * @brief   Layout of a network input tensor
+ *
+ * @par NHWC
+ *      The channels of a pixel are consecutive (same as rgb24)
+ * @par NCHW
+ *      Each channel is a plane of height * width elements
+ */
+typedef enum {
+  ARM_CV_TENSOR_NHWC = 0,
+  ARM_CV_TENSOR_NCHW = 1
+} arm_cv_tensor_layout_t;
+
+/**
+ * @brief   Normalization and quantization of a network input tensor
+ * @param   mean       mean of each channel, in pixel units
+ * @param   scale      scale of each channel: the normalized value is (p - mean) * scale
+ * @param   qScale     quantization scale of the tensor (not used for float tensors)
+ * @param   zeroPoint  quantization zero point of the tensor (not used for float tensors)
+ *
+ * @par Channels
+ *      The channels are in the order of the tensor : R, G, B
+ *      for color images. Only the first one is used for gray images.
+ */
+typedef struct _arm_cv_tensor_norm {
+  float32_t mean[3];
+  float32_t scale[3];
+  float32_t qScale;
+  int32_t zeroPoint;
+} arm_cv_tensor_norm_t;
+
+/**
+ * @brief   Number of elements per channel of the lookup table of a tensor plan
+ */
+#define ARM_CV_TENSOR_LUT_LENGTH 256
+
+/**
+ * @brief   Plan of a conversion to an int8 tensor
+ * @param   nbChannels  number of channels of the tensor
+ * @param   layout      layout of the tensor
+ * @param   pLut        for each channel, the tensor value of the 256 pixel values
+ */
+typedef struct _arm_cv_tensor_plan_s8 {
+  uint8_t nbChannels;
+  arm_cv_tensor_layout_t layout;
+  const int8_t *pLut;
+} arm_cv_tensor_plan_s8_t;
+
+/**
+ * @brief   Plan of a conversion to an uint8 tensor
+ * @param   nbChannels  number of channels of the tensor
+ * @param   layout      layout of the tensor
+ * @param   pLut        for each channel, the tensor value of the 256 pixel values
+ */
+typedef struct _arm_cv_tensor_plan_u8 {
+  uint8_t nbChannels;
+  arm_cv_tensor_layout_t layout;
+  const uint8_t *pLut;
+} arm_cv_tensor_plan_u8_t;
+
+/**
+ * @brief   Plan of a conversion to a float tensor
+ * @param   nbChannels  number of channels of the tensor
+ * @param   layout      layout of the tensor
+ * @param   pLut        for each channel, the tensor value of the 256 pixel values
+ */
+typedef struct _arm_cv_tensor_plan_f32 {
+  uint8_t nbChannels;
+  arm_cv_tensor_layout_t layout;
+  const float32_t *pLut;
+} arm_cv_tensor_plan_f32_t;
+
+/**
+ * @brief      Initialize the plan of a conversion to an int8 tensor
+ *
+ * @param[out]     plan        The plan
+ * @param[in]      norm        The normalization and quantization parameters
+ * @param[in]      nbChannels  Number of channels of the tensor (1 for gray8, 3 otherwise)
+ * @param[in]      layout      Layout of the tensor
+ * @param[in,out]  pLut        Buffer of nbChannels * ARM_CV_TENSOR_LUT_LENGTH elements
+ */
+extern void arm_cv_tensor_plan_init_s8(arm_cv_tensor_plan_s8_t *plan,
+                                       const arm_cv_tensor_norm_t *norm,
+                                       const uint8_t nbChannels,
+                                       const arm_cv_tensor_layout_t layout,
+                                       int8_t *pLut);
+
+/**
+ * @brief      Initialize the plan of a conversion to an uint8 tensor
+ *
+ * @param[out]     plan        The plan
+ * @param[in]      norm        The normalization and quantization parameters
+ * @param[in]      nbChannels  Number of channels of the tensor (1 for gray8, 3 otherwise)
+ * @param[in]      layout      Layout of the tensor
+ * @param[in,out]  pLut        Buffer of nbChannels * ARM_CV_TENSOR_LUT_LENGTH elements
+ */
+extern void arm_cv_tensor_plan_init_u8(arm_cv_tensor_plan_u8_t *plan,
+                                       const arm_cv_tensor_norm_t *norm,
+                                       const uint8_t nbChannels,
+                                       const arm_cv_tensor_layout_t layout,
+                                       uint8_t *pLut);
+
+/**
+ * @brief      Initialize the plan of a conversion to a float tensor
+ *
+ * @param[out]     plan        The plan
+ * @param[in]      norm        The normalization parameters
+ * @param[in]      nbChannels  Number of channels of the tensor (1 for gray8, 3 otherwise)
+ * @param[in]      layout      Layout of the tensor
+ * @param[in,out]  pLut        Buffer of nbChannels * ARM_CV_TENSOR_LUT_LENGTH elements
+ */
+extern void arm_cv_tensor_plan_init_f32(arm_cv_tensor_plan_f32_t *plan,
+                                        const arm_cv_tensor_norm_t *norm,
+                                        const uint8_t nbChannels,
+                                        const arm_cv_tensor_layout_t layout,
+                                        float32_t *pLut);
+
+/**
+ * @brief      RGB24 to an int8 tensor
+ *
+ * @param[in]  ImageIn   The input image
+ * @param[in]  plan      The plan
+ * @param      pTensor   The output tensor
+ */
+extern void arm_rgb24_to_tensor_s8(const arm_cv_image_rgb24_t* ImageIn,
+                                   const arm_cv_tensor_plan_s8_t *plan,
+                                   int8_t *pTensor);
+
+/**
+ * @brief      RGB24 to an uint8 tensor
+ *
+ * @param[in]  ImageIn   The input image
+ * @param[in]  plan      The plan
+ * @param      pTensor   The output tensor
+ */
+extern void arm_rgb24_to_tensor_u8(const arm_cv_image_rgb24_t* ImageIn,
+                                   const arm_cv_tensor_plan_u8_t *plan,
+                                   uint8_t *pTensor);
+
+/**
+ * @brief      RGB24 to a float tensor
+ *
+ * @param[in]  ImageIn   The input image
+ * @param[in]  plan      The plan
+ * @param      pTensor   The output tensor
+ */
+extern void arm_rgb24_to_tensor_f32(const arm_cv_image_rgb24_t* ImageIn,
+                                    const arm_cv_tensor_plan_f32_t *plan,
+                                    float32_t *pTensor);
+
+/**
+ * @brief      Unpacked BGR 8U3C to an int8 tensor
+ *
+ * @param[in]  ImageIn   The input image
+ * @param[in]  plan      The plan
+ * @param      pTensor   The output tensor
+ */
+extern void arm_bgr_8U3C_to_tensor_s8(const arm_cv_image_bgr_8U3C_t* ImageIn,
+                                      const arm_cv_tensor_plan_s8_t *plan,
+                                      int8_t *pTensor);
+
+/**
+ * @brief      Unpacked BGR 8U3C to an uint8 tensor
+ *
+ * @param[in]  ImageIn   The input image
+ * @param[in]  plan      The plan
+ * @param      pTensor   The output tensor
+ */
+extern void arm_bgr_8U3C_to_tensor_u8(const arm_cv_image_bgr_8U3C_t* ImageIn,
+                                      const arm_cv_tensor_plan_u8_t *plan,
+                                      uint8_t *pTensor);
+
+/**
+ * @brief      Unpacked BGR 8U3C to a float tensor
+ *
+ * @param[in]  ImageIn   The input image
+ * @param[in]  plan      The plan
+ * @param      pTensor   The output tensor
+ */
+extern void arm_bgr_8U3C_to_tensor_f32(const arm_cv_image_bgr_8U3C_t* ImageIn,
+                                       const arm_cv_tensor_plan_f32_t *plan,
+                                       float32_t *pTensor);
+
+/**
+ * @brief      Grayscale to an int8 tensor
+ *
+ * @param[in]  ImageIn   The input image
+ * @param[in]  plan      The plan
+ * @param      pTensor   The output tensor
+ */
+extern void arm_gray8_to_tensor_s8(const arm_cv_image_gray8_t* ImageIn,
+                                   const arm_cv_tensor_plan_s8_t *plan,
+                                   int8_t *pTensor);
+
+/**
+ * @brief      Grayscale to an uint8 tensor
+ *
+ * @param[in]  ImageIn   The input image
+ * @param[in]  plan      The plan
+ * @param      pTensor   The output tensor
+ */
+extern void arm_gray8_to_tensor_u8(const arm_cv_image_gray8_t* ImageIn,
+                                   const arm_cv_tensor_plan_u8_t *plan,
+                                   uint8_t *pTensor);
+
+/**
+ * @brief      Grayscale to a float tensor
+ *
+ * @param[in]  ImageIn   The input image
+ * @param[in]  plan      The plan
+ * @param      pTensor   The output tensor
+ */
+extern void arm_gray8_to_tensor_f32(const arm_cv_image_gray8_t* ImageIn,
+                                    const arm_cv_tensor_plan_f32_t *plan,
+                                    float32_t *pTensor);
+
+/**
+ * @brief      YUYV to an int8 tensor
+ *
+ * @param[in]  ImageIn   The input image
+ * @param[in]  plan      The plan
+ * @param      pTensor   The output tensor
+ * @param      pScratch  Buffer of width * 3 bytes
+ */
+extern void arm_yuyv_to_tensor_s8(const arm_cv_image_yuyv_t* ImageIn,
+                                  const arm_cv_tensor_plan_s8_t *plan,
+                                  int8_t *pTensor,
+                                  channel_uint8_t *pScratch);
+
+/**
+ * @brief      YUYV to an uint8 tensor
+ *
+ * @param[in]  ImageIn   The input image
+ * @param[in]  plan      The plan
+ * @param      pTensor   The output tensor
+ * @param      pScratch  Buffer of width * 3 bytes
+ */
+extern void arm_yuyv_to_tensor_u8(const arm_cv_image_yuyv_t* ImageIn,
+                                  const arm_cv_tensor_plan_u8_t *plan,
+                                  uint8_t *pTensor,
+                                  channel_uint8_t *pScratch);
+
+/**
+ * @brief      YUYV to a float tensor
+ *
+ * @param[in]  ImageIn   The input image
+ * @param[in]  plan      The plan
+ * @param      pTensor   The output tensor
+ * @param      pScratch  Buffer of width * 3 bytes
+ */
+extern void arm_yuyv_to_tensor_f32(const arm_cv_image_yuyv_t* ImageIn,
+                                   const arm_cv_tensor_plan_f32_t *plan,
+                                   float32_t *pTensor,
+                                   channel_uint8_t *pScratch);
+
+/**
+ * @brief      UYVY to an int8 tensor
+ *
+ * @param[in]  ImageIn   The input image
+ * @param[in]  plan      The plan
+ * @param      pTensor   The output tensor
+ * @param      pScratch  Buffer of width * 3 bytes
+ */
+extern void arm_uyvy_to_tensor_s8(const arm_cv_image_uyvy_t* ImageIn,
+                                  const arm_cv_tensor_plan_s8_t *plan,
+                                  int8_t *pTensor,
+                                  channel_uint8_t *pScratch);
+
+/**
+ * @brief      UYVY to an uint8 tensor
+ *
+ * @param[in]  ImageIn   The input image
+ * @param[in]  plan      The plan
+ * @param      pTensor   The output tensor
+ * @param      pScratch  Buffer of width * 3 bytes
+ */
+extern void arm_uyvy_to_tensor_u8(const arm_cv_image_uyvy_t* ImageIn,
+                                  const arm_cv_tensor_plan_u8_t *plan,
+                                  uint8_t *pTensor,
+                                  channel_uint8_t *pScratch);
+
+/**
+ * @brief      UYVY to a float tensor
+ *
+ * @param[in]  ImageIn   The input image
+ * @param[in]  plan      The plan
+ * @param      pTensor   The output tensor
+ * @param      pScratch  Buffer of width * 3 bytes
+ */
+extern void arm_uyvy_to_tensor_f32(const arm_cv_image_uyvy_t* ImageIn,
+                                   const arm_cv_tensor_plan_f32_t *plan,
+                                   float32_t *pTensor,
+                                   channel_uint8_t *pScratch);
+
 #ifdef   __cplusplus
 }
 #endif
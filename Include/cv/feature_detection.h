@@ -35,13 +35,28 @@
 extern "C"
 {
 #endif
+
+// Options of arm_cv_canny_edge_sobel_flags, arm_cv_canny_edge_gaussian_sobel and their variants
+#define ARM_CV_CANNY_DEFAULT 0
+// The direction of the gradient is found by comparing its components instead of computing its angle.
+// The diagonal is not always the same as the default mode, see arm_cv_canny_edge_sobel_flags
+#define ARM_CV_CANNY_OCTANT_DIRECTION 0x01
+// The magnitude of the gradient is |gx| + |gy|
+#define ARM_CV_CANNY_L1_GRADIENT 0x02
+// The weak edges are tracked through the whole image instead of the 8 neighbors
+#define ARM_CV_CANNY_FULL_HYSTERESIS 0x04
+
 /**
  * @brief      Return the scratch size for canny_sobel function
  *
  * @param[in]     width         The width of the image
  * @return		  Scratch size in bytes
+ *
+ * @par The return type changed from uint16_t to uint32_t
+ *      uint16_t overflowed for large widths. It is an ABI break: code
+ *      built with the previous headers must be rebuilt.
  */
-extern uint16_t arm_cv_get_scratch_size_canny_sobel(int width);
+extern uint32_t arm_cv_get_scratch_size_canny_sobel(int width);
 
 /**
  * @brief      Canny edge with sobel integrated
@@ -65,6 +80,231 @@ extern void arm_cv_canny_edge_sobel(const arm_cv_image_gray8_t* imageIn,
                                             uint8_t lowThreshold,
                                             uint8_t highThreshold);
 
+/**
+ * @brief      Canny edge with sobel integrated and options
+ *
+ * @param[in]     imageIn         The input image
+ * @param[out]    imageOut        The output image
+ * @param[in,out] scratch         Temporary buffer
+ * @param[in]     lowThreshold    The low threshold
+ * @param[in]     highThreshold   The high threshold
+ * @param[in]     flags           Combination of ARM_CV_CANNY_* options
+ *
+ * @par Options
+ *
+ * With ARM_CV_CANNY_OCTANT_DIRECTION, the direction of the gradient is given by comparing |gx| and |gy|
+ * scaled by tan(22.5 deg) in fixed point instead of computing the angle with arm_atan2_q15. The diagonal is
+ * selected with the sign of gx * gy, so a gradient and its opposite use the same neighbors like in OpenCV.
+ * The default mode folds the angle with its absolute value and the diagonal only depends on the sign of gy.
+ * The two modes select different diagonals when gx > 0, and the limits of the default mode
+ * are 22, 67, 112 and 160 degrees instead of multiples of 22.5 degrees.
+ * With Helium, the non maximum suppression and the hysteresis are then fully computed in vector lanes.
+ *
+ * With ARM_CV_CANNY_L1_GRADIENT, the magnitude of the gradient is |gx| + |gy| instead of
+ * sqrt(gx^2 + gy^2), like OpenCV with L2gradient set to false. It is saturated to q15.
+ *
+ * With ARM_CV_CANNY_FULL_HYSTERESIS, the weak pixels connected to a strong pixel by a chain of weak pixels
+ * are kept. This function has no stack so the edges are only traced at the end, by scanning the output image
+ * forward and backward until there is no change. It can take many passes on a large image,
+ * arm_cv_canny_edge_sobel_hysteresis with a stack gives the same result in a single pass.
+ *
+ * The image is processed line by line and the borders of the output image are set to 0.
+ *
+ * @par  Temporary buffer sizing:
+ *
+ * Will use a temporary buffer to store intermediate values of gradient and magnitude.
+ *
+ * Size of temporary buffer is given by
+ * arm_cv_get_scratch_size_canny_sobel(int width)
+ */
+extern void arm_cv_canny_edge_sobel_flags(const arm_cv_image_gray8_t* imageIn,
+                                                  arm_cv_image_gray8_t* imageOut,
+                                                  q15_t* scratch,
+                                                  uint8_t lowThreshold,
+                                                  uint8_t highThreshold,
+                                                  const uint8_t flags);
+
+/**
+ * @brief      Return the scratch size for canny_gaussian_sobel function
+ *
+ * @param[in]     width         The width of the image
+ * @return		  Scratch size in bytes
+ *
+ * @par The return type changed from uint16_t to uint32_t
+ *      uint16_t overflowed for large widths. It is an ABI break: code
+ *      built with the previous headers must be rebuilt.
+ */
+extern uint32_t arm_cv_get_scratch_size_canny_gaussian_sobel(int width);
+
+/**
+ * @brief      Canny edge with the 3x3 gaussian and sobel integrated
+ *
+ * @param[in]     imageIn         The input image
+ * @param[out]    imageOut        The output image
+ * @param[in,out] scratch         Temporary buffer
+ * @param[in]     lowThreshold    The low threshold
+ * @param[in]     highThreshold   The high threshold
+ * @param[in]     borderType      Type of border used by the gaussian, supported are Nearest, Wrap and Reflect
+ * @param[in]     flags           Combination of ARM_CV_CANNY_* options, see arm_cv_canny_edge_sobel_flags
+ *
+ * @par Algorithm
+ *
+ * Each line of the input is smoothed with the same kernel as arm_gaussian_filter_3x3_fixp when it
+ * is needed by the sobel. Only the three last smoothed lines are kept in a circular buffer
+ * so there is no need for a full frame intermediate image.
+ * The borders of the output image are set to 0.
+ *
+ * @par  Temporary buffer sizing:
+ *
+ * Will use a temporary buffer to store the smoothed lines and the intermediate values of gradient and magnitude.
+ *
+ * Size of temporary buffer is given by
+ * arm_cv_get_scratch_size_canny_gaussian_sobel(int width)
+ */
+extern void arm_cv_canny_edge_gaussian_sobel(const arm_cv_image_gray8_t* imageIn,
+                                                     arm_cv_image_gray8_t* imageOut,
+                                                     q15_t* scratch,
+                                                     uint8_t lowThreshold,
+                                                     uint8_t highThreshold,
+                                                     const int8_t borderType,
+                                                     const uint8_t flags);
+
+/**
+ * @brief      Canny edge with sobel integrated and the full hysteresis
+ *
+ * @param[in]     imageIn         The input image
+ * @param[out]    imageOut        The output image
+ * @param[in,out] scratch         Temporary buffer
+ * @param[in]     lowThreshold    The low threshold
+ * @param[in]     highThreshold   The high threshold
+ * @param[in]     flags           Combination of ARM_CV_CANNY_* options, see arm_cv_canny_edge_sobel_flags
+ * @param[in,out] stack           Buffer of the edge tracking
+ * @param[in]     stackSize       Number of elements of the stack
+ *
+ * @par Algorithm
+ *
+ * The edges are always tracked through the whole image: ARM_CV_CANNY_FULL_HYSTERESIS is implied,
+ * it can be omitted from flags and it has no other effect. The weak pixels are kept if they are connected
+ * to a strong pixel by a chain of weak pixels, like OpenCV.
+ * The edges are traced with the stack just after the non maximum suppression of each line, so the
+ * image is processed in a single pass and only the labels of the output image are read again.
+ *
+ * @par  Stack sizing:
+ *
+ * A stack of 2 * width elements is enough for most images. When the stack is full, the result
+ * is the same but the remaining tracing is done by scanning the output image at the end.
+ * The stack can be NULL with a stackSize of 0, then the whole tracing is done by this scan.
+ *
+ * @par  Temporary buffer sizing:
+ *
+ * Size of temporary buffer is given by
+ * arm_cv_get_scratch_size_canny_sobel(int width)
+ */
+extern void arm_cv_canny_edge_sobel_hysteresis(const arm_cv_image_gray8_t* imageIn,
+                                                       arm_cv_image_gray8_t* imageOut,
+                                                       q15_t* scratch,
+                                                       uint8_t lowThreshold,
+                                                       uint8_t highThreshold,
+                                                       const uint8_t flags,
+                                                       uint32_t* stack,
+                                                       uint32_t stackSize);
+
+/**
+ * @brief      Canny edge with the 3x3 gaussian and sobel integrated and the full hysteresis
+ *
+ * @param[in]     imageIn         The input image
+ * @param[out]    imageOut        The output image
+ * @param[in,out] scratch         Temporary buffer
+ * @param[in]     lowThreshold    The low threshold
+ * @param[in]     highThreshold   The high threshold
+ * @param[in]     borderType      Type of border used by the gaussian, supported are Nearest, Wrap and Reflect
+ * @param[in]     flags           Combination of ARM_CV_CANNY_* options, see arm_cv_canny_edge_sobel_flags
+ * @param[in,out] stack           Buffer of the edge tracking
+ * @param[in]     stackSize       Number of elements of the stack
+ *
+ * @par Algorithm
+ *
+ * Same as arm_cv_canny_edge_gaussian_sobel with the edge tracking of arm_cv_canny_edge_sobel_hysteresis.
+ *
+ * @par  Temporary buffer sizing:
+ *
+ * Size of temporary buffer is given by
+ * arm_cv_get_scratch_size_canny_gaussian_sobel(int width)
+ */
+extern void arm_cv_canny_edge_gaussian_sobel_hysteresis(const arm_cv_image_gray8_t* imageIn,
+                                                                arm_cv_image_gray8_t* imageOut,
+                                                                q15_t* scratch,
+                                                                uint8_t lowThreshold,
+                                                                uint8_t highThreshold,
+                                                                const int8_t borderType,
+                                                                const uint8_t flags,
+                                                                uint32_t* stack,
+                                                                uint32_t stackSize);
+
+/**
+ * @brief      Canny edge with sobel integrated on a strip of the image
+ *
+ * @param[in]     imageIn         The rows of the input image needed by the strip, see arm_cv_get_strip_first_input_row
+ *                                with the radius ARM_CV_STRIP_RADIUS_CANNY_SOBEL
+ * @param[out]    imageOut        The rows of the strip in the output image
+ * @param[in]     strip           The position of the strip in the image
+ * @param[in,out] scratch         Temporary buffer
+ * @param[in]     lowThreshold    The low threshold
+ * @param[in]     highThreshold   The high threshold
+ * @param[in]     flags           Combination of ARM_CV_CANNY_* options, except ARM_CV_CANNY_FULL_HYSTERESIS
+ *
+ * @par Hysteresis
+ *
+ * The hysteresis is local, like arm_cv_canny_edge_sobel_flags without ARM_CV_CANNY_FULL_HYSTERESIS, so
+ * the output rows are the same as on the full image and the strips are independent. The edges crossing
+ * the strips cannot be traced so ARM_CV_CANNY_FULL_HYSTERESIS is not supported: it is asserted in debug
+ * builds and the output is not written otherwise.
+ *
+ * @par  Temporary buffer sizing:
+ *
+ * Size of temporary buffer is given by
+ * arm_cv_get_scratch_size_canny_sobel(int width)
+ */
+extern void arm_cv_canny_edge_sobel_strip(const arm_cv_image_gray8_t* imageIn,
+                                                  arm_cv_image_gray8_t* imageOut,
+                                                  const arm_cv_strip_t* strip,
+                                                  q15_t* scratch,
+                                                  uint8_t lowThreshold,
+                                                  uint8_t highThreshold,
+                                                  const uint8_t flags);
+
+/**
+ * @brief      Canny edge with the 3x3 gaussian and sobel integrated on a strip of the image
+ *
+ * @param[in]     imageIn         The rows of the input image needed by the strip, see arm_cv_get_strip_first_input_row
+ *                                with the radius ARM_CV_STRIP_RADIUS_CANNY_GAUSSIAN_SOBEL
+ * @param[out]    imageOut        The rows of the strip in the output image
+ * @param[in]     strip           The position of the strip in the image
+ * @param[in,out] scratch         Temporary buffer
+ * @param[in]     lowThreshold    The low threshold
+ * @param[in]     highThreshold   The high threshold
+ * @param[in]     borderType      Type of border used by the gaussian, supported are Nearest and Reflect.
+ *                                Wrap is asserted in debug builds and the output is not written otherwise
+ * @param[in]     flags           Combination of ARM_CV_CANNY_* options, except ARM_CV_CANNY_FULL_HYSTERESIS
+ *
+ * @par Hysteresis
+ *
+ * Same as arm_cv_canny_edge_sobel_strip, ARM_CV_CANNY_FULL_HYSTERESIS is not supported.
+ *
+ * @par  Temporary buffer sizing:
+ *
+ * Size of temporary buffer is given by
+ * arm_cv_get_scratch_size_canny_gaussian_sobel(int width)
+ */
+extern void arm_cv_canny_edge_gaussian_sobel_strip(const arm_cv_image_gray8_t* imageIn,
+                                                           arm_cv_image_gray8_t* imageOut,
+                                                           const arm_cv_strip_t* strip,
+                                                           q15_t* scratch,
+                                                           uint8_t lowThreshold,
+                                                           uint8_t highThreshold,
+                                                           const int8_t borderType,
+                                                           const uint8_t flags);
+
 #ifdef   __cplusplus
 }
 #endif
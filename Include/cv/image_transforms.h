@@ -77,6 +77,42 @@ extern void arm_crop_rgb24(const arm_cv_image_rgb24_t* ImageIn,
                            const uint32_t bottom
                            );
 
+/**
+ * @brief      Gray8 view of a region of an image
+ *
+ * @param[in]  ImageIn   The image in
+ * @param[out] ImageOut  The view
+ * @param[in]  left      The left boundary
+ * @param[in]  top       The top boundary
+ * @param[in]  right     The right boundary
+ * @param[in]  bottom    The bottom boundary
+ */
+extern void arm_cv_image_view_gray8(const arm_cv_image_gray8_t* ImageIn,
+                                    arm_cv_image_gray8_t* ImageOut,
+                                    const uint32_t left,
+                                    const uint32_t top,
+                                    const uint32_t right,
+                                    const uint32_t bottom
+                                    );
+
+/**
+ * @brief      RGB24 view of a region of an image
+ *
+ * @param[in]  ImageIn   The image in
+ * @param[out] ImageOut  The view
+ * @param[in]  left      The left boundary
+ * @param[in]  top       The top boundary
+ * @param[in]  right     The right boundary
+ * @param[in]  bottom    The bottom boundary
+ */
+extern void arm_cv_image_view_rgb24(const arm_cv_image_rgb24_t* ImageIn,
+                                    arm_cv_image_rgb24_t* ImageOut,
+                                    const uint32_t left,
+                                    const uint32_t top,
+                                    const uint32_t right,
+                                    const uint32_t bottom
+                                    );
+
 /**     
  * @brief      Resize BGR 8U3C image (float implementation)
  *
@@ -111,6 +147,301 @@ extern void arm_image_resize_gray8_f32(const arm_cv_image_gray8_t* ImageIn,
 extern void arm_image_resize_bgr_8U3C_to_rgb24_f32(const arm_cv_image_bgr_8U3C_t* ImageIn,
                                          arm_cv_image_rgb24_t* ImageOut,
                                          uint8_t *p_img);
+
+/**     
+ * @brief      Resize gray image (fixed point implementation)
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ * @param[in,out]  p_lines   Temporary buffer
+ */
+extern void arm_image_resize_gray8_fixp(const arm_cv_image_gray8_t* ImageIn,
+                                              arm_cv_image_gray8_t* ImageOut,
+                                              uint16_t *p_lines);
+
+/**     
+ * @brief      Resize BGR 8U3C image (fixed point implementation)
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ * @param[in,out]  p_lines   Temporary buffer
+ */
+extern void arm_image_resize_bgr_8U3C_fixp(const arm_cv_image_bgr_8U3C_t* ImageIn,
+                                                 arm_cv_image_bgr_8U3C_t* ImageOut,
+                                                 uint16_t *p_lines);
+
+/**     
+ * @brief      Resize RGB24 image (fixed point implementation)
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ * @param[in,out]  p_lines   Temporary buffer
+ */
+extern void arm_image_resize_rgb24_fixp(const arm_cv_image_rgb24_t* ImageIn,
+                                              arm_cv_image_rgb24_t* ImageOut,
+                                              uint16_t *p_lines);
+
+/**
+ * @brief      Return the scratch size for the fixed point resize functions
+ *
+ * @param[in]     outputWidth  The width of the output image
+ * @param[in]     nbChannels   Number of interleaved channels (1 for gray8 and bgr_8U3C, 3 for rgb24)
+ * @return		  Scratch size in bytes
+ */
+extern uint32_t arm_get_scratch_size_resize_fixp(const int outputWidth, const uint8_t nbChannels);
+
+/**
+ * @brief   Precomputed positions of a fixed point resize
+ * @param   inputWidth    width of the input images
+ * @param   inputHeight   height of the input images
+ * @param   outputWidth   width of the output images
+ * @param   outputHeight  height of the output images
+ * @param   xIndex        for each output column, the first input column used
+ * @param   xIndex1       for each output column, the second input column used
+ * @param   xWeight       for each output column, q8 weight of the second input column
+ * @param   yIndex        for each output row, the first input row used
+ * @param   yWeight       for each output row, q8 weight of the second input row
+ *
+ * @par The tables are in the buffer given to arm_image_resize_plan_init
+ */
+typedef struct _arm_image_resize_plan
+{
+    uint16_t inputWidth;
+    uint16_t inputHeight;
+    uint16_t outputWidth;
+    uint16_t outputHeight;
+    uint16_t *xIndex;
+    uint16_t *xIndex1;
+    uint8_t *xWeight;
+    uint16_t *yIndex;
+    uint8_t *yWeight;
+} arm_image_resize_plan_t;
+
+/**
+ * @brief      Return the size of the buffer of a resize plan
+ *
+ * @param[in]     outputWidth   The width of the output image
+ * @param[in]     outputHeight  The height of the output image
+ * @return		  Buffer size in bytes
+ */
+extern uint32_t arm_get_buffer_size_resize_plan(const int outputWidth, const int outputHeight);
+
+/**
+ * @brief          Compute the positions used by the fixed point resize
+ *
+ * @param[out]     plan          The resize plan
+ * @param[in]      inputWidth    The width of the input image
+ * @param[in]      inputHeight   The height of the input image
+ * @param[in]      outputWidth   The width of the output image
+ * @param[in]      outputHeight  The height of the output image
+ * @param[in,out]  buffer        Buffer for the tables of the plan, 16 bits aligned
+ */
+extern void arm_image_resize_plan_init(arm_image_resize_plan_t *plan,
+                                       const uint16_t inputWidth,
+                                       const uint16_t inputHeight,
+                                       const uint16_t outputWidth,
+                                       const uint16_t outputHeight,
+                                       uint8_t *buffer);
+
+/**     
+ * @brief      Resize gray image with a plan (fixed point implementation)
+ *
+ * @param[in]  plan      The resize plan
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ * @param[in,out]  p_lines   Temporary buffer
+ */
+extern void arm_image_resize_gray8_plan(const arm_image_resize_plan_t *plan,
+                                        const arm_cv_image_gray8_t* ImageIn,
+                                              arm_cv_image_gray8_t* ImageOut,
+                                              uint16_t *p_lines);
+
+/**     
+ * @brief      Resize BGR 8U3C image with a plan (fixed point implementation)
+ *
+ * @param[in]  plan      The resize plan
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ * @param[in,out]  p_lines   Temporary buffer
+ */
+extern void arm_image_resize_bgr_8U3C_plan(const arm_image_resize_plan_t *plan,
+                                           const arm_cv_image_bgr_8U3C_t* ImageIn,
+                                                 arm_cv_image_bgr_8U3C_t* ImageOut,
+                                                 uint16_t *p_lines);
+
+/**     
+ * @brief      Resize RGB24 image with a plan (fixed point implementation)
+ *
+ * @param[in]  plan      The resize plan
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ * @param[in,out]  p_lines   Temporary buffer
+ */
+extern void arm_image_resize_rgb24_plan(const arm_image_resize_plan_t *plan,
+                                        const arm_cv_image_rgb24_t* ImageIn,
+                                              arm_cv_image_rgb24_t* ImageOut,
+                                              uint16_t *p_lines);
+
+/**
+ * @brief      Return the scratch size for the area resize functions
+ *
+ * @param[in]     inputWidth   The width of the input image
+ * @param[in]     outputWidth  The width of the output image
+ * @param[in]     nbChannels   Number of interleaved channels (1 for gray8 and bgr_8U3C, 3 for rgb24)
+ * @return		  Scratch size in bytes
+ */
+extern uint32_t arm_get_scratch_size_resize_area(const int inputWidth, const int outputWidth, const uint8_t nbChannels);
+
+/**
+ * @brief      Downscale a gray8 image by area averaging
+ *
+ * @param[in]      ImageIn   The input image
+ * @param          ImageOut  The output image
+ * @param[in,out]  scratch   Temporary buffer
+ *
+ * @par  Dimensions
+ *       Only downscaling is supported. If an output dimension is zero or
+ *       bigger than the input one, the output image is not written.
+ *       Use the bilinear arm_image_resize_gray8_fixp to upscale.
+ */
+extern void arm_image_resize_area_gray8(const arm_cv_image_gray8_t *ImageIn,
+                                        arm_cv_image_gray8_t *ImageOut,
+                                        uint32_t *scratch);
+
+/**
+ * @brief      Downscale a BGR 8U3C image by area averaging
+ *
+ * @param[in]      ImageIn   The input image
+ * @param          ImageOut  The output image
+ * @param[in,out]  scratch   Temporary buffer
+ *
+ * @par  Dimensions
+ *       Only downscaling is supported. If an output dimension is zero or
+ *       bigger than the input one, the output image is not written.
+ *       Use the bilinear arm_image_resize_bgr_8U3C_fixp to upscale.
+ */
+extern void arm_image_resize_area_bgr_8U3C(const arm_cv_image_bgr_8U3C_t *ImageIn,
+                                           arm_cv_image_bgr_8U3C_t *ImageOut,
+                                           uint32_t *scratch);
+
+/**
+ * @brief      Downscale a RGB24 image by area averaging
+ *
+ * @param[in]      ImageIn   The input image
+ * @param          ImageOut  The output image
+ * @param[in,out]  scratch   Temporary buffer
+ *
+ * @par  Dimensions
+ *       Only downscaling is supported. If an output dimension is zero or
+ *       bigger than the input one, the output image is not written.
+ *       Use the bilinear arm_image_resize_rgb24_fixp to upscale.
+ */
+extern void arm_image_resize_area_rgb24(const arm_cv_image_rgb24_t *ImageIn,
+                                        arm_cv_image_rgb24_t *ImageOut,
+                                        uint32_t *scratch);
+
+/**
+ * @brief      Return the scratch size for the nearest neighbour resize functions
+ *
+ * @param[in]     outputWidth  The width of the output image
+ * @return		  Scratch size in bytes
+ */
+extern uint32_t arm_get_scratch_size_resize_nearest(const int outputWidth);
+
+/**
+ * @brief      Resize a gray8 image with the nearest neighbour
+ *
+ * @param[in]      ImageIn   The input image
+ * @param          ImageOut  The output image
+ * @param[in,out]  scratch   Temporary buffer
+ */
+extern void arm_image_resize_nearest_gray8(const arm_cv_image_gray8_t *ImageIn,
+                                           arm_cv_image_gray8_t *ImageOut,
+                                           uint32_t *scratch);
+
+/**
+ * @brief      Resize a BGR 8U3C image with the nearest neighbour
+ *
+ * @param[in]      ImageIn   The input image
+ * @param          ImageOut  The output image
+ * @param[in,out]  scratch   Temporary buffer
+ */
+extern void arm_image_resize_nearest_bgr_8U3C(const arm_cv_image_bgr_8U3C_t *ImageIn,
+                                              arm_cv_image_bgr_8U3C_t *ImageOut,
+                                              uint32_t *scratch);
+
+/**
+ * @brief      Resize a RGB24 image with the nearest neighbour
+ *
+ * @param[in]      ImageIn   The input image
+ * @param          ImageOut  The output image
+ * @param[in,out]  scratch   Temporary buffer
+ */
+extern void arm_image_resize_nearest_rgb24(const arm_cv_image_rgb24_t *ImageIn,
+                                           arm_cv_image_rgb24_t *ImageOut,
+                                           uint32_t *scratch);
+
+/**
+ * @brief      Return the scratch size for arm_image_resize_yuv420_to_rgb24_fixp,
+ *             arm_image_resize_nv12_to_rgb24_fixp and arm_image_resize_nv21_to_rgb24_fixp
+ *
+ * @param[in]     outputWidth  The width of the output image
+ * @return		  Scratch size in bytes
+ */
+extern uint32_t arm_get_scratch_size_resize_yuv420_to_rgb24_fixp(const int outputWidth);
+
+/**     
+ * @brief      Resize YUV420 image and convert to RGB24 (fixed point implementation)
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ * @param[in,out]  p_lines   Temporary buffer
+ */
+extern void arm_image_resize_yuv420_to_rgb24_fixp(const arm_cv_image_yuv420_t* ImageIn,
+                                                        arm_cv_image_rgb24_t* ImageOut,
+                                                        uint16_t *p_lines);
+
+/**     
+ * @brief      Resize NV12 image and convert to RGB24 (fixed point implementation)
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ * @param[in,out]  p_lines   Temporary buffer
+ */
+extern void arm_image_resize_nv12_to_rgb24_fixp(const arm_cv_image_nv12_t* ImageIn,
+                                                      arm_cv_image_rgb24_t* ImageOut,
+                                                      uint16_t *p_lines);
+
+/**     
+ * @brief      Resize NV21 image and convert to RGB24 (fixed point implementation)
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ * @param[in,out]  p_lines   Temporary buffer
+ */
+extern void arm_image_resize_nv21_to_rgb24_fixp(const arm_cv_image_nv21_t* ImageIn,
+                                                      arm_cv_image_rgb24_t* ImageOut,
+                                                      uint16_t *p_lines);
+
+/**     
+ * @brief      Integral image of a gray8 image
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The integral image, of dimension (width + 1) x (height + 1)
+ */
+extern void arm_integral_gray8(const arm_cv_image_gray8_t* ImageIn,
+                                     arm_cv_image_u32_t* ImageOut);
+
+/**     
+ * @brief      Integral image and squared integral image of a gray8 image
+ *
+ * @param[in]  ImageIn     The input image
+ * @param      ImageOut    The integral image, of dimension (width + 1) x (height + 1)
+ * @param      ImageSqOut  The integral image of the squared pixels, of dimension (width + 1) x (height + 1)
+ */
+extern void arm_integral_squared_gray8(const arm_cv_image_gray8_t* ImageIn,
+                                             arm_cv_image_u32_t* ImageOut,
+                                             arm_cv_image_u64_t* ImageSqOut);
                                          
 #ifdef   __cplusplus
 }
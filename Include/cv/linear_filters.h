@@ -38,21 +38,32 @@ extern "C"
 #define ARM_CV_BORDER_WRAP 2
 #define ARM_CV_BORDER_REFLECT 3
 
+#define ARM_CV_SEPARABLE_MAX_KERNEL_SIZE 15
+#define ARM_CV_BOX_FILTER_MAX_RADIUS 15
+
 /**
  * @brief      Return the scratch size for generic linear filter function using a q15 buffer
  *
  * @param[in]     width        The width of the image
  * @return		  Scratch size in bytes
+ *
+ * @par The return type changed from uint16_t to uint32_t
+ *      uint16_t overflowed for large widths. It is an ABI break: code
+ *      built with the previous headers must be rebuilt.
  */
-extern uint16_t arm_get_linear_scratch_size_buffer_15(const int width);
+extern uint32_t arm_get_linear_scratch_size_buffer_15(const int width);
 
 /**
  * @brief      Return the scratch size for generic linear filter function using a q31 buffer
  *
  * @param[in]     width        The width of the image
  * @return		  Scratch size in bytes
+ *
+ * @par The return type changed from uint16_t to uint32_t
+ *      uint16_t overflowed for large widths. It is an ABI break: code
+ *      built with the previous headers must be rebuilt.
  */
-extern uint16_t arm_get_linear_scratch_size_buffer_31(const int width);
+extern uint32_t arm_get_linear_scratch_size_buffer_31(const int width);
 
 /**
  * @brief          Gaussian filter applying a 3x3 kernel and using q15 as intermediate values
@@ -66,6 +77,22 @@ extern uint16_t arm_get_linear_scratch_size_buffer_31(const int width);
 extern void arm_gaussian_filter_3x3_fixp(const arm_cv_image_gray8_t *imageIn, arm_cv_image_gray8_t *imageOut,
                                          q15_t *scratch, const int8_t borderType);
 
+/**
+ * @brief          Gaussian filter applying a 3x3 kernel and using q15 as intermediate values on a strip of the image
+ *
+ * @param[in]      imageIn     The rows of the input image needed by the strip, see arm_cv_get_strip_first_input_row
+ *                             with the radius ARM_CV_STRIP_RADIUS_3x3
+ * @param[out]     imageOut    The rows of the strip in the output image
+ * @param[in]      strip       The position of the strip in the image
+ * @param[in,out]  scratch     Temporary buffer
+ * @param[in]      borderType  Type of border to use, supported are Nearest and Reflect.
+ *                             Wrap is a precondition violation: it is asserted in debug
+ *                             builds and the output is not written otherwise
+ *
+ */
+extern void arm_gaussian_filter_3x3_fixp_strip(const arm_cv_image_gray8_t *imageIn, arm_cv_image_gray8_t *imageOut,
+                                               const arm_cv_strip_t *strip, q15_t *scratch, const int8_t borderType);
+
 /**
  * @brief          Gaussian filter applying a 5x5 kernel and using q15 as intermediate values
  *
@@ -78,6 +105,22 @@ extern void arm_gaussian_filter_3x3_fixp(const arm_cv_image_gray8_t *imageIn, ar
 extern void arm_gaussian_filter_5x5_fixp(const arm_cv_image_gray8_t *imageIn, arm_cv_image_gray8_t *imageOut,
                                          q15_t *scratch, const int8_t borderType);
 
+/**
+ * @brief          Gaussian filter applying a 5x5 kernel and using q15 as intermediate values on a strip of the image
+ *
+ * @param[in]      imageIn     The rows of the input image needed by the strip, see arm_cv_get_strip_first_input_row
+ *                             with the radius ARM_CV_STRIP_RADIUS_5x5
+ * @param[out]     imageOut    The rows of the strip in the output image
+ * @param[in]      strip       The position of the strip in the image
+ * @param[in,out]  scratch     Temporary buffer
+ * @param[in]      borderType  Type of border to use, supported are Nearest and Reflect.
+ *                             Wrap is a precondition violation: it is asserted in debug
+ *                             builds and the output is not written otherwise
+ *
+ */
+extern void arm_gaussian_filter_5x5_fixp_strip(const arm_cv_image_gray8_t *imageIn, arm_cv_image_gray8_t *imageOut,
+                                               const arm_cv_strip_t *strip, q15_t *scratch, const int8_t borderType);
+
 /**
  * @brief          Gaussian filter applying a 7x7 kernel and using q15 as intermediate values
  *
@@ -90,6 +133,22 @@ extern void arm_gaussian_filter_5x5_fixp(const arm_cv_image_gray8_t *imageIn, ar
 extern void arm_gaussian_filter_7x7_buffer_15_fixp(const arm_cv_image_gray8_t *imageIn, arm_cv_image_gray8_t *imageOut,
                                          q15_t *scratch, const int8_t borderType);
 
+/**
+ * @brief          Gaussian filter applying a 7x7 kernel and using q15 as intermediate values on a strip of the image
+ *
+ * @param[in]      imageIn     The rows of the input image needed by the strip, see arm_cv_get_strip_first_input_row
+ *                             with the radius ARM_CV_STRIP_RADIUS_7x7
+ * @param[out]     imageOut    The rows of the strip in the output image
+ * @param[in]      strip       The position of the strip in the image
+ * @param[in,out]  scratch     Temporary buffer
+ * @param[in]      borderType  Type of border to use, supported are Nearest and Reflect.
+ *                             Wrap is a precondition violation: it is asserted in debug
+ *                             builds and the output is not written otherwise
+ *
+ */
+extern void arm_gaussian_filter_7x7_buffer_15_fixp_strip(const arm_cv_image_gray8_t *imageIn, arm_cv_image_gray8_t *imageOut,
+                                                         const arm_cv_strip_t *strip, q15_t *scratch, const int8_t borderType);
+
 /**
  * @brief          Gaussian filter applying a 7x7 kernel and using q31 as intermediate values
  *
@@ -102,13 +161,33 @@ extern void arm_gaussian_filter_7x7_buffer_15_fixp(const arm_cv_image_gray8_t *i
 extern void arm_gaussian_filter_7x7_buffer_31_fixp(const arm_cv_image_gray8_t *imageIn, arm_cv_image_gray8_t *imageOut,
                                             q31_t *scratch, const int8_t borderType);
 
+/**
+ * @brief          Gaussian filter applying a 7x7 kernel and using q31 as intermediate values on a strip of the image
+ *
+ * @param[in]      imageIn     The rows of the input image needed by the strip, see arm_cv_get_strip_first_input_row
+ *                             with the radius ARM_CV_STRIP_RADIUS_7x7
+ * @param[out]     imageOut    The rows of the strip in the output image
+ * @param[in]      strip       The position of the strip in the image
+ * @param[in,out]  scratch     Temporary buffer
+ * @param[in]      borderType  Type of border to use, supported are Nearest and Reflect.
+ *                             Wrap is a precondition violation: it is asserted in debug
+ *                             builds and the output is not written otherwise
+ *
+ */
+extern void arm_gaussian_filter_7x7_buffer_31_fixp_strip(const arm_cv_image_gray8_t *imageIn, arm_cv_image_gray8_t *imageOut,
+                                                         const arm_cv_strip_t *strip, q31_t *scratch, const int8_t borderType);
+
 /**
  * @brief      Return the scratch size for sobel functions using a q15 buffer
  *
  * @param[in]     width         The width of the image
  * @return		  Scratch size in bytes
+ *
+ * @par The return type changed from uint16_t to uint32_t
+ *      uint16_t overflowed for large widths. It is an ABI break: code
+ *      built with the previous headers must be rebuilt.
  */
-extern uint16_t arm_get_scratch_size_sobel(const int width);
+extern uint32_t arm_get_scratch_size_sobel(const int width);
 
 /**
  * @brief          Sobel filter computing the gradient on the vertical axis
@@ -122,6 +201,22 @@ extern uint16_t arm_get_scratch_size_sobel(const int width);
 extern void arm_sobel_vertical(const arm_cv_image_gray8_t *ImageIn, arm_cv_image_q15_t *ImageOut, q15_t *Buffer,
                                const int8_t borderType);
 
+/**
+ * @brief          Sobel filter computing the gradient on the vertical axis on a strip of the image
+ *
+ * @param[in]      imageIn     The rows of the input image needed by the strip, see arm_cv_get_strip_first_input_row
+ *                             with the radius ARM_CV_STRIP_RADIUS_3x3
+ * @param[out]     imageOut    The rows of the strip in the output image
+ * @param[in]      strip       The position of the strip in the image
+ * @param[in,out]  scratch     Buffer
+ * @param[in]      borderType  Type of border to use, supported are Nearest and Reflect.
+ *                             Wrap is a precondition violation: it is asserted in debug
+ *                             builds and the output is not written otherwise
+ *
+ */
+extern void arm_sobel_vertical_strip(const arm_cv_image_gray8_t *imageIn, arm_cv_image_q15_t *imageOut,
+                                     const arm_cv_strip_t *strip, q15_t *scratch, const int8_t borderType);
+
 /**
  * @brief          Sobel filter computing the gradient on the horizontal axis
  *
@@ -134,6 +229,153 @@ extern void arm_sobel_vertical(const arm_cv_image_gray8_t *ImageIn, arm_cv_image
 extern void arm_sobel_horizontal(const arm_cv_image_gray8_t *imageIn, arm_cv_image_q15_t *imageOut, q15_t *scratch,
                                  const int8_t borderType);
 
+/**
+ * @brief          Sobel filter computing the gradient on the horizontal axis on a strip of the image
+ *
+ * @param[in]      imageIn     The rows of the input image needed by the strip, see arm_cv_get_strip_first_input_row
+ *                             with the radius ARM_CV_STRIP_RADIUS_3x3
+ * @param[out]     imageOut    The rows of the strip in the output image
+ * @param[in]      strip       The position of the strip in the image
+ * @param[in,out]  scratch     Buffer
+ * @param[in]      borderType  Type of border to use, supported are Nearest and Reflect.
+ *                             Wrap is a precondition violation: it is asserted in debug
+ *                             builds and the output is not written otherwise
+ *
+ */
+extern void arm_sobel_horizontal_strip(const arm_cv_image_gray8_t *imageIn, arm_cv_image_q15_t *imageOut,
+                                       const arm_cv_strip_t *strip, q15_t *scratch, const int8_t borderType);
+
+/**
+ * @brief      Return the scratch size for the separable filter function using a q31 buffer
+ *
+ * @param[in]     width        The width of the image
+ * @param[in]     kernelSize   The size of the kernel
+ * @return		  Scratch size in bytes
+ */
+extern uint32_t arm_get_scratch_size_separable_filter(const int width, const uint8_t kernelSize);
+
+/**
+ * @brief          Separable filter applying a runtime defined kernel and using q31 as intermediate values
+ *
+ * @param[in]      imageIn     The input image
+ * @param[out]     imageOut    The output image
+ * @param[in,out]  scratch     Temporary buffer
+ * @param[in]      coefsRow    Coefficients applied in the horizontal direction
+ * @param[in]      coefsCol    Coefficients applied in the vertical direction
+ * @param[in]      kernelSize  Size of the kernel, odd number between 3 and 15.
+ *                             Other sizes are a precondition violation: they are
+ *                             asserted in debug builds and the output is not written otherwise
+ * @param[in]      shift       Right shift applied to the result to get back an uint8
+ * @param[in]      borderType  Type of border to use, supported are Nearest, Wrap and Reflect
+ *
+ */
+extern void arm_separable_filter_u8(const arm_cv_image_gray8_t *imageIn, arm_cv_image_gray8_t *imageOut,
+                                    q31_t *scratch, const q15_t *coefsRow, const q15_t *coefsCol,
+                                    const uint8_t kernelSize, const uint8_t shift, const int8_t borderType);
+
+#define ARM_CV_GAUSSIAN_PLAN_BUFFER_15 1
+#define ARM_CV_GAUSSIAN_PLAN_BUFFER_31 2
+
+/**
+ * @brief         Structure for a gaussian filter with a kernel computed from sigma
+ *
+ * @param coefs       Fixed point coefficients of the 1D kernel
+ * @param kernelSize  Size of the kernel
+ * @param shift       Right shift applied to the result to get back an uint8
+ * @param bufferType  Type of the intermediate line buffer, q15 or q31
+ *
+ */
+typedef struct _arm_cv_gaussian_plan
+{
+    q15_t coefs[ARM_CV_SEPARABLE_MAX_KERNEL_SIZE];
+    uint8_t kernelSize;
+    uint8_t shift;
+    uint8_t bufferType;
+} arm_cv_gaussian_plan_t;
+
+/**
+ * @brief          Compute the fixed point kernel of a gaussian filter
+ *
+ * @param[out]     plan        The gaussian plan
+ * @param[in]      sigma       Standard deviation of the gaussian, computed from kernelSize when not positive
+ * @param[in]      kernelSize  Size of the kernel, odd number between 3 and 15, computed from sigma when 0
+ *
+ * @par Maximum sigma
+ *
+ * When kernelSize is 0, the size computed from sigma is clamped to 15 taps.
+ * So sigma must not be bigger than about 2.3 (7 / 3) for the kernel to cover +/- 3 sigma.
+ * With a larger sigma the gaussian is truncated to +/- 7 pixels and the
+ * result is not the one of the expected gaussian.
+ *
+ */
+extern void arm_gaussian_plan_init(arm_cv_gaussian_plan_t *plan, const float32_t sigma, const uint8_t kernelSize);
+
+/**
+ * @brief      Return the scratch size for the gaussian filter using a plan
+ *
+ * @param[in]     plan         The gaussian plan
+ * @param[in]     width        The width of the image
+ * @return		  Scratch size in bytes
+ */
+extern uint32_t arm_get_scratch_size_gaussian_plan(const arm_cv_gaussian_plan_t *plan, const int width);
+
+/**
+ * @brief          Gaussian filter applying the kernel computed by arm_gaussian_plan_init
+ *
+ * @param[in]      plan        The gaussian plan
+ * @param[in]      imageIn     The input image
+ * @param[out]     imageOut    The output image
+ * @param[in,out]  scratch     Temporary buffer
+ * @param[in]      borderType  Type of border to use, supported are Nearest, Wrap and Reflect
+ *
+ */
+extern void arm_gaussian_filter_plan(const arm_cv_gaussian_plan_t *plan, const arm_cv_image_gray8_t *imageIn,
+                                     arm_cv_image_gray8_t *imageOut, q31_t *scratch, const int8_t borderType);
+
+/**
+ * @brief      Return the scratch size for the box filter function using a q15 buffer
+ *
+ * @param[in]     width        The width of the image
+ * @param[in]     radius       The radius of the box
+ * @return		  Scratch size in bytes
+ */
+extern uint32_t arm_get_scratch_size_box_filter(const int width, const uint8_t radius);
+
+/**
+ * @brief          Box filter computing the mean of the pixels in a square of size (2 * radius + 1)
+ *
+ * @param[in]      imageIn     The input image
+ * @param[out]     imageOut    The output image
+ * @param[in,out]  scratch     Temporary buffer
+ * @param[in]      radius      Radius of the box, between 1 and ARM_CV_BOX_FILTER_MAX_RADIUS
+ * @param[in]      borderType  Type of border to use, supported are Nearest, Wrap and Reflect
+ *
+ */
+extern void arm_box_filter_u8(const arm_cv_image_gray8_t *imageIn, arm_cv_image_gray8_t *imageOut, q15_t *scratch,
+                              const uint8_t radius, const int8_t borderType);
+
+/**
+ * @brief          Median filter on a 3x3 neighbourhood
+ *
+ * @param[in]      imageIn     The input image
+ * @param[out]     imageOut    The output image
+ * @param[in]      borderType  Type of border to use, supported are Nearest, Wrap and Reflect
+ *
+ */
+extern void arm_median_filter_3x3(const arm_cv_image_gray8_t *imageIn, arm_cv_image_gray8_t *imageOut,
+                                  const int8_t borderType);
+
+/**
+ * @brief          Median filter on a 5x5 neighbourhood
+ *
+ * @param[in]      imageIn     The input image
+ * @param[out]     imageOut    The output image
+ * @param[in]      borderType  Type of border to use, supported are Nearest, Wrap and Reflect
+ *
+ */
+extern void arm_median_filter_5x5(const arm_cv_image_gray8_t *imageIn, arm_cv_image_gray8_t *imageOut,
+                                  const int8_t borderType);
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,90 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS CV Library
+ * Title:        scratch_planner.h
+ * Description:  Scratch size planning for a pipeline of CMSIS-CV kernels
+ *
+ *
+ * Target Processor: Cortex-M
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2024 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef ARM_CV_SCRATCH_PLANNER_H
+#define ARM_CV_SCRATCH_PLANNER_H
+
+#include "arm_cv_types.h"
+#include "cv/linear_filters.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Kernels using a scratch buffer
+#define ARM_CV_SCRATCH_LINEAR_BUFFER_15 1
+#define ARM_CV_SCRATCH_LINEAR_BUFFER_31 2
+#define ARM_CV_SCRATCH_SOBEL 3
+#define ARM_CV_SCRATCH_SEPARABLE_FILTER 4
+#define ARM_CV_SCRATCH_GAUSSIAN_PLAN 5
+#define ARM_CV_SCRATCH_BOX_FILTER 6
+#define ARM_CV_SCRATCH_CANNY_SOBEL 7
+#define ARM_CV_SCRATCH_CANNY_GAUSSIAN_SOBEL 8
+#define ARM_CV_SCRATCH_RESIZE_FIXP 9
+
+/**
+ * @brief         Kernel of a pipeline sharing a scratch buffer
+ *
+ * @param kernel  Kernel using the scratch, one of ARM_CV_SCRATCH_*
+ * @param param   Kernel size of the separable filter, radius of the box filter
+ *                or number of interleaved channels of the fixed point resize
+ * @param width   Width of the input image of the kernel (of the output image for the resize)
+ * @param plan    Plan of the gaussian filter, only used with ARM_CV_SCRATCH_GAUSSIAN_PLAN
+ *
+ */
+typedef struct _arm_cv_scratch_kernel
+{
+    uint8_t kernel;
+    uint8_t param;
+    uint16_t width;
+    const arm_cv_gaussian_plan_t *plan;
+} arm_cv_scratch_kernel_t;
+
+/**
+ * @brief      Return the scratch size of one kernel
+ *
+ * @param[in]     kernel       The kernel and the size of its image
+ * @return		  Scratch size in bytes
+ */
+extern uint32_t arm_cv_get_scratch_size_kernel(const arm_cv_scratch_kernel_t *kernel);
+
+/**
+ * @brief      Return the scratch size to share between the kernels of a pipeline
+ *
+ * @param[in]     kernels      The kernels of the pipeline
+ * @param[in]     nbKernels    Number of kernels
+ * @return		  Scratch size in bytes
+ *
+ * @par The kernels are executed one after the other so a single buffer with
+ *      the maximum of the scratch sizes can be used by all of them
+ */
+extern uint32_t arm_cv_get_scratch_size_pipeline(const arm_cv_scratch_kernel_t *kernels, const uint32_t nbKernels);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
@@ -0,0 +1,71 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS CV Library
+ * Title:        strip.h
+ * Description:  Processing of a frame by horizontal strips
+ *
+ *
+ * Target Processor: Cortex-M
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2024 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef ARM_CV_STRIP_H
+#define ARM_CV_STRIP_H
+
+#include "arm_cv_types.h"
+
+#ifdef __cplusplus
+extern "C"
+{
+#endif
+
+// Number of rows needed above and below a strip by the strip functions
+#define ARM_CV_STRIP_RADIUS_POINTWISE 0
+#define ARM_CV_STRIP_RADIUS_3x3 1
+#define ARM_CV_STRIP_RADIUS_5x5 2
+#define ARM_CV_STRIP_RADIUS_7x7 3
+#define ARM_CV_STRIP_RADIUS_CANNY_SOBEL 2
+#define ARM_CV_STRIP_RADIUS_CANNY_GAUSSIAN_SOBEL 3
+
+/**
+ * @brief      Return the first row of the input frame needed by a strip
+ *
+ * @param[in]     strip        The position of the strip in the frame
+ * @param[in]     radius       Number of rows needed around a row, one of ARM_CV_STRIP_RADIUS_*
+ * @return		  Index in the frame of the first row of the input image
+ */
+extern uint16_t arm_cv_get_strip_first_input_row(const arm_cv_strip_t *strip, const uint16_t radius);
+
+/**
+ * @brief      Return the number of rows of the input image of a strip
+ *
+ * @param[in]     strip        The position of the strip in the frame
+ * @param[in]     nbRows       Number of rows of the output strip
+ * @param[in]     radius       Number of rows needed around a row, one of ARM_CV_STRIP_RADIUS_*
+ * @return		  Number of rows of the input image
+ *
+ * @par The rows of the frame are not duplicated at the borders, the input image of the first
+ *      strip starts at the row 0 and the input image of the last strip ends at the last row
+ */
+extern uint16_t arm_cv_get_strip_nb_input_rows(const arm_cv_strip_t *strip, const uint16_t nbRows,
+                                               const uint16_t radius);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif
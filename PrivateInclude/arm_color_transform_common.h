@@ -0,0 +1,99 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS CV Library
+ * Title:        arm_color_transform_common.h
+ * Description:  Common declarations for CMSIS-CV color transform functions
+ *
+ * Target Processor: Cortex-M
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2024 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#ifndef ARM_CV_COLOR_TRANSFORM_COMMON_H
+#define ARM_CV_COLOR_TRANSFORM_COMMON_H
+
+#include "arm_math_types.h"
+#include "arm_cv_types.h"
+
+#ifdef   __cplusplus
+extern "C"
+{
+#endif
+
+/* Conversion of a row of nbCols YUV422 pixels (nbCols even) to RGB24.
+   yOffset is the position of Y0 in a group of 4 bytes : 0 for YUYV
+   and 1 for UYVY */
+extern void arm_yuv422_row_to_rgb24(const channel_uint8_t *pIn,
+                                    const uint32_t yOffset,
+                                    const uint32_t nbCols,
+                                    channel_uint8_t *pOut);
+
+/* RGB565 pixel from 8-bit components. The low bits of the
+   components are truncated */
+__STATIC_FORCEINLINE uint16_t arm_rgb565_pack(const uint8_t r,
+                                              const uint8_t g,
+                                              const uint8_t b)
+{
+    return ((uint16_t)(((r >> 3) << 11) | ((g >> 2) << 5) | (b >> 3)));
+}
+
+/* 8-bit components of a RGB565 pixel. The high bits are replicated
+   in the low bits so that 0x1F and 0x3F give 255 */
+__STATIC_FORCEINLINE void arm_rgb565_unpack(const uint16_t p,
+                                            uint8_t *r,
+                                            uint8_t *g,
+                                            uint8_t *b)
+{
+    const uint32_t r5 = p >> 11;
+    const uint32_t g6 = (p >> 5) & 0x3F;
+    const uint32_t b5 = p & 0x1F;
+
+    *r = (uint8_t)((r5 << 3) | (r5 >> 2));
+    *g = (uint8_t)((g6 << 2) | (g6 >> 4));
+    *b = (uint8_t)((b5 << 3) | (b5 >> 2));
+}
+
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+/* Same as arm_rgb565_pack on 8 pixels with components in 16-bit lanes */
+__STATIC_FORCEINLINE uint16x8_t arm_rgb565_pack_vec(const uint16x8_t r,
+                                                    const uint16x8_t g,
+                                                    const uint16x8_t b)
+{
+    uint16x8_t p = vsliq_n_u16(vshrq_n_u16(b, 3), vshrq_n_u16(g, 2), 5);
+    return (vsliq_n_u16(p, vshrq_n_u16(r, 3), 11));
+}
+
+/* Same as arm_rgb565_unpack on 8 pixels, components in 16-bit lanes */
+__STATIC_FORCEINLINE void arm_rgb565_unpack_vec(const uint16x8_t p,
+                                                uint16x8_t *r,
+                                                uint16x8_t *g,
+                                                uint16x8_t *b)
+{
+    const uint16x8_t r5 = vshrq_n_u16(p, 11);
+    const uint16x8_t g6 = vandq_u16(vshrq_n_u16(p, 5), vdupq_n_u16(0x3F));
+    const uint16x8_t b5 = vandq_u16(p, vdupq_n_u16(0x1F));
+
+    *r = vorrq_u16(vshlq_n_u16(r5, 3), vshrq_n_u16(r5, 2));
+    *g = vorrq_u16(vshlq_n_u16(g6, 2), vshrq_n_u16(g6, 4));
+    *b = vorrq_u16(vshlq_n_u16(b5, 3), vshrq_n_u16(b5, 2));
+}
+#endif
+
+#ifdef   __cplusplus
+}
+#endif
+
+#endif
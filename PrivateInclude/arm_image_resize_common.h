@@ -28,6 +28,7 @@
 
 #include "arm_math_types.h"
 #include "arm_cv_types.h"
+#include "cv/image_transforms.h"
 
 #ifdef   __cplusplus
 extern "C"
@@ -40,6 +41,9 @@ typedef struct {
 
     int output_w;
     int output_h;
+
+    int input_stride;
+    int output_stride;
  
     channel_uint8_t *pIn;
     channel_uint8_t *pOut;
@@ -52,6 +56,70 @@ typedef struct {
 extern void arm_image_resize_common_f32(const _common_resize_t *common,
                                         uint8_t *p_img);
 
+typedef struct {
+    int input_w;
+    int input_h;
+
+    int output_w;
+    int output_h;
+
+    int input_stride;
+    int output_stride;
+
+    /* number of interleaved channels of a pixel */
+    int nb_channels;
+
+    channel_uint8_t *pIn;
+    channel_uint8_t *pOut;
+
+    /* q16.16 step between two output pixels in the input image */
+    uint32_t w_scale;
+    uint32_t h_scale;
+
+    /* precomputed positions, NULL when they are computed for each row */
+    const arm_image_resize_plan_t *plan;
+
+} _common_resize_fixp_t;
+
+/* Position in the input of the output pixel i : the two input pixels
+   around it and the q8 weight of the second one */
+__STATIC_FORCEINLINE void arm_image_resize_pos_fixp(const uint32_t i,
+                                                    const uint32_t scale,
+                                                    const uint32_t last,
+                                                    uint32_t *idx,
+                                                    uint32_t *idx1,
+                                                    uint32_t *weight)
+{
+    uint32_t s = i * scale + 128;
+    *idx = s >> 16;
+    *idx1 = (*idx < last) ? *idx + 1 : last;
+    *weight = (s >> 8) & 0xFF;
+}
+
+extern void arm_image_resize_common_init_fixp(_common_resize_fixp_t *common);
+
+extern void arm_image_resize_common_fixp(const _common_resize_fixp_t *common,
+                                         uint16_t *p_lines);
+
+/* State to produce the output rows one by one in increasing order.
+   pLine0 and pLine1 are the horizontally interpolated input rows
+   row0 and row1 (-1 when not computed yet) */
+typedef struct {
+    const _common_resize_fixp_t *common;
+    uint16_t *pLine0;
+    uint16_t *pLine1;
+    int row0;
+    int row1;
+} _resize_fixp_rows_t;
+
+extern void arm_image_resize_rows_init_fixp(_resize_fixp_rows_t *rows,
+                                            const _common_resize_fixp_t *common,
+                                            uint16_t *p_lines);
+
+extern void arm_image_resize_output_row_fixp(_resize_fixp_rows_t *rows,
+                                             const int r,
+                                             channel_uint8_t *pOut);
+
 __STATIC_FORCEINLINE float get_image_pixel(uint8_t* m, int x, int y, int w)
 {
     return m[y * w + x];
@@ -508,6 +508,37 @@ extern "C"
     }
 
 #endif
+
+// Give the index of the pixel to read for a position which may be outside of the image, respecting the border type.
+// It is used by the filters whose kernel size is only known at runtime and can't rely on the offset tables above.
+//  index Position of the pixel, may be negative or greater than dim - 1
+//  dim Size of the image along the treated axis
+//  borderType Define the border type to use
+__STATIC_FORCEINLINE int arm_cv_border_index(int index, const int dim, const int8_t borderType)
+{
+    // Loop since a kernel radius may be bigger than the image dimension
+    while ((index < 0) || (index >= dim))
+    {
+        switch (borderType)
+        {
+        case ARM_CV_BORDER_WRAP:
+            index = (index < 0) ? index + dim : index - dim;
+            break;
+        case ARM_CV_BORDER_REFLECT:
+            index = (index < 0) ? -index : 2 * (dim - 1) - index;
+            if (dim == 1)
+            {
+                index = 0;
+            }
+            break;
+        default:
+            index = (index < 0) ? 0 : dim - 1;
+            break;
+        }
+    }
+    return (index);
+}
+
 #ifdef __cplusplus
 }
 #endif
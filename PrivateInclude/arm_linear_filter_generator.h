@@ -26,6 +26,7 @@
 
 #ifndef ARM_CV_LINEAR_FILTER_COMMON_SCRATCH_C
 #define ARM_CV_LINEAR_FILTER_COMMON_SCRATCH_C
+#include <assert.h>
 #include "arm_linear_filter_common.h"
 
 #if ARM_CV_LINEAR_OUTPUT_TYPE == ARM_CV_LINEAR_OUTPUT_UINT_8
@@ -75,8 +76,9 @@
 // dataIn Pointer to the memory where the input value is stored
 #define _ARM_VERTICAL_ATTRIBUTION(indexOut, indexIn, offset, dataOut, dataIn)                                          \
     dataOut[indexOut] = VERTICAL_COMPUTE_SCALAR(                                                                       \
-        dataIn[indexIn + offset[0] * width], dataIn[indexIn + offset[1] * width], dataIn[indexIn + offset[2] * width], \
-        dataIn[indexIn + offset[3] * width], dataIn[indexIn + offset[4] * width]);
+        dataIn[indexIn + offset[0] * strideIn], dataIn[indexIn + offset[1] * strideIn],                                \
+        dataIn[indexIn + offset[2] * strideIn], dataIn[indexIn + offset[3] * strideIn],                                \
+        dataIn[indexIn + offset[4] * strideIn]);
 
 #if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
 
@@ -91,18 +93,18 @@
 #define _ARM_LOOP_INPUT_TO_BUFFER(width, scratch, dataIn, line, offset)                                                \
     for (int y = 0; y < width - 15; y += 16)                                                                           \
     {                                                                                                                  \
-        uint8x16_t vec1 = vld1q(&dataIn[line * width + y + offset[0] * width]);                                        \
-        uint8x16_t vec2 = vld1q(&dataIn[line * width + y + offset[1] * width]);                                        \
-        uint8x16_t vec3 = vld1q(&dataIn[line * width + y + offset[2] * width]);                                        \
-        uint8x16_t vec4 = vld1q(&dataIn[line * width + y + offset[3] * width]);                                        \
-        uint8x16_t vec5 = vld1q(&dataIn[line * width + y + offset[4] * width]);                                        \
+        uint8x16_t vec1 = vld1q(&dataIn[line * strideIn + y + offset[0] * strideIn]);                                  \
+        uint8x16_t vec2 = vld1q(&dataIn[line * strideIn + y + offset[1] * strideIn]);                                  \
+        uint8x16_t vec3 = vld1q(&dataIn[line * strideIn + y + offset[2] * strideIn]);                                  \
+        uint8x16_t vec4 = vld1q(&dataIn[line * strideIn + y + offset[3] * strideIn]);                                  \
+        uint8x16_t vec5 = vld1q(&dataIn[line * strideIn + y + offset[4] * strideIn]);                                  \
         BUFFER_TYPE_DOUBLE_VECTOR vect_res;                                                                            \
         VERTICAL_COMPUTE_VECTOR(vec1, vec2, vec3, vec4, vec5, vect_res);                                               \
         vst2q(&scratch[y], vect_res);                                                                                  \
     }                                                                                                                  \
     for (int y = width - (width % 16); y < width; y++)                                                                 \
     {                                                                                                                  \
-        _ARM_VERTICAL_ATTRIBUTION(y, line *width + y, offset, scratch, dataIn)                                         \
+        _ARM_VERTICAL_ATTRIBUTION(y, line *strideIn + y, offset, scratch, dataIn)                                      \
     }
 
 #if (ARM_CV_LINEAR_OUTPUT_TYPE == ARM_CV_LINEAR_OUTPUT_UINT_8)
@@ -125,11 +127,11 @@
         BUFFER_TYPE_DOUBLE_VECTOR vec5 = vld2q(&scratch[y + offset[4]]);                                               \
         int8x16_t vect_out;                                                                                            \
         HORIZONTAL_COMPUTE_VECTOR(vec1, vec2, vec3, vec4, vec5, vect_out)                                              \
-        vst1q((int8_t *)&dataOut[line * width + y], vect_out);                                                         \
+        vst1q((int8_t *)&dataOut[line * strideOut + y], vect_out);                                                     \
     }                                                                                                                  \
     for (int y = width - ((width - 2) % 16); y < width - 2; y++)                                                       \
     {                                                                                                                  \
-        _ARM_HORIZONTAL_ATTRIBUTION(line *width + y, y, offset, dataOut, scratch)                                      \
+        _ARM_HORIZONTAL_ATTRIBUTION(line *strideOut + y, y, offset, dataOut, scratch)                                  \
     }
 
 #else // ARM_CV_LINEAR_OUTPUT_UINT_8
@@ -151,11 +153,11 @@
         uint16x8_t vec5 = vld1q(&scratch[y + offset[4]]);                                                              \
         int16x8_t vect_out;                                                                                            \
         HORIZONTAL_COMPUTE_VECTOR(vec1, vec2, vec3, vec4, vec5, vect_out)                                              \
-        vst1q(&dataOut[line * width + y], vect_out);                                                                   \
+        vst1q(&dataOut[line * strideOut + y], vect_out);                                                               \
     }                                                                                                                  \
     for (int y = width - ((width - 1) % 8); y < width - 2; y++)                                                        \
     {                                                                                                                  \
-        HORIZONTAL_ATTRIBUTION(line *width, y, offset, dataOut, scratch)                                               \
+        HORIZONTAL_ATTRIBUTION(line *strideOut, y, offset, dataOut, scratch)                                           \
     }
 
 #endif // ARM_CV_LINEAR_OUTPUT_UINT_8
@@ -184,9 +186,10 @@
 // dataIn Pointer to the memory where the input value is stored
 #define _ARM_VERTICAL_ATTRIBUTION(indexOut, indexIn, offset, dataOut, dataIn)                                          \
     dataOut[indexOut] = VERTICAL_COMPUTE_SCALAR(                                                                       \
-        dataIn[indexIn + offset[0] * width], dataIn[indexIn + offset[1] * width], dataIn[indexIn + offset[2] * width], \
-        dataIn[indexIn + offset[3] * width], dataIn[indexIn + offset[4] * width], dataIn[indexIn + offset[5] * width], \
-        dataIn[indexIn + offset[6] * width]);
+        dataIn[indexIn + offset[0] * strideIn], dataIn[indexIn + offset[1] * strideIn],                                \
+        dataIn[indexIn + offset[2] * strideIn], dataIn[indexIn + offset[3] * strideIn],                                \
+        dataIn[indexIn + offset[4] * strideIn], dataIn[indexIn + offset[5] * strideIn],                                \
+        dataIn[indexIn + offset[6] * strideIn]);
 
 #if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
 #if defined(BUFFER_15)
@@ -202,20 +205,20 @@
 #define _ARM_LOOP_INPUT_TO_BUFFER(width, scratch, dataIn, line, offset)                                                \
     for (int y = 0; y < width - 15; y += 16)                                                                           \
     {                                                                                                                  \
-        uint8x16_t vec1 = vld1q(&dataIn[line * width + y + offset[0] * width]);                                        \
-        uint8x16_t vec2 = vld1q(&dataIn[line * width + y + offset[1] * width]);                                        \
-        uint8x16_t vec3 = vld1q(&dataIn[line * width + y + offset[2] * width]);                                        \
-        uint8x16_t vec4 = vld1q(&dataIn[line * width + y + offset[3] * width]);                                        \
-        uint8x16_t vec5 = vld1q(&dataIn[line * width + y + offset[4] * width]);                                        \
-        uint8x16_t vec6 = vld1q(&dataIn[line * width + y + offset[5] * width]);                                        \
-        uint8x16_t vec7 = vld1q(&dataIn[line * width + y + offset[6] * width]);                                        \
+        uint8x16_t vec1 = vld1q(&dataIn[line * strideIn + y + offset[0] * strideIn]);                                  \
+        uint8x16_t vec2 = vld1q(&dataIn[line * strideIn + y + offset[1] * strideIn]);                                  \
+        uint8x16_t vec3 = vld1q(&dataIn[line * strideIn + y + offset[2] * strideIn]);                                  \
+        uint8x16_t vec4 = vld1q(&dataIn[line * strideIn + y + offset[3] * strideIn]);                                  \
+        uint8x16_t vec5 = vld1q(&dataIn[line * strideIn + y + offset[4] * strideIn]);                                  \
+        uint8x16_t vec6 = vld1q(&dataIn[line * strideIn + y + offset[5] * strideIn]);                                  \
+        uint8x16_t vec7 = vld1q(&dataIn[line * strideIn + y + offset[6] * strideIn]);                                  \
         BUFFER_TYPE_DOUBLE_VECTOR vect_res;                                                                            \
         VERTICAL_COMPUTE_VECTOR(vec1, vec2, vec3, vec4, vec5, vec6, vec7, vect_res);                                   \
         vst2q(&scratch[y], vect_res);                                                                                  \
     }                                                                                                                  \
     for (int y = width - (width % 16); y < width; y++)                                                                 \
     {                                                                                                                  \
-        _ARM_VERTICAL_ATTRIBUTION(y, line *width + y, offset, scratch, dataIn)                                         \
+        _ARM_VERTICAL_ATTRIBUTION(y, line *strideIn + y, offset, scratch, dataIn)                                      \
     }
 
 #else // BUFFER_15
@@ -231,20 +234,20 @@
 #define _ARM_LOOP_INPUT_TO_BUFFER(width, scratch, dataIn, line, offset)                                                \
     for (int y = 0; y < width - 15; y += 16)                                                                           \
     {                                                                                                                  \
-        uint8x16_t vec1 = vld1q(&dataIn[line * width + y + offset[0] * width]);                                        \
-        uint8x16_t vec2 = vld1q(&dataIn[line * width + y + offset[1] * width]);                                        \
-        uint8x16_t vec3 = vld1q(&dataIn[line * width + y + offset[2] * width]);                                        \
-        uint8x16_t vec4 = vld1q(&dataIn[line * width + y + offset[3] * width]);                                        \
-        uint8x16_t vec5 = vld1q(&dataIn[line * width + y + offset[4] * width]);                                        \
-        uint8x16_t vec6 = vld1q(&dataIn[line * width + y + offset[5] * width]);                                        \
-        uint8x16_t vec7 = vld1q(&dataIn[line * width + y + offset[6] * width]);                                        \
+        uint8x16_t vec1 = vld1q(&dataIn[line * strideIn + y + offset[0] * strideIn]);                                  \
+        uint8x16_t vec2 = vld1q(&dataIn[line * strideIn + y + offset[1] * strideIn]);                                  \
+        uint8x16_t vec3 = vld1q(&dataIn[line * strideIn + y + offset[2] * strideIn]);                                  \
+        uint8x16_t vec4 = vld1q(&dataIn[line * strideIn + y + offset[3] * strideIn]);                                  \
+        uint8x16_t vec5 = vld1q(&dataIn[line * strideIn + y + offset[4] * strideIn]);                                  \
+        uint8x16_t vec6 = vld1q(&dataIn[line * strideIn + y + offset[5] * strideIn]);                                  \
+        uint8x16_t vec7 = vld1q(&dataIn[line * strideIn + y + offset[6] * strideIn]);                                  \
         BUFFER_TYPE_DOUBLE_VECTOR vect_res;                                                                            \
         VERTICAL_COMPUTE_VECTOR(vec1, vec2, vec3, vec4, vec5, vec6, vec7, vect_res);                                   \
         vst4q(&scratch[y], vect_res);                                                                                  \
     }                                                                                                                  \
     for (int y = width - (width % 16); y < width; y++)                                                                 \
     {                                                                                                                  \
-        _ARM_VERTICAL_ATTRIBUTION(y, line *width + y, offset, scratch, dataIn)                                         \
+        _ARM_VERTICAL_ATTRIBUTION(y, line *strideIn + y, offset, scratch, dataIn)                                      \
     }
 
 #endif // BUFFER_15
@@ -273,11 +276,11 @@
         int16x8x2_t vec7 = vld2q(&scratch[y + offset[6]]);                                                             \
         int8x16_t vect_out;                                                                                            \
         HORIZONTAL_COMPUTE_VECTOR(vec1, vec2, vec3, vec4, vec5, vec6, vec7, vect_out)                                  \
-        vst1q((int8_t *)&dataOut[line * width + y], vect_out);                                                         \
+        vst1q((int8_t *)&dataOut[line * strideOut + y], vect_out);                                                     \
     }                                                                                                                  \
     for (int y = width - ((width - 3) % 16); y < width - 3; y++)                                                       \
     {                                                                                                                  \
-        _ARM_HORIZONTAL_ATTRIBUTION(line *width + y, y, offset, dataOut, scratch)                                      \
+        _ARM_HORIZONTAL_ATTRIBUTION(line *strideOut + y, y, offset, dataOut, scratch)                                  \
     }
 #else // BUFFER_15
 
@@ -301,11 +304,11 @@
         int32x4x4_t vec7 = vld4q(&scratch[y + offset[6]]);                                                             \
         int8x16_t vect_out;                                                                                            \
         HORIZONTAL_COMPUTE_VECTOR(vec1, vec2, vec3, vec4, vec5, vec6, vec7, vect_out)                                  \
-        vst1q((int8_t *)&dataOut[line * width + y], vect_out);                                                         \
+        vst1q((int8_t *)&dataOut[line * strideOut + y], vect_out);                                                     \
     }                                                                                                                  \
     for (int y = width - ((width - 3) % 16); y < width - 3; y++)                                                       \
     {                                                                                                                  \
-        _ARM_HORIZONTAL_ATTRIBUTION(line *width + y, y, offset, dataOut, scratch)                                      \
+        _ARM_HORIZONTAL_ATTRIBUTION(line *strideOut + y, y, offset, dataOut, scratch)                                  \
     }
 #endif // BUFFER_15
 
@@ -331,11 +334,11 @@
         q15x8_t vec7 = vld1q(&scratch[y + offset[6]]);                                                                 \
         q15x8_t vect_out;                                                                                              \
         _ARM_HORIZONTAL_COMPUTE_VECTOR(vec1, vec2, vec3, vec4, vec5, vec6, vec7, vect_out)                             \
-        vst1q(&dataOut[line * width + y], vect_out);                                                                   \
+        vst1q(&dataOut[line * strideOut + y], vect_out);                                                               \
     }                                                                                                                  \
     for (int y = width - ((width - 3) % 8); y < width - 3; y++)                                                        \
     {                                                                                                                  \
-        _ARM_HORIZONTAL_ATTRIBUTION(line *width, y, offset, dataOut, scratch)                                          \
+        _ARM_HORIZONTAL_ATTRIBUTION(line *strideOut, y, offset, dataOut, scratch)                                      \
     }
 
 #endif // ARM_CV_LINEAR_OUTPUT_UINT_8
@@ -360,8 +363,8 @@
 // dataIn Pointer to the memory where the input value is stored
 #define _ARM_VERTICAL_ATTRIBUTION(indexOut, indexIn, offset, dataOut, dataIn)                                          \
     dataOut[indexOut] =                                                                                                \
-        VERTICAL_COMPUTE_SCALAR(dataIn[indexIn + offset[0] * width], dataIn[indexIn + offset[1] * width],              \
-                                dataIn[indexIn + offset[2] * width]);
+        VERTICAL_COMPUTE_SCALAR(dataIn[indexIn + offset[0] * strideIn], dataIn[indexIn + offset[1] * strideIn],        \
+                                dataIn[indexIn + offset[2] * strideIn]);
 
 #if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
 // This macro is a loop applying the vertical kernel on the middle part of a line from the input image  and storing the
@@ -375,18 +378,18 @@
 #define _ARM_LOOP_INPUT_TO_BUFFER(width, scratch, dataIn, line, offset)                                                \
     for (int y = 0; y < width - 15; y += 16)                                                                           \
     {                                                                                                                  \
-        uint8x16_t vec1 = vld1q(&dataIn[line * width + y + offset[0] * width]);                                        \
-        uint8x16_t vec2 = vld1q(&dataIn[line * width + y + offset[1] * width]);                                        \
-        uint8x16_t vec3 = vld1q(&dataIn[line * width + y + offset[2] * width]);                                        \
+        uint8x16_t vec1 = vld1q(&dataIn[line * strideIn + y + offset[0] * strideIn]);                                  \
+        uint8x16_t vec2 = vld1q(&dataIn[line * strideIn + y + offset[1] * strideIn]);                                  \
+        uint8x16_t vec3 = vld1q(&dataIn[line * strideIn + y + offset[2] * strideIn]);                                  \
         int16x8x2_t vect_res;                                                                                          \
         VERTICAL_COMPUTE_VECTOR(vec1, vec2, vec3, vect_res);                                                           \
         vst2q(&scratch[y], vect_res);                                                                                  \
     }                                                                                                                  \
     for (int y = width - (width % 16); y < width; y++)                                                                 \
     {                                                                                                                  \
-        scratch[y] = VERTICAL_COMPUTE_SCALAR(dataIn[line * width + y + offset[0] * width],                             \
-                                             dataIn[line * width + y + offset[1] * width],                             \
-                                             dataIn[line * width + y + offset[2] * width]);                            \
+        scratch[y] = VERTICAL_COMPUTE_SCALAR(dataIn[line * strideIn + y + offset[0] * strideIn],                       \
+                                             dataIn[line * strideIn + y + offset[1] * strideIn],                       \
+                                             dataIn[line * strideIn + y + offset[2] * strideIn]);                      \
     }
 
 #if (ARM_CV_LINEAR_OUTPUT_TYPE == ARM_CV_LINEAR_OUTPUT_UINT_8)
@@ -407,11 +410,11 @@
         int16x8x2_t vec3 = vld2q(&scratch[y + offset[2]]);                                                             \
         int8x16_t vect_out;                                                                                            \
         HORIZONTAL_COMPUTE_VECTOR(vec1, vec2, vec3, vect_out)                                                          \
-        vst1q((int8_t *)&dataOut[line * width + y], vect_out);                                                         \
+        vst1q((int8_t *)&dataOut[line * strideOut + y], vect_out);                                                     \
     }                                                                                                                  \
     for (int y = width - ((width - 1) % 16); y < width - 1; y++)                                                       \
     {                                                                                                                  \
-        dataOut[line * width + y] =                                                                                    \
+        dataOut[line * strideOut + y] =                                                                                \
             HORIZONTAL_COMPUTE_SCALAR(scratch[y + offset[0]], scratch[y + offset[1]], scratch[y + offset[2]]);         \
     }
 
@@ -434,11 +437,11 @@
         int16x8_t vec3 = vld1q(&scratch[y + offset[2]]);                                                               \
         int16x8_t vect_out;                                                                                            \
         HORIZONTAL_COMPUTE_VECTOR(vec1, vec2, vec3, vect_out)                                                          \
-        vst1q(&dataOut[line * width + y], vect_out);                                                                   \
+        vst1q(&dataOut[line * strideOut + y], vect_out);                                                               \
     }                                                                                                                  \
     for (int y = width - ((width - 1) % 8); y < width - 1; y++)                                                        \
     {                                                                                                                  \
-        dataOut[line * width + y] =                                                                                    \
+        dataOut[line * strideOut + y] =                                                                                \
             HORIZONTAL_COMPUTE_SCALAR(scratch[y + offset[0]], scratch[y + offset[1]], scratch[y + offset[2]]);         \
     }
 
@@ -462,7 +465,7 @@
 #define _ARM_LOOP_BUFFER_TO_OUTPUT(width, scratch, dataOut, line, offset)                                              \
     for (int y = KERNEL_SIZE >> 1; y < width - (KERNEL_SIZE >> 1); y++)                                                \
     {                                                                                                                  \
-        _ARM_HORIZONTAL_ATTRIBUTION(line *width + y, y, offset, dataOut, scratch);                                     \
+        _ARM_HORIZONTAL_ATTRIBUTION(line *strideOut + y, y, offset, dataOut, scratch);                                 \
     }
 // This macro is a loop applying the vertical kernel on the middle part of a line from the input image  and storing the
 // result into the temporary buffer
@@ -475,7 +478,7 @@
 #define _ARM_LOOP_INPUT_TO_BUFFER(width, scratch, dataIn, line, offset)                                                \
     for (int y = 0; y < width; y++)                                                                                    \
     {                                                                                                                  \
-        _ARM_VERTICAL_ATTRIBUTION(y, line *width + y, offset, scratch, dataIn);                                        \
+        _ARM_VERTICAL_ATTRIBUTION(y, line *strideIn + y, offset, scratch, dataIn);                                     \
     }
 
 #endif // ARM_MATH_MVEI
@@ -486,17 +489,19 @@
 //  intermediate values dataIn Pointer to the memory containing the pixels values of the input image dataOut Pointer to
 //  the memory containing the pixels values of the output image offset Small buffer of the size of one dimension of the
 //  kernel to store the offset require to respect the border type borderType Define the border type to use line Index of
-//  the line that will be treated by the function height Height of the image
+//  the line that will be treated by the function height Height of the image strideIn Number of pixels between two rows
+//  of the input image strideOut Number of pixels between two rows of the output image
 __STATIC_INLINE void line_processing_linear(const int8_t borderLocation, const int16_t width, BUFFER_TYPE *scratch,
                                             const uint8_t *dataIn, OUTPUT_TYPE *dataOut, int *offset,
-                                            const uint8_t borderType, const uint8_t line, const uint8_t height)
+                                            const uint8_t borderType, const int line, const int height,
+                                            const int strideIn, const int strideOut)
 {
     _ARM_BORDER_OFFSET(offset, borderLocation, height, borderType);
     _ARM_LOOP_INPUT_TO_BUFFER(width, scratch, dataIn, line, offset);
     for (int y = 0; y < KERNEL_SIZE >> 1; y++)
     {
         _ARM_BORDER_OFFSET(offset, y, width, borderType);
-        _ARM_HORIZONTAL_ATTRIBUTION(line * width + y, y, offset, dataOut, scratch);
+        _ARM_HORIZONTAL_ATTRIBUTION(line * strideOut + y, y, offset, dataOut, scratch);
     }
     _ARM_BORDER_OFFSET(offset, KERNEL_SIZE >> 1, width, borderType);
 
@@ -504,8 +509,8 @@ __STATIC_INLINE void line_processing_linear(const int8_t borderLocation, const i
     for (int y = (KERNEL_SIZE >> 1) + 1; y < KERNEL_SIZE; y++)
     {
         _ARM_BORDER_OFFSET(offset, y, width, borderType);
-        _ARM_HORIZONTAL_ATTRIBUTION(line * width + width - KERNEL_SIZE + y, width - KERNEL_SIZE + y, offset, dataOut,
-                                    scratch);
+        _ARM_HORIZONTAL_ATTRIBUTION(line * strideOut + width - KERNEL_SIZE + y, width - KERNEL_SIZE + y, offset,
+                                    dataOut, scratch);
     }
 }
 
@@ -517,20 +522,63 @@ __STATIC_INLINE void line_processing_linear(const int8_t borderLocation, const i
 #define _ARM_LINEAR_GENERIC(imageIn, imageOut, scratch, borderType)                                                    \
     int width = imageOut->width;                                                                                       \
     int height = imageOut->height;                                                                                     \
+    int strideIn = ARM_CV_IMAGE_STRIDE(imageIn, 1);                                                                    \
+    int strideOut = ARM_CV_IMAGE_STRIDE(imageOut, 1);                                                                  \
     uint8_t *dataIn = imageIn->pData;                                                                                  \
     OUTPUT_TYPE *dataOut = imageOut->pData;                                                                            \
     int offset[KERNEL_SIZE];                                                                                           \
     for (int y = 0; y < KERNEL_SIZE >> 1; y++)                                                                         \
     {                                                                                                                  \
-        line_processing_linear(y, width, scratch, dataIn, dataOut, offset, borderType, y, height);                     \
+        line_processing_linear(y, width, scratch, dataIn, dataOut, offset, borderType, y, height, strideIn,            \
+                               strideOut);                                                                             \
     }                                                                                                                  \
     for (int x = KERNEL_SIZE >> 1; x < height - (KERNEL_SIZE >> 1); x++)                                               \
     {                                                                                                                  \
-        line_processing_linear((KERNEL_SIZE >> 1), width, scratch, dataIn, dataOut, offset, borderType, x, height);    \
+        line_processing_linear((KERNEL_SIZE >> 1), width, scratch, dataIn, dataOut, offset, borderType, x, height,     \
+                               strideIn, strideOut);                                                                   \
     }                                                                                                                  \
     for (int y = (KERNEL_SIZE >> 1) + 1; y < KERNEL_SIZE; y++)                                                         \
     {                                                                                                                  \
         int x = height - KERNEL_SIZE + y;                                                                              \
-        line_processing_linear(y, width, scratch, dataIn, dataOut, offset, borderType, x, height);                     \
+        line_processing_linear(y, width, scratch, dataIn, dataOut, offset, borderType, x, height, strideIn,            \
+                               strideOut);                                                                             \
+    }
+
+// This macro process the rows of a strip of the image
+//  imageIn is the pointer to the struct containing the rows of the strip and the rows around it needed by the kernel
+//  imageOut is the pointer to the struct containing the rows of the strip in the output image
+//  strip gives the height of the full image and the index of the first row of the strip
+//  The border type is only applied at the top and the bottom of the full image, so the wrap is not supported.
+//  It is a precondition of the strip functions, asserted in debug builds. Without the assert the output is left
+//  unchanged
+#define _ARM_LINEAR_GENERIC_STRIP(imageIn, imageOut, strip, scratch, borderType)                                       \
+    assert(borderType != ARM_CV_BORDER_WRAP);                                                                          \
+    if (borderType == ARM_CV_BORDER_WRAP)                                                                              \
+    {                                                                                                                  \
+        return;                                                                                                        \
+    }                                                                                                                  \
+    int width = imageOut->width;                                                                                       \
+    int height = strip->frameHeight;                                                                                   \
+    int strideIn = ARM_CV_IMAGE_STRIDE(imageIn, 1);                                                                    \
+    int strideOut = ARM_CV_IMAGE_STRIDE(imageOut, 1);                                                                  \
+    int firstRow = strip->firstRow;                                                                                    \
+    int firstRowIn = firstRow > (KERNEL_SIZE >> 1) ? firstRow - (KERNEL_SIZE >> 1) : 0;                                \
+    uint8_t *dataIn = imageIn->pData;                                                                                  \
+    OUTPUT_TYPE *dataOut = imageOut->pData;                                                                            \
+    int offset[KERNEL_SIZE];                                                                                           \
+    for (int x = firstRow; x < firstRow + imageOut->height; x++)                                                       \
+    {                                                                                                                  \
+        int borderLocation = KERNEL_SIZE >> 1;                                                                         \
+        if (x < (KERNEL_SIZE >> 1))                                                                                    \
+        {                                                                                                              \
+            borderLocation = x;                                                                                        \
+        }                                                                                                              \
+        else if (x >= height - (KERNEL_SIZE >> 1))                                                                     \
+        {                                                                                                              \
+            borderLocation = x - height + KERNEL_SIZE;                                                                 \
+        }                                                                                                              \
+        line_processing_linear(borderLocation, width, scratch, &dataIn[(x - firstRowIn) * strideIn],                   \
+                               &dataOut[(x - firstRow) * strideOut], offset, borderType, 0, height, strideIn,          \
+                               strideOut);                                                                             \
     }
 #endif
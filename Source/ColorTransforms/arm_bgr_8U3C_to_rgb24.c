@@ -24,31 +24,20 @@
  */
 #include "cv/color_transforms.h"
 
-/**
-  @ingroup colorTransform
- */
-
 #if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
 #include "arm_cv_common.h"
 #endif
-/**     
- * @brief      Unpacked BGR 8U3C to RGB24
- *
- * @param[in]  ImageIn   The input image
- * @param      ImageOut  The output image
- */
 
+// Conversion of the rows of the three planes
 #if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
-void arm_bgr_8U3C_to_rgb24(const arm_cv_image_bgr_8U3C_t* ImageIn,
-                                 arm_cv_image_rgb24_t* ImageOut)
+static void arm_bgr_8U3C_to_rgb24_planes(const channel_uint8_t *pBlue,
+                                         const channel_uint8_t *pGreen,
+                                         const channel_uint8_t *pRed,
+                                         const uint32_t nbCols,
+                                         const uint32_t nbRows,
+                                         channel_uint8_t *pOut)
 {
-    const uint32_t nb = ImageIn->height * ImageIn->width;
-
-    const channel_uint8_t *pBlue  = ImageIn->pData;
-    const channel_uint8_t *pGreen = pBlue + nb;
-    const channel_uint8_t *pRed   = pGreen + nb;
-
-    channel_uint8_t *pOut = ImageOut->pData;
+    const uint32_t nb = nbRows * nbCols;
 
     uint32_t  blkCnt;           /* loop counters */
     uint8x16_t tmp;
@@ -160,20 +149,16 @@ void arm_bgr_8U3C_to_rgb24(const arm_cv_image_bgr_8U3C_t* ImageIn,
 }
 
 #else
-void arm_bgr_8U3C_to_rgb24(const arm_cv_image_bgr_8U3C_t* ImageIn,
-                                 arm_cv_image_rgb24_t* ImageOut)
+static void arm_bgr_8U3C_to_rgb24_planes(const channel_uint8_t *pBlue,
+                                         const channel_uint8_t *pGreen,
+                                         const channel_uint8_t *pRed,
+                                         const uint32_t nbCols,
+                                         const uint32_t nbRows,
+                                         channel_uint8_t *pOut)
 {
-  const int nb = ImageIn->height * ImageIn->width;
-
-  const channel_uint8_t *pBlue  = ImageIn->pData;
-  const channel_uint8_t *pGreen = pBlue + nb;
-  const channel_uint8_t *pRed   = pGreen + nb;
-
-  channel_uint8_t *pOut = ImageOut->pData;
-
-  for(uint32_t height=0; height<ImageIn->height;height++)
+  for(uint32_t height=0; height<nbRows;height++)
   {
-     for(uint32_t width=0; width<ImageIn->width;width++)
+     for(uint32_t width=0; width<nbCols;width++)
      {
         *pOut++ = *pRed++;   // r
         *pOut++ = *pGreen++;   // g
@@ -182,4 +167,68 @@ void arm_bgr_8U3C_to_rgb24(const arm_cv_image_bgr_8U3C_t* ImageIn,
   }
 }
 
-#endif
\ No newline at end of file
+#endif
+
+// Conversion of the rows firstRow to firstRow + nbRows - 1 of the image
+static void arm_bgr_8U3C_to_rgb24_rows(const arm_cv_image_bgr_8U3C_t* ImageIn,
+                                       const uint32_t firstRow,
+                                       const uint32_t nbRows,
+                                       arm_cv_image_rgb24_t* ImageOut)
+{
+    const uint32_t strideIn = ARM_CV_IMAGE_STRIDE(ImageIn, 1);
+    const uint32_t strideOut = ARM_CV_IMAGE_STRIDE(ImageOut, 3);
+    const uint32_t planeSize = strideIn * ImageIn->height;
+    const channel_uint8_t *pBlue = ImageIn->pData + firstRow * strideIn;
+
+    if (ARM_CV_IMAGE_IS_PACKED(ImageIn, 1) && ARM_CV_IMAGE_IS_PACKED(ImageOut, 3))
+    {
+        arm_bgr_8U3C_to_rgb24_planes(pBlue, pBlue + planeSize, pBlue + 2 * planeSize,
+                                     ImageIn->width, nbRows, ImageOut->pData);
+        return;
+    }
+
+    for (uint32_t row = 0; row < nbRows; row++)
+    {
+        const channel_uint8_t *pRow = pBlue + row * strideIn;
+
+        arm_bgr_8U3C_to_rgb24_planes(pRow, pRow + planeSize, pRow + 2 * planeSize,
+                                     ImageIn->width, 1, &ImageOut->pData[row * strideOut]);
+    }
+}
+
+/**
+  @ingroup colorTransform
+ */
+
+/**     
+ * @brief      Unpacked BGR 8U3C to RGB24
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ */
+void arm_bgr_8U3C_to_rgb24(const arm_cv_image_bgr_8U3C_t* ImageIn,
+                           arm_cv_image_rgb24_t* ImageOut)
+{
+    arm_bgr_8U3C_to_rgb24_rows(ImageIn, 0, ImageIn->height, ImageOut);
+}
+
+/**
+  @ingroup colorTransform
+ */
+
+/**     
+ * @brief      Unpacked BGR 8U3C to RGB24 on a strip of the image
+ *
+ * @param[in]  ImageIn   The full input image
+ * @param      ImageOut  The rows of the strip in the output image
+ * @param[in]  strip     The position of the strip in the image
+ *
+ * @par The planes of the input image are not contiguous in a strip so ImageIn is
+ *      the full image. Only the rows of the strip are read.
+ */
+void arm_bgr_8U3C_to_rgb24_strip(const arm_cv_image_bgr_8U3C_t* ImageIn,
+                                 arm_cv_image_rgb24_t* ImageOut,
+                                 const arm_cv_strip_t* strip)
+{
+    arm_bgr_8U3C_to_rgb24_rows(ImageIn, strip->firstRow, ImageOut->height, ImageOut);
+}
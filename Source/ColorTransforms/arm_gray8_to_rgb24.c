@@ -24,36 +24,21 @@
  */
 #include "cv/color_transforms.h"
 
-/**
-  @ingroup colorTransform
- */
-
 #if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
 #include "arm_cv_common.h"
 #endif
 
-/**     
- * @brief      Grayscale to RGB24
- *
- * @param[in]  ImageIn   The input image
- * @param      ImageOut  The output image
- */
-
 #if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
-void arm_gray8_to_rgb24(const arm_cv_image_gray8_t* ImageIn,
-                              arm_cv_image_rgb24_t* ImageOut)
+static void arm_gray8_to_rgb24_pixels(const uint8_t *pIn,
+                                      uint8_t *pOut,
+                                      const uint32_t nb)
 {
-  
-    const uint8_t *pIn = (const uint8_t *)ImageIn->pData;
-    uint8_t *pOut = (uint8_t*)ImageOut->pData;
-
     uint32_t  blkCnt;           /* loop counters */
     uint8x16_t gray;
     uint8x16_t tmp;
     int8x16_t redOffsetV;
     int8x16_t greenOffsetV;
     int8x16_t blueOffsetV;
-    const uint32_t nb = ImageIn->height * ImageIn->width;
 
     redOffsetV = vreinterpretq_u8_s8(vidupq_n_u8(0,1));
     redOffsetV = vmulq_n_s8(redOffsetV,3);
@@ -145,20 +130,46 @@ void arm_gray8_to_rgb24(const arm_cv_image_gray8_t* ImageIn,
     }
 }
 #else
+static void arm_gray8_to_rgb24_pixels(const uint8_t *pIn,
+                                      uint8_t *pOut,
+                                      const uint32_t nb)
+{
+  for(uint32_t i=0; i<nb;i++)
+  {
+     *pOut++ = *pIn;   // r
+     *pOut++ = *pIn;   // g
+     *pOut++ = *pIn++; // b
+  }
+}
+#endif
+
+/**
+  @ingroup colorTransform
+ */
+
+/**     
+ * @brief      Grayscale to RGB24
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ */
 void arm_gray8_to_rgb24(const arm_cv_image_gray8_t* ImageIn,
                               arm_cv_image_rgb24_t* ImageOut)
 {
-  const channel_uint8_t *pIn = ImageIn->pData;
-  channel_uint8_t *pOut = ImageOut->pData;
+    const uint32_t strideIn = ARM_CV_IMAGE_STRIDE(ImageIn, 1);
+    const uint32_t strideOut = ARM_CV_IMAGE_STRIDE(ImageOut, 3);
 
-  for(uint32_t height=0; height<ImageIn->height;height++)
-  {
-     for(uint32_t width=0; width<ImageIn->width;width++)
-     {
-        *pOut++ = *pIn;   // r
-        *pOut++ = *pIn;   // g
-        *pOut++ = *pIn++; // b
-     }
-  }
+    if (ARM_CV_IMAGE_IS_PACKED(ImageIn, 1) && ARM_CV_IMAGE_IS_PACKED(ImageOut, 3))
+    {
+        arm_gray8_to_rgb24_pixels(ImageIn->pData, ImageOut->pData,
+                                  ImageIn->height * ImageIn->width);
+        return;
+    }
+
+    for (uint32_t row = 0; row < ImageIn->height; row++)
+    {
+        arm_gray8_to_rgb24_pixels(&ImageIn->pData[row * strideIn],
+                                  &ImageOut->pData[row * strideOut],
+                                  ImageIn->width);
+    }
 }
-#endif
\ No newline at end of file
@@ -0,0 +1,118 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS CV Library
+ * Title:        arm_gray8_to_rgb565
+ * Description:  Convertion of gray8 to rgb565
+ *
+ * Target Processor: Cortex-M
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2024 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "cv/color_transforms.h"
+#include "arm_color_transform_common.h"
+
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+static void arm_gray8_to_rgb565_pixels(const uint8_t *pIn,
+                                       uint16_t *pOut,
+                                       const uint32_t nb)
+{
+    uint32_t  blkCnt;           /* loop counters */
+    uint8x16_t gray;
+    uint16x8x2_t rgb;
+
+    /* Compute 16 outputs at a time */
+    blkCnt = nb >> 4;
+    while (blkCnt > 0U)
+    {
+        gray = vld1q(pIn);
+
+        /* Even and odd pixels are widened separately and
+           interleaved again by the store */
+        rgb.val[0] = vmovlbq_u8(gray);
+        rgb.val[0] = arm_rgb565_pack_vec(rgb.val[0], rgb.val[0], rgb.val[0]);
+        rgb.val[1] = vmovltq_u8(gray);
+        rgb.val[1] = arm_rgb565_pack_vec(rgb.val[1], rgb.val[1], rgb.val[1]);
+        vst2q(pOut, rgb);
+
+        /*
+         * Decrement the blockSize loop counter
+         */
+        blkCnt--;
+        /*
+         * advance vector source and destination pointers
+         */
+        pIn += 16;
+        pOut += 16;
+    }
+    /*
+     * tail
+     */
+    blkCnt = nb & 0xF;
+    while (blkCnt > 0U)
+    {
+        *pOut++ = arm_rgb565_pack(*pIn, *pIn, *pIn);
+        pIn++;
+        blkCnt--;
+    }
+}
+#else
+static void arm_gray8_to_rgb565_pixels(const uint8_t *pIn,
+                                       uint16_t *pOut,
+                                       const uint32_t nb)
+{
+  for(uint32_t i=0; i<nb;i++)
+  {
+     *pOut++ = arm_rgb565_pack(*pIn, *pIn, *pIn);
+     pIn++;
+  }
+}
+#endif
+
+/**
+  @ingroup colorTransform
+ */
+
+/**     
+ * @brief      Grayscale to RGB565
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ *
+ * @par Conversion
+ *      The 5 or 6 high bits of the gray value are kept
+ *      for each component
+ */
+void arm_gray8_to_rgb565(const arm_cv_image_gray8_t* ImageIn,
+                               arm_cv_image_rgb565_t* ImageOut)
+{
+    const uint32_t strideIn = ARM_CV_IMAGE_STRIDE(ImageIn, 1);
+    const uint32_t strideOut = ARM_CV_IMAGE_STRIDE(ImageOut, 1);
+
+    if (ARM_CV_IMAGE_IS_PACKED(ImageIn, 1) && ARM_CV_IMAGE_IS_PACKED(ImageOut, 1))
+    {
+        arm_gray8_to_rgb565_pixels(ImageIn->pData, ImageOut->pData,
+                                   ImageIn->height * ImageIn->width);
+        return;
+    }
+
+    for (uint32_t row = 0; row < ImageIn->height; row++)
+    {
+        arm_gray8_to_rgb565_pixels(&ImageIn->pData[row * strideIn],
+                                   &ImageOut->pData[row * strideOut],
+                                   ImageIn->width);
+    }
+}
@@ -0,0 +1,714 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS CV Library
+ * Title:        arm_image_to_tensor
+ * Description:  Conversion of images to normalized network input tensors
+ *
+ * Target Processor: Cortex-M
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2024 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cv/color_transforms.h"
+#include "arm_color_transform_common.h"
+
+/*
+
+A channel of the tensor only depends on the same channel of the input
+pixel. The normalization and the quantization are thus computed once
+for the 256 possible values of each channel when the plan is
+initialized, and converting an image is a table lookup per element
+written directly at its place in the tensor.
+
+*/
+
+// Lookup of one row of a channel.
+// The input pixels are inStep bytes apart, the output elements outStep
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+static void arm_tensor_row_u8(const channel_uint8_t *pIn,
+                              const uint32_t inStep,
+                              const uint8_t *pLut,
+                              uint8_t *pOut,
+                              const uint32_t outStep,
+                              const int nb)
+{
+    const uint8x16_t vInOffset = vmulq_n_u8(vidupq_n_u8(0, 1), (uint8_t)inStep);
+    const uint8x16_t vOutOffset = vmulq_n_u8(vidupq_n_u8(0, 1), (uint8_t)outStep);
+
+    for (int c = 0; c < nb; c += 16)
+    {
+        mve_pred16_t p = vctp8q((uint32_t)(nb - c));
+        uint8x16_t v;
+        if (inStep == 1)
+        {
+            v = vldrbq_z_u8(&pIn[c], p);
+        }
+        else
+        {
+            v = vldrbq_gather_offset_z_u8(&pIn[c * inStep], vInOffset, p);
+        }
+
+        v = vldrbq_gather_offset_z_u8(pLut, v, p);
+
+        if (outStep == 1)
+        {
+            vstrbq_p_u8(&pOut[c], v, p);
+        }
+        else
+        {
+            vstrbq_scatter_offset_p_u8(&pOut[c * outStep], vOutOffset, v, p);
+        }
+    }
+}
+#else
+static void arm_tensor_row_u8(const channel_uint8_t *pIn,
+                              const uint32_t inStep,
+                              const uint8_t *pLut,
+                              uint8_t *pOut,
+                              const uint32_t outStep,
+                              const int nb)
+{
+    for (int c = 0; c < nb; c++)
+    {
+        *pOut = pLut[*pIn];
+        pIn += inStep;
+        pOut += outStep;
+    }
+}
+#endif
+
+#if defined(ARM_MATH_MVEF) && !defined(ARM_MATH_AUTOVECTORIZE)
+static void arm_tensor_row_f32(const channel_uint8_t *pIn,
+                               const uint32_t inStep,
+                               const float32_t *pLut,
+                               float32_t *pOut,
+                               const uint32_t outStep,
+                               const int nb)
+{
+    const uint32x4_t vInOffset = vmulq_n_u32(vidupq_n_u32(0, 1), inStep);
+    const uint32x4_t vOutOffset = vmulq_n_u32(vidupq_n_u32(0, 1), outStep);
+
+    for (int c = 0; c < nb; c += 4)
+    {
+        mve_pred16_t p = vctp32q((uint32_t)(nb - c));
+        uint32x4_t vIdx = vldrbq_gather_offset_z_u32(&pIn[c * inStep], vInOffset, p);
+        float32x4_t v = vldrwq_gather_shifted_offset_z_f32(pLut, vIdx, p);
+        vstrwq_scatter_shifted_offset_p_f32(&pOut[c * outStep], vOutOffset, v, p);
+    }
+}
+#else
+static void arm_tensor_row_f32(const channel_uint8_t *pIn,
+                               const uint32_t inStep,
+                               const float32_t *pLut,
+                               float32_t *pOut,
+                               const uint32_t outStep,
+                               const int nb)
+{
+    for (int c = 0; c < nb; c++)
+    {
+        *pOut = pLut[*pIn];
+        pIn += inStep;
+        pOut += outStep;
+    }
+}
+#endif
+
+/* Position of the channel k of the row r in the tensor and distance
+   between two consecutive elements of this channel */
+static uint32_t arm_tensor_row_offset(const arm_cv_tensor_layout_t layout,
+                                      const int width,
+                                      const int height,
+                                      const int nbChannels,
+                                      const int r,
+                                      const int k,
+                                      uint32_t *pOutStep)
+{
+    if (layout == ARM_CV_TENSOR_NCHW)
+    {
+        *pOutStep = 1;
+        return ((uint32_t)(k * height + r) * width);
+    }
+    *pOutStep = nbChannels;
+    return ((uint32_t)r * width * nbChannels + k);
+}
+
+/* Row r of the image, pChannels are the first pixels of each channel
+   of this row in the order of the channels of the tensor */
+static void arm_image_row_to_tensor_u8(const channel_uint8_t *const *pChannels,
+                                       const uint32_t pixelStep,
+                                       const int width,
+                                       const int height,
+                                       const int r,
+                                       const arm_cv_tensor_layout_t layout,
+                                       const int nbChannels,
+                                       const uint8_t *pLut,
+                                       uint8_t *pTensor)
+{
+    for (int k = 0; k < nbChannels; k++)
+    {
+        uint32_t outStep;
+        uint32_t offset = arm_tensor_row_offset(layout, width, height, nbChannels, r, k, &outStep);
+        arm_tensor_row_u8(pChannels[k], pixelStep,
+                          pLut + k * ARM_CV_TENSOR_LUT_LENGTH,
+                          pTensor + offset, outStep, width);
+    }
+}
+
+/* pChannels are the first pixels of each channel of the image, in the
+   order of the channels of the tensor */
+static void arm_image_to_tensor_u8(const channel_uint8_t *const *pChannels,
+                                   const uint32_t pixelStep,
+                                   const uint32_t stride,
+                                   const int width,
+                                   const int height,
+                                   const arm_cv_tensor_layout_t layout,
+                                   const int nbChannels,
+                                   const uint8_t *pLut,
+                                   uint8_t *pTensor)
+{
+    const channel_uint8_t *pRow[3];
+
+    for (int r = 0; r < height; r++)
+    {
+        for (int k = 0; k < nbChannels; k++)
+        {
+            pRow[k] = pChannels[k] + r * stride;
+        }
+        arm_image_row_to_tensor_u8(pRow, pixelStep, width, height, r, layout,
+                                   nbChannels, pLut, pTensor);
+    }
+}
+
+/* Row r of the image, pChannels are the first pixels of each channel
+   of this row in the order of the channels of the tensor */
+static void arm_image_row_to_tensor_f32(const channel_uint8_t *const *pChannels,
+                                        const uint32_t pixelStep,
+                                        const int width,
+                                        const int height,
+                                        const int r,
+                                        const arm_cv_tensor_layout_t layout,
+                                        const int nbChannels,
+                                        const float32_t *pLut,
+                                        float32_t *pTensor)
+{
+    for (int k = 0; k < nbChannels; k++)
+    {
+        uint32_t outStep;
+        uint32_t offset = arm_tensor_row_offset(layout, width, height, nbChannels, r, k, &outStep);
+        arm_tensor_row_f32(pChannels[k], pixelStep,
+                           pLut + k * ARM_CV_TENSOR_LUT_LENGTH,
+                           pTensor + offset, outStep, width);
+    }
+}
+
+static void arm_image_to_tensor_f32(const channel_uint8_t *const *pChannels,
+                                    const uint32_t pixelStep,
+                                    const uint32_t stride,
+                                    const int width,
+                                    const int height,
+                                    const arm_cv_tensor_layout_t layout,
+                                    const int nbChannels,
+                                    const float32_t *pLut,
+                                    float32_t *pTensor)
+{
+    const channel_uint8_t *pRow[3];
+
+    for (int r = 0; r < height; r++)
+    {
+        for (int k = 0; k < nbChannels; k++)
+        {
+            pRow[k] = pChannels[k] + r * stride;
+        }
+        arm_image_row_to_tensor_f32(pRow, pixelStep, width, height, r, layout,
+                                    nbChannels, pLut, pTensor);
+    }
+}
+
+/* The rows of a YUV422 image are converted to RGB24 in pScratch
+   before the lookup */
+static void arm_yuv422_to_tensor_u8(const channel_uint8_t *pIn,
+                                    const uint32_t yOffset,
+                                    const uint32_t stride,
+                                    const int width,
+                                    const int height,
+                                    const arm_cv_tensor_layout_t layout,
+                                    const uint8_t *pLut,
+                                    uint8_t *pTensor,
+                                    channel_uint8_t *pScratch)
+{
+    const channel_uint8_t *pRow[3] = {pScratch, pScratch + 1, pScratch + 2};
+
+    for (int r = 0; r < height; r++)
+    {
+        arm_yuv422_row_to_rgb24(pIn + r * stride, yOffset, width, pScratch);
+        arm_image_row_to_tensor_u8(pRow, 3, width, height, r, layout,
+                                   3, pLut, pTensor);
+    }
+}
+
+static void arm_yuv422_to_tensor_f32(const channel_uint8_t *pIn,
+                                     const uint32_t yOffset,
+                                     const uint32_t stride,
+                                     const int width,
+                                     const int height,
+                                     const arm_cv_tensor_layout_t layout,
+                                     const float32_t *pLut,
+                                     float32_t *pTensor,
+                                     channel_uint8_t *pScratch)
+{
+    const channel_uint8_t *pRow[3] = {pScratch, pScratch + 1, pScratch + 2};
+
+    for (int r = 0; r < height; r++)
+    {
+        arm_yuv422_row_to_rgb24(pIn + r * stride, yOffset, width, pScratch);
+        arm_image_row_to_tensor_f32(pRow, 3, width, height, r, layout,
+                                    3, pLut, pTensor);
+    }
+}
+
+/* Normalized and quantized value, rounded to nearest and saturated */
+static int32_t arm_tensor_quantize(const arm_cv_tensor_norm_t *norm,
+                                   const int k,
+                                   const int pixel,
+                                   const int32_t minVal,
+                                   const int32_t maxVal)
+{
+    float32_t v = ((float32_t)pixel - norm->mean[k]) * norm->scale[k] / norm->qScale;
+    int32_t q;
+
+    /* Far outside of the output range, avoid an overflow of the conversion */
+    if (v <= -1024.0f)
+    {
+        return (minVal);
+    }
+    if (v >= 1024.0f)
+    {
+        return (maxVal);
+    }
+    q = (v >= 0.0f) ? (int32_t)(v + 0.5f) : -(int32_t)(0.5f - v);
+    q = q + norm->zeroPoint;
+    return ((q < minVal) ? minVal : ((q > maxVal) ? maxVal : q));
+}
+
+/**
+  @ingroup colorTransform
+ */
+
+/**
+ * @brief      Initialize the plan of a conversion to an int8 tensor
+ *
+ * @param[out]     plan        The plan
+ * @param[in]      norm        The normalization and quantization parameters
+ * @param[in]      nbChannels  Number of channels of the tensor (1 for gray8, 3 otherwise)
+ * @param[in]      layout      Layout of the tensor
+ * @param[in,out]  pLut        Buffer of nbChannels * ARM_CV_TENSOR_LUT_LENGTH elements
+ *                             used by the plan
+ *
+ * @par  Quantization
+ *       An input value p of the channel k gives
+ *       round((p - mean[k]) * scale[k] / qScale) + zeroPoint,
+ *       saturated to the int8 range
+ */
+void arm_cv_tensor_plan_init_s8(arm_cv_tensor_plan_s8_t *plan,
+                                const arm_cv_tensor_norm_t *norm,
+                                const uint8_t nbChannels,
+                                const arm_cv_tensor_layout_t layout,
+                                int8_t *pLut)
+{
+    for (int k = 0; k < nbChannels; k++)
+    {
+        for (int p = 0; p < ARM_CV_TENSOR_LUT_LENGTH; p++)
+        {
+            pLut[k * ARM_CV_TENSOR_LUT_LENGTH + p] = (int8_t)arm_tensor_quantize(norm, k, p, -128, 127);
+        }
+    }
+    plan->nbChannels = nbChannels;
+    plan->layout = layout;
+    plan->pLut = pLut;
+}
+
+/**
+ * @brief      Initialize the plan of a conversion to an uint8 tensor
+ *
+ * @param[out]     plan        The plan
+ * @param[in]      norm        The normalization and quantization parameters
+ * @param[in]      nbChannels  Number of channels of the tensor (1 for gray8, 3 otherwise)
+ * @param[in]      layout      Layout of the tensor
+ * @param[in,out]  pLut        Buffer of nbChannels * ARM_CV_TENSOR_LUT_LENGTH elements
+ *                             used by the plan
+ *
+ * @par  Quantization
+ *       Same as arm_cv_tensor_plan_init_s8, saturated to the uint8 range
+ */
+void arm_cv_tensor_plan_init_u8(arm_cv_tensor_plan_u8_t *plan,
+                                const arm_cv_tensor_norm_t *norm,
+                                const uint8_t nbChannels,
+                                const arm_cv_tensor_layout_t layout,
+                                uint8_t *pLut)
+{
+    for (int k = 0; k < nbChannels; k++)
+    {
+        for (int p = 0; p < ARM_CV_TENSOR_LUT_LENGTH; p++)
+        {
+            pLut[k * ARM_CV_TENSOR_LUT_LENGTH + p] = (uint8_t)arm_tensor_quantize(norm, k, p, 0, 255);
+        }
+    }
+    plan->nbChannels = nbChannels;
+    plan->layout = layout;
+    plan->pLut = pLut;
+}
+
+/**
+ * @brief      Initialize the plan of a conversion to a float tensor
+ *
+ * @param[out]     plan        The plan
+ * @param[in]      norm        The normalization parameters, qScale and
+ *                             zeroPoint are not used
+ * @param[in]      nbChannels  Number of channels of the tensor (1 for gray8, 3 otherwise)
+ * @param[in]      layout      Layout of the tensor
+ * @param[in,out]  pLut        Buffer of nbChannels * ARM_CV_TENSOR_LUT_LENGTH elements
+ *                             used by the plan
+ *
+ * @par  Normalization
+ *       An input value p of the channel k gives (p - mean[k]) * scale[k]
+ */
+void arm_cv_tensor_plan_init_f32(arm_cv_tensor_plan_f32_t *plan,
+                                 const arm_cv_tensor_norm_t *norm,
+                                 const uint8_t nbChannels,
+                                 const arm_cv_tensor_layout_t layout,
+                                 float32_t *pLut)
+{
+    for (int k = 0; k < nbChannels; k++)
+    {
+        for (int p = 0; p < ARM_CV_TENSOR_LUT_LENGTH; p++)
+        {
+            pLut[k * ARM_CV_TENSOR_LUT_LENGTH + p] = ((float32_t)p - norm->mean[k]) * norm->scale[k];
+        }
+    }
+    plan->nbChannels = nbChannels;
+    plan->layout = layout;
+    plan->pLut = pLut;
+}
+
+/**
+ * @brief      RGB24 to an int8 tensor
+ *
+ * @param[in]  ImageIn   The input image
+ * @param[in]  plan      The plan, initialized for 3 channels
+ * @param      pTensor   The output tensor of width * height * 3 elements,
+ *                       channels in R, G, B order
+ */
+void arm_rgb24_to_tensor_s8(const arm_cv_image_rgb24_t* ImageIn,
+                            const arm_cv_tensor_plan_s8_t *plan,
+                            int8_t *pTensor)
+{
+    const channel_uint8_t *pChannels[3] = {ImageIn->pData,
+                                           ImageIn->pData + 1,
+                                           ImageIn->pData + 2};
+    arm_image_to_tensor_u8(pChannels, 3, ARM_CV_IMAGE_STRIDE(ImageIn, 3),
+                           ImageIn->width, ImageIn->height, plan->layout, 3,
+                           (const uint8_t *)plan->pLut, (uint8_t *)pTensor);
+}
+
+/**
+ * @brief      RGB24 to an uint8 tensor
+ *
+ * @param[in]  ImageIn   The input image
+ * @param[in]  plan      The plan, initialized for 3 channels
+ * @param      pTensor   The output tensor of width * height * 3 elements,
+ *                       channels in R, G, B order
+ */
+void arm_rgb24_to_tensor_u8(const arm_cv_image_rgb24_t* ImageIn,
+                            const arm_cv_tensor_plan_u8_t *plan,
+                            uint8_t *pTensor)
+{
+    const channel_uint8_t *pChannels[3] = {ImageIn->pData,
+                                           ImageIn->pData + 1,
+                                           ImageIn->pData + 2};
+    arm_image_to_tensor_u8(pChannels, 3, ARM_CV_IMAGE_STRIDE(ImageIn, 3),
+                           ImageIn->width, ImageIn->height, plan->layout, 3,
+                           plan->pLut, pTensor);
+}
+
+/**
+ * @brief      RGB24 to a float tensor
+ *
+ * @param[in]  ImageIn   The input image
+ * @param[in]  plan      The plan, initialized for 3 channels
+ * @param      pTensor   The output tensor of width * height * 3 elements,
+ *                       channels in R, G, B order
+ */
+void arm_rgb24_to_tensor_f32(const arm_cv_image_rgb24_t* ImageIn,
+                             const arm_cv_tensor_plan_f32_t *plan,
+                             float32_t *pTensor)
+{
+    const channel_uint8_t *pChannels[3] = {ImageIn->pData,
+                                           ImageIn->pData + 1,
+                                           ImageIn->pData + 2};
+    arm_image_to_tensor_f32(pChannels, 3, ARM_CV_IMAGE_STRIDE(ImageIn, 3),
+                            ImageIn->width, ImageIn->height, plan->layout, 3,
+                            plan->pLut, pTensor);
+}
+
+/**
+ * @brief      Unpacked BGR 8U3C to an int8 tensor
+ *
+ * @param[in]  ImageIn   The input image
+ * @param[in]  plan      The plan, initialized for 3 channels
+ * @param      pTensor   The output tensor of width * height * 3 elements,
+ *                       channels in R, G, B order
+ */
+void arm_bgr_8U3C_to_tensor_s8(const arm_cv_image_bgr_8U3C_t* ImageIn,
+                               const arm_cv_tensor_plan_s8_t *plan,
+                               int8_t *pTensor)
+{
+    const uint32_t stride = ARM_CV_IMAGE_STRIDE(ImageIn, 1);
+    const uint32_t planeSize = stride * ImageIn->height;
+    const channel_uint8_t *pChannels[3] = {ImageIn->pData + 2 * planeSize,
+                                           ImageIn->pData + planeSize,
+                                           ImageIn->pData};
+    arm_image_to_tensor_u8(pChannels, 1, stride,
+                           ImageIn->width, ImageIn->height, plan->layout, 3,
+                           (const uint8_t *)plan->pLut, (uint8_t *)pTensor);
+}
+
+/**
+ * @brief      Unpacked BGR 8U3C to an uint8 tensor
+ *
+ * @param[in]  ImageIn   The input image
+ * @param[in]  plan      The plan, initialized for 3 channels
+ * @param      pTensor   The output tensor of width * height * 3 elements,
+ *                       channels in R, G, B order
+ */
+void arm_bgr_8U3C_to_tensor_u8(const arm_cv_image_bgr_8U3C_t* ImageIn,
+                               const arm_cv_tensor_plan_u8_t *plan,
+                               uint8_t *pTensor)
+{
+    const uint32_t stride = ARM_CV_IMAGE_STRIDE(ImageIn, 1);
+    const uint32_t planeSize = stride * ImageIn->height;
+    const channel_uint8_t *pChannels[3] = {ImageIn->pData + 2 * planeSize,
+                                           ImageIn->pData + planeSize,
+                                           ImageIn->pData};
+    arm_image_to_tensor_u8(pChannels, 1, stride,
+                           ImageIn->width, ImageIn->height, plan->layout, 3,
+                           plan->pLut, pTensor);
+}
+
+/**
+ * @brief      Unpacked BGR 8U3C to a float tensor
+ *
+ * @param[in]  ImageIn   The input image
+ * @param[in]  plan      The plan, initialized for 3 channels
+ * @param      pTensor   The output tensor of width * height * 3 elements,
+ *                       channels in R, G, B order
+ */
+void arm_bgr_8U3C_to_tensor_f32(const arm_cv_image_bgr_8U3C_t* ImageIn,
+                                const arm_cv_tensor_plan_f32_t *plan,
+                                float32_t *pTensor)
+{
+    const uint32_t stride = ARM_CV_IMAGE_STRIDE(ImageIn, 1);
+    const uint32_t planeSize = stride * ImageIn->height;
+    const channel_uint8_t *pChannels[3] = {ImageIn->pData + 2 * planeSize,
+                                           ImageIn->pData + planeSize,
+                                           ImageIn->pData};
+    arm_image_to_tensor_f32(pChannels, 1, stride,
+                            ImageIn->width, ImageIn->height, plan->layout, 3,
+                            plan->pLut, pTensor);
+}
+
+/**
+ * @brief      Grayscale to an int8 tensor
+ *
+ * @param[in]  ImageIn   The input image
+ * @param[in]  plan      The plan, initialized for 1 channel
+ * @param      pTensor   The output tensor of width * height elements
+ */
+void arm_gray8_to_tensor_s8(const arm_cv_image_gray8_t* ImageIn,
+                            const arm_cv_tensor_plan_s8_t *plan,
+                            int8_t *pTensor)
+{
+    const channel_uint8_t *pChannels[1] = {ImageIn->pData};
+    arm_image_to_tensor_u8(pChannels, 1, ARM_CV_IMAGE_STRIDE(ImageIn, 1),
+                           ImageIn->width, ImageIn->height, plan->layout, 1,
+                           (const uint8_t *)plan->pLut, (uint8_t *)pTensor);
+}
+
+/**
+ * @brief      Grayscale to an uint8 tensor
+ *
+ * @param[in]  ImageIn   The input image
+ * @param[in]  plan      The plan, initialized for 1 channel
+ * @param      pTensor   The output tensor of width * height elements
+ */
+void arm_gray8_to_tensor_u8(const arm_cv_image_gray8_t* ImageIn,
+                            const arm_cv_tensor_plan_u8_t *plan,
+                            uint8_t *pTensor)
+{
+    const channel_uint8_t *pChannels[1] = {ImageIn->pData};
+    arm_image_to_tensor_u8(pChannels, 1, ARM_CV_IMAGE_STRIDE(ImageIn, 1),
+                           ImageIn->width, ImageIn->height, plan->layout, 1,
+                           plan->pLut, pTensor);
+}
+
+/**
+ * @brief      Grayscale to a float tensor
+ *
+ * @param[in]  ImageIn   The input image
+ * @param[in]  plan      The plan, initialized for 1 channel
+ * @param      pTensor   The output tensor of width * height elements
+ */
+void arm_gray8_to_tensor_f32(const arm_cv_image_gray8_t* ImageIn,
+                             const arm_cv_tensor_plan_f32_t *plan,
+                             float32_t *pTensor)
+{
+    const channel_uint8_t *pChannels[1] = {ImageIn->pData};
+    arm_image_to_tensor_f32(pChannels, 1, ARM_CV_IMAGE_STRIDE(ImageIn, 1),
+                            ImageIn->width, ImageIn->height, plan->layout, 1,
+                            plan->pLut, pTensor);
+}
+
+/**
+ * @brief      YUYV to an int8 tensor
+ *
+ * @param[in]  ImageIn   The input image
+ * @param[in]  plan      The plan, initialized for 3 channels
+ * @param      pTensor   The output tensor of width * height * 3 elements,
+ *                       channels in R, G, B order
+ * @param      pScratch  Buffer of width * 3 bytes
+ *
+ * @par  Conversion
+ *       Same conversion to RGB as arm_yuyv_to_rgb24, row by row in pScratch
+ */
+void arm_yuyv_to_tensor_s8(const arm_cv_image_yuyv_t* ImageIn,
+                           const arm_cv_tensor_plan_s8_t *plan,
+                           int8_t *pTensor,
+                           channel_uint8_t *pScratch)
+{
+    arm_yuv422_to_tensor_u8(ImageIn->pData, 0, ARM_CV_IMAGE_STRIDE(ImageIn, 2),
+                            ImageIn->width, ImageIn->height, plan->layout,
+                            (const uint8_t *)plan->pLut, (uint8_t *)pTensor, pScratch);
+}
+
+/**
+ * @brief      YUYV to an uint8 tensor
+ *
+ * @param[in]  ImageIn   The input image
+ * @param[in]  plan      The plan, initialized for 3 channels
+ * @param      pTensor   The output tensor of width * height * 3 elements,
+ *                       channels in R, G, B order
+ * @param      pScratch  Buffer of width * 3 bytes
+ *
+ * @par  Conversion
+ *       Same conversion to RGB as arm_yuyv_to_rgb24, row by row in pScratch
+ */
+void arm_yuyv_to_tensor_u8(const arm_cv_image_yuyv_t* ImageIn,
+                           const arm_cv_tensor_plan_u8_t *plan,
+                           uint8_t *pTensor,
+                           channel_uint8_t *pScratch)
+{
+    arm_yuv422_to_tensor_u8(ImageIn->pData, 0, ARM_CV_IMAGE_STRIDE(ImageIn, 2),
+                            ImageIn->width, ImageIn->height, plan->layout,
+                            plan->pLut, pTensor, pScratch);
+}
+
+/**
+ * @brief      YUYV to a float tensor
+ *
+ * @param[in]  ImageIn   The input image
+ * @param[in]  plan      The plan, initialized for 3 channels
+ * @param      pTensor   The output tensor of width * height * 3 elements,
+ *                       channels in R, G, B order
+ * @param      pScratch  Buffer of width * 3 bytes
+ *
+ * @par  Conversion
+ *       Same conversion to RGB as arm_yuyv_to_rgb24, row by row in pScratch
+ */
+void arm_yuyv_to_tensor_f32(const arm_cv_image_yuyv_t* ImageIn,
+                            const arm_cv_tensor_plan_f32_t *plan,
+                            float32_t *pTensor,
+                            channel_uint8_t *pScratch)
+{
+    arm_yuv422_to_tensor_f32(ImageIn->pData, 0, ARM_CV_IMAGE_STRIDE(ImageIn, 2),
+                             ImageIn->width, ImageIn->height, plan->layout,
+                             plan->pLut, pTensor, pScratch);
+}
+
+/**
+ * @brief      UYVY to an int8 tensor
+ *
+ * @param[in]  ImageIn   The input image
+ * @param[in]  plan      The plan, initialized for 3 channels
+ * @param      pTensor   The output tensor of width * height * 3 elements,
+ *                       channels in R, G, B order
+ * @param      pScratch  Buffer of width * 3 bytes
+ *
+ * @par  Conversion
+ *       Same conversion to RGB as arm_uyvy_to_rgb24, row by row in pScratch
+ */
+void arm_uyvy_to_tensor_s8(const arm_cv_image_uyvy_t* ImageIn,
+                           const arm_cv_tensor_plan_s8_t *plan,
+                           int8_t *pTensor,
+                           channel_uint8_t *pScratch)
+{
+    arm_yuv422_to_tensor_u8(ImageIn->pData, 1, ARM_CV_IMAGE_STRIDE(ImageIn, 2),
+                            ImageIn->width, ImageIn->height, plan->layout,
+                            (const uint8_t *)plan->pLut, (uint8_t *)pTensor, pScratch);
+}
+
+/**
+ * @brief      UYVY to an uint8 tensor
+ *
+ * @param[in]  ImageIn   The input image
+ * @param[in]  plan      The plan, initialized for 3 channels
+ * @param      pTensor   The output tensor of width * height * 3 elements,
+ *                       channels in R, G, B order
+ * @param      pScratch  Buffer of width * 3 bytes
+ *
+ * @par  Conversion
+ *       Same conversion to RGB as arm_uyvy_to_rgb24, row by row in pScratch
+ */
+void arm_uyvy_to_tensor_u8(const arm_cv_image_uyvy_t* ImageIn,
+                           const arm_cv_tensor_plan_u8_t *plan,
+                           uint8_t *pTensor,
+                           channel_uint8_t *pScratch)
+{
+    arm_yuv422_to_tensor_u8(ImageIn->pData, 1, ARM_CV_IMAGE_STRIDE(ImageIn, 2),
+                            ImageIn->width, ImageIn->height, plan->layout,
+                            plan->pLut, pTensor, pScratch);
+}
+
+/**
+ * @brief      UYVY to a float tensor
+ *
+ * @param[in]  ImageIn   The input image
+ * @param[in]  plan      The plan, initialized for 3 channels
+ * @param      pTensor   The output tensor of width * height * 3 elements,
+ *                       channels in R, G, B order
+ * @param      pScratch  Buffer of width * 3 bytes
+ *
+ * @par  Conversion
+ *       Same conversion to RGB as arm_uyvy_to_rgb24, row by row in pScratch
+ */
+void arm_uyvy_to_tensor_f32(const arm_cv_image_uyvy_t* ImageIn,
+                            const arm_cv_tensor_plan_f32_t *plan,
+                            float32_t *pTensor,
+                            channel_uint8_t *pScratch)
+{
+    arm_yuv422_to_tensor_f32(ImageIn->pData, 1, ARM_CV_IMAGE_STRIDE(ImageIn, 2),
+                             ImageIn->width, ImageIn->height, plan->layout,
+                             plan->pLut, pTensor, pScratch);
+}
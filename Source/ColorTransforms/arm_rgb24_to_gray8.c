@@ -30,33 +30,15 @@
 #define GREEN_FACTOR_Q7 75 // 0.587
 #define BLUE_FACTOR_Q7 15 // 0.114
 
-/**
-  @ingroup colorTransform
- */
-
 #if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
 #include "arm_cv_common.h"
 #endif
 
-/**     
- * @brief      RGB24 to Grayscale
- *
- * @param[in]  ImageIn   The input image
- * @param      ImageOut  The output image
- * 
- * @par  Formula used
- * 
- * \f[
- * gray = 0.299  * red + 0.587 * green + 0.114 * blue ;
- * \f]
- * 
- */
 #if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
-void arm_rgb24_to_gray8(const arm_cv_image_rgb24_t* ImageIn,
-                              arm_cv_image_gray8_t* ImageOut)
+static void arm_rgb24_to_gray8_pixels(const channel_uint8_t *pRGB,
+                                      channel_uint8_t *pOut,
+                                      const uint32_t nb)
 {
-    const channel_uint8_t *pRGB  = ImageIn->pData;
-    const uint32_t nb = ImageIn->height * ImageIn->width;
     uint32_t  blkCnt;           /* loop counters */
     int8x16_t colorOffsetV;
     int8x16_t currentOffsetV;
@@ -69,8 +51,6 @@ void arm_rgb24_to_gray8(const arm_cv_image_rgb24_t* ImageIn,
     uint16x8_t tmp;
     uint8x16_t out;
 
-    channel_uint8_t *pOut = ImageOut->pData;
-
     colorOffsetV = vreinterpretq_u8_s8(vidupq_n_u8(0,1));
     colorOffsetV = vmulq_n_s8(colorOffsetV,3);
 
@@ -188,30 +168,62 @@ void arm_rgb24_to_gray8(const arm_cv_image_rgb24_t* ImageIn,
 }
 
 #else
-void arm_rgb24_to_gray8(const arm_cv_image_rgb24_t* ImageIn,
-                              arm_cv_image_gray8_t* ImageOut)
+static void arm_rgb24_to_gray8_pixels(const channel_uint8_t *pRGB,
+                                      channel_uint8_t *pOut,
+                                      const uint32_t nb)
 {
-  const channel_uint8_t *pRGB  = ImageIn->pData;
-
-  channel_uint8_t *pOut = ImageOut->pData;
-
   uint8_t r,g,b;
   q15_t gray;
 
-  for(uint32_t height=0; height<ImageIn->height;height++)
+  for(uint32_t i=0; i<nb;i++)
   {
-     for(uint32_t width=0; width<ImageIn->width;width++)
-     {
-         r =  *pRGB++;
-         g =  *pRGB++;
-         b =  *pRGB++;
-
-         gray = (q15_t) (RED_FACTOR_Q7) * (r);
-         gray += (q15_t) (GREEN_FACTOR_Q7) * (g);
-         gray += (q15_t) (BLUE_FACTOR_Q7) * (b);
-         
-         *pOut++ = (q7_t) __USAT((gray + 0x7F)>> 7, 8);
-     }
+     r =  *pRGB++;
+     g =  *pRGB++;
+     b =  *pRGB++;
+
+     gray = (q15_t) (RED_FACTOR_Q7) * (r);
+     gray += (q15_t) (GREEN_FACTOR_Q7) * (g);
+     gray += (q15_t) (BLUE_FACTOR_Q7) * (b);
+     
+     *pOut++ = (q7_t) __USAT((gray + 0x7F)>> 7, 8);
   }
 }
-#endif
\ No newline at end of file
+#endif
+
+/**
+  @ingroup colorTransform
+ */
+
+/**     
+ * @brief      RGB24 to Grayscale
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ * 
+ * @par  Formula used
+ * 
+ * \f[
+ * gray = 0.299  * red + 0.587 * green + 0.114 * blue ;
+ * \f]
+ * 
+ */
+void arm_rgb24_to_gray8(const arm_cv_image_rgb24_t* ImageIn,
+                              arm_cv_image_gray8_t* ImageOut)
+{
+    const uint32_t strideIn = ARM_CV_IMAGE_STRIDE(ImageIn, 3);
+    const uint32_t strideOut = ARM_CV_IMAGE_STRIDE(ImageOut, 1);
+
+    if (ARM_CV_IMAGE_IS_PACKED(ImageIn, 3) && ARM_CV_IMAGE_IS_PACKED(ImageOut, 1))
+    {
+        arm_rgb24_to_gray8_pixels(ImageIn->pData, ImageOut->pData,
+                                  ImageIn->height * ImageIn->width);
+        return;
+    }
+
+    for (uint32_t row = 0; row < ImageIn->height; row++)
+    {
+        arm_rgb24_to_gray8_pixels(&ImageIn->pData[row * strideIn],
+                                  &ImageOut->pData[row * strideOut],
+                                  ImageIn->width);
+    }
+}
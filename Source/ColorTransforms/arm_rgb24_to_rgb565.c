@@ -0,0 +1,127 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS CV Library
+ * Title:        arm_rgb24_to_rgb565
+ * Description:  Convertion of rgb24 to rgb565
+ *
+ * Target Processor: Cortex-M
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2024 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "cv/color_transforms.h"
+#include "arm_color_transform_common.h"
+
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+static void arm_rgb24_to_rgb565_pixels(const uint8_t *pRGB,
+                                       uint16_t *pOut,
+                                       const uint32_t nb)
+{
+    uint32_t  blkCnt;           /* loop counters */
+    uint8x16_t colorOffsetV;
+
+    uint8x16_t redV;
+    uint8x16_t greenV;
+    uint8x16_t blueV;
+    uint16x8x2_t rgb;
+
+    colorOffsetV = vmulq_n_u8(vidupq_n_u8(0,1),3);
+
+    /* Compute 16 outputs at a time */
+    blkCnt = nb >> 4;
+    while (blkCnt > 0U)
+    {
+        redV = vldrbq_gather_offset_u8(pRGB,colorOffsetV);
+        greenV = vldrbq_gather_offset_u8(pRGB+1,colorOffsetV);
+        blueV = vldrbq_gather_offset_u8(pRGB+2,colorOffsetV);
+
+        /* Even and odd pixels are widened separately and
+           interleaved again by the store */
+        rgb.val[0] = arm_rgb565_pack_vec(vmovlbq_u8(redV),
+                                         vmovlbq_u8(greenV),
+                                         vmovlbq_u8(blueV));
+        rgb.val[1] = arm_rgb565_pack_vec(vmovltq_u8(redV),
+                                         vmovltq_u8(greenV),
+                                         vmovltq_u8(blueV));
+        vst2q(pOut, rgb);
+
+        /*
+         * Decrement the blockSize loop counter
+         */
+        blkCnt--;
+        /*
+         * advance vector source and destination pointers
+         */
+        pRGB += 3*16;
+        pOut += 16;
+    }
+    /*
+     * tail
+     */
+    blkCnt = nb & 0xF;
+    while (blkCnt > 0U)
+    {
+        *pOut++ = arm_rgb565_pack(pRGB[0], pRGB[1], pRGB[2]);
+        pRGB += 3;
+        blkCnt--;
+    }
+}
+#else
+static void arm_rgb24_to_rgb565_pixels(const uint8_t *pRGB,
+                                       uint16_t *pOut,
+                                       const uint32_t nb)
+{
+  for(uint32_t i=0; i<nb;i++)
+  {
+     *pOut++ = arm_rgb565_pack(pRGB[0], pRGB[1], pRGB[2]);
+     pRGB += 3;
+  }
+}
+#endif
+
+/**
+  @ingroup colorTransform
+ */
+
+/**     
+ * @brief      RGB24 to RGB565
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ *
+ * @par Conversion
+ *      The 5 or 6 high bits of each component are kept
+ */
+void arm_rgb24_to_rgb565(const arm_cv_image_rgb24_t* ImageIn,
+                               arm_cv_image_rgb565_t* ImageOut)
+{
+    const uint32_t strideIn = ARM_CV_IMAGE_STRIDE(ImageIn, 3);
+    const uint32_t strideOut = ARM_CV_IMAGE_STRIDE(ImageOut, 1);
+
+    if (ARM_CV_IMAGE_IS_PACKED(ImageIn, 3) && ARM_CV_IMAGE_IS_PACKED(ImageOut, 1))
+    {
+        arm_rgb24_to_rgb565_pixels(ImageIn->pData, ImageOut->pData,
+                                   ImageIn->height * ImageIn->width);
+        return;
+    }
+
+    for (uint32_t row = 0; row < ImageIn->height; row++)
+    {
+        arm_rgb24_to_rgb565_pixels(&ImageIn->pData[row * strideIn],
+                                   &ImageOut->pData[row * strideOut],
+                                   ImageIn->width);
+    }
+}
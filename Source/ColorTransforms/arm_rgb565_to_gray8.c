@@ -0,0 +1,151 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS CV Library
+ * Title:        arm_rgb565_to_gray8
+ * Description:  Convertion of rgb565 to gray8
+ *
+ * Target Processor: Cortex-M
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2024 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "cv/color_transforms.h"
+#include "arm_color_transform_common.h"
+#include "dsp/none.h"
+
+/* Same factors as arm_rgb24_to_gray8 */
+#define RED_FACTOR_Q7 38 // 0.299
+#define GREEN_FACTOR_Q7 75 // 0.587
+#define BLUE_FACTOR_Q7 15 // 0.114
+
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+__STATIC_FORCEINLINE uint16x8_t arm_rgb565_to_gray_vec(const uint16x8_t p)
+{
+    uint16x8_t redV, greenV, blueV;
+    uint16x8_t gray;
+
+    arm_rgb565_unpack_vec(p, &redV, &greenV, &blueV);
+
+    gray = vmulq_n_u16(redV, RED_FACTOR_Q7);
+    gray = vmlaq_n_u16(gray, greenV, GREEN_FACTOR_Q7);
+    gray = vmlaq_n_u16(gray, blueV, BLUE_FACTOR_Q7);
+    return (vaddq_n_u16(gray, 0x7F));
+}
+
+static void arm_rgb565_to_gray8_pixels(const uint16_t *pIn,
+                                       uint8_t *pOut,
+                                       const uint32_t nb)
+{
+    uint32_t  blkCnt;           /* loop counters */
+    uint16x8x2_t rgb;
+    uint8x16_t out;
+
+    /* Compute 16 outputs at a time */
+    blkCnt = nb >> 4;
+    while (blkCnt > 0U)
+    {
+        /* val[0] contains the even pixels and val[1] the odd ones,
+           the narrowing puts them back in order */
+        rgb = vld2q(pIn);
+
+        out = vdupq_n_u8(0);
+        out = vshrnbq_n_u16(out, arm_rgb565_to_gray_vec(rgb.val[0]), 7);
+        out = vshrntq_n_u16(out, arm_rgb565_to_gray_vec(rgb.val[1]), 7);
+        vst1q(pOut, out);
+
+        /*
+         * Decrement the blockSize loop counter
+         */
+        blkCnt--;
+        /*
+         * advance vector source and destination pointers
+         */
+        pIn += 16;
+        pOut += 16;
+    }
+    /*
+     * tail
+     */
+    blkCnt = nb & 0xF;
+    while (blkCnt > 0U)
+    {
+        uint8_t r,g,b;
+        q15_t gray;
+
+        arm_rgb565_unpack(*pIn++, &r, &g, &b);
+        gray = (q15_t) (RED_FACTOR_Q7) * (r);
+        gray += (q15_t) (GREEN_FACTOR_Q7) * (g);
+        gray += (q15_t) (BLUE_FACTOR_Q7) * (b);
+
+        *pOut++ = (q7_t) __USAT((gray + 0x7F)>> 7, 8);
+        blkCnt--;
+    }
+}
+#else
+static void arm_rgb565_to_gray8_pixels(const uint16_t *pIn,
+                                       uint8_t *pOut,
+                                       const uint32_t nb)
+{
+  uint8_t r,g,b;
+  q15_t gray;
+
+  for(uint32_t i=0; i<nb;i++)
+  {
+     arm_rgb565_unpack(*pIn++, &r, &g, &b);
+
+     gray = (q15_t) (RED_FACTOR_Q7) * (r);
+     gray += (q15_t) (GREEN_FACTOR_Q7) * (g);
+     gray += (q15_t) (BLUE_FACTOR_Q7) * (b);
+
+     *pOut++ = (q7_t) __USAT((gray + 0x7F)>> 7, 8);
+  }
+}
+#endif
+
+/**
+  @ingroup colorTransform
+ */
+
+/**     
+ * @brief      RGB565 to Grayscale
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ *
+ * @par Conversion
+ *      Same result as arm_rgb565_to_rgb24 followed by
+ *      arm_rgb24_to_gray8
+ */
+void arm_rgb565_to_gray8(const arm_cv_image_rgb565_t* ImageIn,
+                               arm_cv_image_gray8_t* ImageOut)
+{
+    const uint32_t strideIn = ARM_CV_IMAGE_STRIDE(ImageIn, 1);
+    const uint32_t strideOut = ARM_CV_IMAGE_STRIDE(ImageOut, 1);
+
+    if (ARM_CV_IMAGE_IS_PACKED(ImageIn, 1) && ARM_CV_IMAGE_IS_PACKED(ImageOut, 1))
+    {
+        arm_rgb565_to_gray8_pixels(ImageIn->pData, ImageOut->pData,
+                                   ImageIn->height * ImageIn->width);
+        return;
+    }
+
+    for (uint32_t row = 0; row < ImageIn->height; row++)
+    {
+        arm_rgb565_to_gray8_pixels(&ImageIn->pData[row * strideIn],
+                                   &ImageOut->pData[row * strideOut],
+                                   ImageIn->width);
+    }
+}
@@ -0,0 +1,130 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS CV Library
+ * Title:        arm_rgb565_to_rgb24
+ * Description:  Convertion of rgb565 to rgb24
+ *
+ * Target Processor: Cortex-M
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2024 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "cv/color_transforms.h"
+#include "arm_color_transform_common.h"
+
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+/* 16 components from the components of the even and odd pixels */
+__STATIC_FORCEINLINE uint8x16_t arm_rgb565_narrow(const uint16x8_t even,
+                                                  const uint16x8_t odd)
+{
+    uint8x16_t out = vdupq_n_u8(0);
+    out = vmovnbq_u16(out, even);
+    return (vmovntq_u16(out, odd));
+}
+
+static void arm_rgb565_to_rgb24_pixels(const uint16_t *pIn,
+                                       uint8_t *pRGB,
+                                       const uint32_t nb)
+{
+    uint32_t  blkCnt;           /* loop counters */
+    uint8x16_t colorOffsetV;
+    uint16x8x2_t rgb;
+    uint16x8_t redE, greenE, blueE;
+    uint16x8_t redO, greenO, blueO;
+
+    colorOffsetV = vmulq_n_u8(vidupq_n_u8(0,1),3);
+
+    /* Compute 16 outputs at a time */
+    blkCnt = nb >> 4;
+    while (blkCnt > 0U)
+    {
+        /* val[0] contains the even pixels and val[1] the odd ones */
+        rgb = vld2q(pIn);
+        arm_rgb565_unpack_vec(rgb.val[0], &redE, &greenE, &blueE);
+        arm_rgb565_unpack_vec(rgb.val[1], &redO, &greenO, &blueO);
+
+        vstrbq_scatter_offset_u8(pRGB, colorOffsetV, arm_rgb565_narrow(redE, redO));
+        vstrbq_scatter_offset_u8(pRGB+1, colorOffsetV, arm_rgb565_narrow(greenE, greenO));
+        vstrbq_scatter_offset_u8(pRGB+2, colorOffsetV, arm_rgb565_narrow(blueE, blueO));
+
+        /*
+         * Decrement the blockSize loop counter
+         */
+        blkCnt--;
+        /*
+         * advance vector source and destination pointers
+         */
+        pIn += 16;
+        pRGB += 3*16;
+    }
+    /*
+     * tail
+     */
+    blkCnt = nb & 0xF;
+    while (blkCnt > 0U)
+    {
+        arm_rgb565_unpack(*pIn++, &pRGB[0], &pRGB[1], &pRGB[2]);
+        pRGB += 3;
+        blkCnt--;
+    }
+}
+#else
+static void arm_rgb565_to_rgb24_pixels(const uint16_t *pIn,
+                                       uint8_t *pRGB,
+                                       const uint32_t nb)
+{
+  for(uint32_t i=0; i<nb;i++)
+  {
+     arm_rgb565_unpack(*pIn++, &pRGB[0], &pRGB[1], &pRGB[2]);
+     pRGB += 3;
+  }
+}
+#endif
+
+/**
+  @ingroup colorTransform
+ */
+
+/**     
+ * @brief      RGB565 to RGB24
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ *
+ * @par Conversion
+ *      The high bits of each component are replicated in its
+ *      low bits so that the full 8-bit range is used
+ */
+void arm_rgb565_to_rgb24(const arm_cv_image_rgb565_t* ImageIn,
+                               arm_cv_image_rgb24_t* ImageOut)
+{
+    const uint32_t strideIn = ARM_CV_IMAGE_STRIDE(ImageIn, 1);
+    const uint32_t strideOut = ARM_CV_IMAGE_STRIDE(ImageOut, 3);
+
+    if (ARM_CV_IMAGE_IS_PACKED(ImageIn, 1) && ARM_CV_IMAGE_IS_PACKED(ImageOut, 3))
+    {
+        arm_rgb565_to_rgb24_pixels(ImageIn->pData, ImageOut->pData,
+                                   ImageIn->height * ImageIn->width);
+        return;
+    }
+
+    for (uint32_t row = 0; row < ImageIn->height; row++)
+    {
+        arm_rgb565_to_rgb24_pixels(&ImageIn->pData[row * strideIn],
+                                   &ImageOut->pData[row * strideOut],
+                                   ImageIn->width);
+    }
+}
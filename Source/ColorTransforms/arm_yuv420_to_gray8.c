@@ -24,31 +24,13 @@
  */
 #include "cv/color_transforms.h"
 
-/**
-  @ingroup colorTransform
- */
-
-
-/**     
- * @brief      YUV420 to Grayscale
- *
- * @param[in]  ImageIn   The input image
- * @param      ImageOut  The output image
- * 
- * @par YUV Format
- * Y,U and V are in different planes with different dimensions
- */
-
 #if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
-void arm_yuv420_to_gray8(const arm_cv_image_yuv420_t* ImageIn,
-                               arm_cv_image_gray8_t* ImageOut)
+static void arm_yuv420_to_gray8_pixels(const uint8_t *pIn,
+                                       uint8_t *pOut,
+                                       const uint32_t nb)
 {
-    const uint8_t *pIn = (const uint8_t *)ImageIn->pData;
-    uint8_t *pOut = (uint8_t*)ImageOut->pData;
-
     uint32_t  blkCnt;           /* loop counters */
     uint8x16_t vecSrc;
-    const uint32_t nb = ImageIn->height * ImageIn->width;
 
     /* Compute 16 outputs at a time */
     blkCnt = nb >> 4;
@@ -82,18 +64,96 @@ void arm_yuv420_to_gray8(const arm_cv_image_yuv420_t* ImageIn,
     }
 }
 #else
+static void arm_yuv420_to_gray8_pixels(const uint8_t *pIn,
+                                       uint8_t *pOut,
+                                       const uint32_t nb)
+{
+  for(uint32_t i=0; i<nb;i++)
+  {
+     *pOut++ = *pIn++;
+  }
+}
+#endif
+
+// The gray image is the Y plane of the image
+static void arm_yuv_y_plane_to_gray8(const channel_uint8_t *pY,
+                                     const uint32_t width,
+                                     const uint32_t height,
+                                     const uint32_t strideIn,
+                                     arm_cv_image_gray8_t* ImageOut)
+{
+    const uint32_t strideOut = ARM_CV_IMAGE_STRIDE(ImageOut, 1);
+
+    if ((strideIn == width) && ARM_CV_IMAGE_IS_PACKED(ImageOut, 1))
+    {
+        arm_yuv420_to_gray8_pixels(pY, ImageOut->pData, height * width);
+        return;
+    }
+
+    for (uint32_t row = 0; row < height; row++)
+    {
+        arm_yuv420_to_gray8_pixels(&pY[row * strideIn],
+                                   &ImageOut->pData[row * strideOut],
+                                   width);
+    }
+}
+
+/**
+  @ingroup colorTransform
+ */
+
+/**     
+ * @brief      YUV420 to Grayscale
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ * 
+ * @par YUV Format
+ * Y,U and V are in different planes with different dimensions
+ */
 void arm_yuv420_to_gray8(const arm_cv_image_yuv420_t* ImageIn,
                                arm_cv_image_gray8_t* ImageOut)
 {
-  const channel_uint8_t *pIn = ImageIn->pData;
-  channel_uint8_t *pOut = ImageOut->pData;
+    arm_yuv_y_plane_to_gray8(ImageIn->pData, ImageIn->width, ImageIn->height,
+                             ARM_CV_IMAGE_STRIDE(ImageIn, 1), ImageOut);
+}
 
-  for(uint32_t height=0; height<ImageIn->height;height++)
-  {
-     for(uint32_t width=0; width<ImageIn->width;width++)
-     {
-         *pOut++ = *pIn++;
-     }
-  }
+/**
+  @ingroup colorTransform
+ */
+
+/**     
+ * @brief      NV12 to Grayscale
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ * 
+ * @par YUV Format
+ * Y is a plane and U,V are interleaved in a second plane
+ */
+void arm_nv12_to_gray8(const arm_cv_image_nv12_t* ImageIn,
+                             arm_cv_image_gray8_t* ImageOut)
+{
+    arm_yuv_y_plane_to_gray8(ImageIn->pData, ImageIn->width, ImageIn->height,
+                             ARM_CV_IMAGE_STRIDE(ImageIn, 1), ImageOut);
+}
+
+/**
+  @ingroup colorTransform
+ */
+
+/**     
+ * @brief      NV21 to Grayscale
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ * 
+ * @par YUV Format
+ * Y is a plane and V,U are interleaved in a second plane
+ */
+void arm_nv21_to_gray8(const arm_cv_image_nv21_t* ImageIn,
+                             arm_cv_image_gray8_t* ImageOut)
+{
+    arm_yuv_y_plane_to_gray8(ImageIn->pData, ImageIn->width, ImageIn->height,
+                             ARM_CV_IMAGE_STRIDE(ImageIn, 1), ImageOut);
 }
-#endif
\ No newline at end of file
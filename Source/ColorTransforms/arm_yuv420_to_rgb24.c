@@ -25,11 +25,6 @@
 #include "cv/color_transforms.h"
 #include "dsp/none.h"
 
-/**
-  @ingroup colorTransform
- */
-
-
 #if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
 #include "arm_cv_common.h"
 
@@ -92,37 +87,24 @@
         OUT += 16;
 #endif
 
-/**     
- * @brief      YUV420 to packed RGB24
- *
- * @param[in]  ImageIn   The input image
- * @param      ImageOut  The output image
- * 
- * @par YUV format
- * Y,U and V are in different planes with different dimensions
- *      
- * @par Details about the transform ITU-R BT.601
- *
- * \f[
- *   r = 1.16414 * (y-16) - 0.0017889 * (u-128) + 1.59579    * (v-128) \\
- *   g = 1.16414 * (y-16) - 0.391443  * (u-128) - 0.813482   * (v-128) \\
- *   b = 1.16414 * (y-16) + 2.01783   * (u-128) - 0.00124584 * (v-128) \\
- * \f]
- *
-
- */
+// Conversion of the rows of the three planes, nbRows is even.
+// stepUV is 1 for planar U and V and 2 when they are interleaved
+// (NV12 and NV21), pUPlane and pVPlane then point in the same plane
 #if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
-void arm_yuv420_to_rgb24(const arm_cv_image_yuv420_t* ImageIn,
-                               arm_cv_image_rgb24_t* ImageOut)
+static void arm_yuv420_to_rgb24_planes(const channel_uint8_t *pY,
+                                       const channel_uint8_t *pUPlane,
+                                       const channel_uint8_t *pVPlane,
+                                       const uint32_t strideY,
+                                       const uint32_t strideUV,
+                                       const uint32_t stepUV,
+                                       const uint32_t nbCols,
+                                       const uint32_t nbRows,
+                                       channel_uint8_t *pOut,
+                                       const uint32_t strideOut)
 {
   static const int8_t dup_bottom[16]={0,0,1,1,2,2,3,3,4,4,5,5,6,6,7,7};
   static const int8_t dup_top[16]={8,8,9,9,10,10,11,11,12,12,13,13,14,14,15,15};
 
-  const uint32_t nb = ImageIn->width * ImageIn->height; 
-  const channel_uint8_t *pYE = ImageIn->pData;
-  const channel_uint8_t *pYO = ImageIn->pData + ImageIn->width;
-  const channel_uint8_t *pU = pYE + nb;
-  const channel_uint8_t *pV = pU + (nb>>2);
   uint32_t  blkCnt;  
 
   int8x16_t redOffsetV;
@@ -140,25 +122,42 @@ void arm_yuv420_to_rgb24(const arm_cv_image_yuv420_t* ImageIn,
   blueOffsetV = vmulq_n_s8(blueOffsetV,3);
   blueOffsetV = vaddq_n_s8(blueOffsetV,2);
 
-  channel_uint8_t *pOutE = ImageOut->pData ;
-  channel_uint8_t *pOutO = ImageOut->pData + 3*ImageIn->width;
 
-  for(uint32_t height=0; height<ImageIn->height;height+=2)
+  for(uint32_t height=0; height<nbRows;height+=2)
   {
-     blkCnt = ImageIn->width >> 5;
+     const channel_uint8_t *pYE = pY + height * strideY;
+     const channel_uint8_t *pYO = pYE + strideY;
+     const channel_uint8_t *pU = pUPlane + (height >> 1) * strideUV;
+     const channel_uint8_t *pV = pVPlane + (height >> 1) * strideUV;
+     channel_uint8_t *pOutE = pOut + height * strideOut;
+     channel_uint8_t *pOutO = pOutE + strideOut;
+
+     blkCnt = nbCols >> 5;
      while (blkCnt > 0U)
      {
         int32x4_t tmp0;
 
         uint8x16_t y ;
-        uint8x16_t ru   = vld1q(pU);
-        uint8x16_t rv   = vld1q(pV);
+        uint8x16_t ru;
+        uint8x16_t rv;
 
         uint8x16_t u,v;
 
+        if (stepUV == 2)
+        {
+           // De-interleave 16 U and 16 V
+           uint8x16x2_t uv = vld2q((pU < pV) ? pU : pV);
+           ru = (pU < pV) ? uv.val[0] : uv.val[1];
+           rv = (pU < pV) ? uv.val[1] : uv.val[0];
+        }
+        else
+        {
+           ru = vld1q(pU);
+           rv = vld1q(pV);
+        }
         
-        pU += 16;
-        pV += 16;
+        pU += 16 * stepUV;
+        pV += 16 * stepUV;
 
 
         uint8x16_t redV;
@@ -276,7 +275,7 @@ void arm_yuv420_to_rgb24(const arm_cv_image_yuv420_t* ImageIn,
         blkCnt--;
 
      }
-     blkCnt = ImageIn->width & 0x1F;
+     blkCnt = nbCols & 0x1F;
      for(uint32_t width=0; width<blkCnt;width+=2)
      {
         int32_t tmp;
@@ -284,8 +283,10 @@ void arm_yuv420_to_rgb24(const arm_cv_image_yuv420_t* ImageIn,
         int16_t y01 = (int16_t)(*pYE++) - 16;
         int16_t y10 = (int16_t)(*pYO++) - 16;
         int16_t y11 = (int16_t)(*pYO++) - 16;
-        int16_t u   = (int16_t)(*pU++) - 128;
-        int16_t v   = (int16_t)(*pV++) - 128;
+        int16_t u   = (int16_t)(*pU) - 128;
+        int16_t v   = (int16_t)(*pV) - 128;
+        pU += stepUV;
+        pV += stepUV;
 
         //float r = 1.16414f * y00 - 0.0017889f * u + 1.59579f * v;
         //float g = 1.16414f * y00 - 0.391443f  * u - 0.813482f * v;
@@ -394,38 +395,42 @@ void arm_yuv420_to_rgb24(const arm_cv_image_yuv420_t* ImageIn,
 
 
      }
-
-     pYE += ImageIn->width;
-     pYO += ImageIn->width;
-
-     pOutE += 3*ImageIn->width;
-     pOutO += 3*ImageIn->width;
   }
 }
 #else
-void arm_yuv420_to_rgb24(const arm_cv_image_yuv420_t* ImageIn,
-                               arm_cv_image_rgb24_t* ImageOut)
+static void arm_yuv420_to_rgb24_planes(const channel_uint8_t *pY,
+                                       const channel_uint8_t *pUPlane,
+                                       const channel_uint8_t *pVPlane,
+                                       const uint32_t strideY,
+                                       const uint32_t strideUV,
+                                       const uint32_t stepUV,
+                                       const uint32_t nbCols,
+                                       const uint32_t nbRows,
+                                       channel_uint8_t *pOut,
+                                       const uint32_t strideOut)
 {
-  const uint32_t nb = ImageIn->width * ImageIn->height; 
-  const channel_uint8_t *pYE = ImageIn->pData;
-  const channel_uint8_t *pYO = ImageIn->pData + ImageIn->width;
-  const channel_uint8_t *pU = pYE + nb;
-  const channel_uint8_t *pV = pU + (nb>>2);
   
-  channel_uint8_t *pOutE = ImageOut->pData ;
-  channel_uint8_t *pOutO = ImageOut->pData + 3*ImageIn->width;
 
-  for(uint32_t height=0; height<ImageIn->height;height+=2)
+  for(uint32_t height=0; height<nbRows;height+=2)
   {
-     for(uint32_t width=0; width<ImageIn->width;width+=2)
+     const channel_uint8_t *pYE = pY + height * strideY;
+     const channel_uint8_t *pYO = pYE + strideY;
+     const channel_uint8_t *pU = pUPlane + (height >> 1) * strideUV;
+     const channel_uint8_t *pV = pVPlane + (height >> 1) * strideUV;
+     channel_uint8_t *pOutE = pOut + height * strideOut;
+     channel_uint8_t *pOutO = pOutE + strideOut;
+
+     for(uint32_t width=0; width<nbCols;width+=2)
      {
         int32_t tmp;
         int16_t y00 = (int16_t)(*pYE++) - 16;
         int16_t y01 = (int16_t)(*pYE++) - 16;
         int16_t y10 = (int16_t)(*pYO++) - 16;
         int16_t y11 = (int16_t)(*pYO++) - 16;
-        int16_t u   = (int16_t)(*pU++) - 128;
-        int16_t v   = (int16_t)(*pV++) - 128;
+        int16_t u   = (int16_t)(*pU) - 128;
+        int16_t v   = (int16_t)(*pV) - 128;
+        pU += stepUV;
+        pV += stepUV;
 
         //float r = 1.16414f * y00 - 0.0017889f * u + 1.59579f * v;
         //float g = 1.16414f * y00 - 0.391443f  * u - 0.813482f * v;
@@ -534,11 +539,124 @@ void arm_yuv420_to_rgb24(const arm_cv_image_yuv420_t* ImageIn,
 
 
      }
-     pYE += ImageIn->width;
-     pYO += ImageIn->width;
-
-     pOutE += 3*ImageIn->width;
-     pOutO += 3*ImageIn->width;
   }
 }
-#endif
\ No newline at end of file
+#endif
+
+/**
+  @ingroup colorTransform
+ */
+
+/**     
+ * @brief      YUV420 to packed RGB24
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ * 
+ * @par YUV format
+ * Y,U and V are in different planes with different dimensions
+ *      
+ * @par Details about the transform ITU-R BT.601
+ *
+ * \f[
+ *   r = 1.16414 * (y-16) - 0.0017889 * (u-128) + 1.59579    * (v-128) \\
+ *   g = 1.16414 * (y-16) - 0.391443  * (u-128) - 0.813482   * (v-128) \\
+ *   b = 1.16414 * (y-16) + 2.01783   * (u-128) - 0.00124584 * (v-128) \\
+ * \f]
+ *
+
+ */
+void arm_yuv420_to_rgb24(const arm_cv_image_yuv420_t* ImageIn,
+                         arm_cv_image_rgb24_t* ImageOut)
+{
+  const uint32_t strideY = ARM_CV_IMAGE_STRIDE(ImageIn, 1);
+  const uint32_t strideUV = strideY >> 1;
+  const channel_uint8_t *pU = ImageIn->pData + strideY * ImageIn->height;
+  const channel_uint8_t *pV = pU + strideUV * (ImageIn->height >> 1);
+
+  arm_yuv420_to_rgb24_planes(ImageIn->pData, pU, pV, strideY, strideUV, 1, ImageIn->width, ImageIn->height,
+                             ImageOut->pData, ARM_CV_IMAGE_STRIDE(ImageOut, 3));
+}
+
+/**
+  @ingroup colorTransform
+ */
+
+/**     
+ * @brief      YUV420 to packed RGB24 on a strip of the image
+ *
+ * @param[in]  ImageIn   The full input image
+ * @param      ImageOut  The rows of the strip in the output image
+ * @param[in]  strip     The position of the strip in the image
+ *
+ * @par The planes of the input image are not contiguous in a strip so ImageIn is
+ *      the full image. Only the rows of the strip are read.
+ *      The first row and the number of rows of the strip are even since
+ *      U and V are shared by two rows.
+ */
+void arm_yuv420_to_rgb24_strip(const arm_cv_image_yuv420_t* ImageIn,
+                               arm_cv_image_rgb24_t* ImageOut,
+                               const arm_cv_strip_t* strip)
+{
+  const uint32_t strideY = ARM_CV_IMAGE_STRIDE(ImageIn, 1);
+  const uint32_t strideUV = strideY >> 1;
+  const uint32_t offsetUV = (strip->firstRow >> 1) * strideUV;
+  const channel_uint8_t *pU = ImageIn->pData + strideY * ImageIn->height;
+  const channel_uint8_t *pV = pU + strideUV * (ImageIn->height >> 1);
+
+  arm_yuv420_to_rgb24_planes(ImageIn->pData + strip->firstRow * strideY, pU + offsetUV, pV + offsetUV,
+                             strideY, strideUV, 1, ImageIn->width, ImageOut->height,
+                             ImageOut->pData, ARM_CV_IMAGE_STRIDE(ImageOut, 3));
+}
+
+/**
+  @ingroup colorTransform
+ */
+
+/**     
+ * @brief      NV12 to packed RGB24
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ * 
+ * @par YUV format
+ * Y is a plane and U,V are interleaved in a second plane
+ *      
+ * @par Details about the transform
+ *      Same as arm_yuv420_to_rgb24
+ */
+void arm_nv12_to_rgb24(const arm_cv_image_nv12_t* ImageIn,
+                       arm_cv_image_rgb24_t* ImageOut)
+{
+  const uint32_t strideY = ARM_CV_IMAGE_STRIDE(ImageIn, 1);
+  const channel_uint8_t *pUV = ImageIn->pData + strideY * ImageIn->height;
+
+  arm_yuv420_to_rgb24_planes(ImageIn->pData, pUV, pUV + 1, strideY, strideY, 2, ImageIn->width, ImageIn->height,
+                             ImageOut->pData, ARM_CV_IMAGE_STRIDE(ImageOut, 3));
+}
+
+/**
+  @ingroup colorTransform
+ */
+
+/**     
+ * @brief      NV21 to packed RGB24
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ * 
+ * @par YUV format
+ * Y is a plane and V,U are interleaved in a second plane
+ *      
+ * @par Details about the transform
+ *      Same as arm_yuv420_to_rgb24
+ */
+void arm_nv21_to_rgb24(const arm_cv_image_nv21_t* ImageIn,
+                       arm_cv_image_rgb24_t* ImageOut)
+{
+  const uint32_t strideY = ARM_CV_IMAGE_STRIDE(ImageIn, 1);
+  const channel_uint8_t *pVU = ImageIn->pData + strideY * ImageIn->height;
+
+  arm_yuv420_to_rgb24_planes(ImageIn->pData, pVU + 1, pVU, strideY, strideY, 2, ImageIn->width, ImageIn->height,
+                             ImageOut->pData, ARM_CV_IMAGE_STRIDE(ImageOut, 3));
+}
@@ -0,0 +1,144 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS CV Library
+ * Title:        arm_yuv422_to_gray8
+ * Description:  Convertion of packed YUYV and UYVY to gray8
+ *
+ * Target Processor: Cortex-M
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2024 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "cv/color_transforms.h"
+
+/* yOffset is the position of the Y values in a pair of bytes :
+   0 for YUYV and 1 for UYVY */
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+static void arm_yuv422_to_gray8_pixels(const uint8_t *pIn,
+                                       const uint32_t yOffset,
+                                       uint8_t *pOut,
+                                       const uint32_t nb)
+{
+    uint32_t  blkCnt;           /* loop counters */
+    uint8x16x2_t vecSrc;
+
+    /* Compute 16 outputs at a time */
+    blkCnt = nb >> 4;
+    while (blkCnt > 0U)
+    {
+        /*
+         * Deinterleave 16 pairs and keep the Y lane
+         */
+        vecSrc = vld2q(pIn);
+        vst1q(pOut, vecSrc.val[yOffset]);
+        /*
+         * Decrement the blockSize loop counter
+         */
+        blkCnt--;
+        /*
+         * advance vector source and destination pointers
+         */
+        pIn += 32;
+        pOut += 16;
+    }
+    /*
+     * tail
+     */
+    blkCnt = nb & 0xF;
+    while (blkCnt > 0U)
+    {
+        *pOut++ = pIn[yOffset];
+        pIn += 2;
+        blkCnt--;
+    }
+}
+#else
+static void arm_yuv422_to_gray8_pixels(const uint8_t *pIn,
+                                       const uint32_t yOffset,
+                                       uint8_t *pOut,
+                                       const uint32_t nb)
+{
+  for(uint32_t i=0; i<nb;i++)
+  {
+     *pOut++ = pIn[yOffset];
+     pIn += 2;
+  }
+}
+#endif
+
+// The gray image is the Y component of the pixels
+static void arm_yuv422_to_gray8(const channel_uint8_t *pIn,
+                                const uint32_t yOffset,
+                                const uint32_t width,
+                                const uint32_t height,
+                                const uint32_t strideIn,
+                                arm_cv_image_gray8_t* ImageOut)
+{
+    const uint32_t strideOut = ARM_CV_IMAGE_STRIDE(ImageOut, 1);
+
+    if ((strideIn == 2 * width) && ARM_CV_IMAGE_IS_PACKED(ImageOut, 1))
+    {
+        arm_yuv422_to_gray8_pixels(pIn, yOffset, ImageOut->pData, height * width);
+        return;
+    }
+
+    for (uint32_t row = 0; row < height; row++)
+    {
+        arm_yuv422_to_gray8_pixels(&pIn[row * strideIn], yOffset,
+                                   &ImageOut->pData[row * strideOut],
+                                   width);
+    }
+}
+
+/**
+  @ingroup colorTransform
+ */
+
+/**     
+ * @brief      YUYV to Grayscale
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ * 
+ * @par YUV Format
+ * Packed YUV422, two pixels are Y0,U,Y1,V
+ */
+void arm_yuyv_to_gray8(const arm_cv_image_yuyv_t* ImageIn,
+                             arm_cv_image_gray8_t* ImageOut)
+{
+    arm_yuv422_to_gray8(ImageIn->pData, 0, ImageIn->width, ImageIn->height,
+                        ARM_CV_IMAGE_STRIDE(ImageIn, 2), ImageOut);
+}
+
+/**
+  @ingroup colorTransform
+ */
+
+/**     
+ * @brief      UYVY to Grayscale
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ * 
+ * @par YUV Format
+ * Packed YUV422, two pixels are U,Y0,V,Y1
+ */
+void arm_uyvy_to_gray8(const arm_cv_image_uyvy_t* ImageIn,
+                             arm_cv_image_gray8_t* ImageOut)
+{
+    arm_yuv422_to_gray8(ImageIn->pData, 1, ImageIn->width, ImageIn->height,
+                        ARM_CV_IMAGE_STRIDE(ImageIn, 2), ImageOut);
+}
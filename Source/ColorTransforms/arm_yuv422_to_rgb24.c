@@ -0,0 +1,233 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS CV Library
+ * Title:        arm_yuv422_to_rgb24
+ * Description:  Convertion of packed YUYV and UYVY to rgb24
+ *
+ * Target Processor: Cortex-M
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2024 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cv/color_transforms.h"
+#include "arm_color_transform_common.h"
+#include "dsp/none.h"
+
+// Fixed point coefficients are in Q17 format, same as arm_yuv420_to_rgb24
+__STATIC_FORCEINLINE channel_uint8_t arm_yuv_to_rgb_component(const int32_t y,
+                                                              const int32_t u,
+                                                              const int32_t v,
+                                                              const int32_t fa,
+                                                              const int32_t fb,
+                                                              const int32_t fc)
+{
+    int32_t tmp = fa * y + fb * u + fc * v;
+    tmp = tmp < 0 ? 0 : tmp;
+    return ((channel_uint8_t)__USAT((uint16_t)(tmp >> 17), 8));
+}
+
+__STATIC_FORCEINLINE void arm_yuv422_pair_to_rgb24(const int32_t y0,
+                                                   const int32_t y1,
+                                                   const int32_t u,
+                                                   const int32_t v,
+                                                   channel_uint8_t *pOut)
+{
+    pOut[0] = arm_yuv_to_rgb_component(y0, u, v, 152586, -234, 209163);
+    pOut[1] = arm_yuv_to_rgb_component(y0, u, v, 152586, -51307, -106625);
+    pOut[2] = arm_yuv_to_rgb_component(y0, u, v, 152586, 264481, -163);
+    pOut[3] = arm_yuv_to_rgb_component(y1, u, v, 152586, -234, 209163);
+    pOut[4] = arm_yuv_to_rgb_component(y1, u, v, 152586, -51307, -106625);
+    pOut[5] = arm_yuv_to_rgb_component(y1, u, v, 152586, 264481, -163);
+}
+
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+/* One component of 4 pixels, between 0 and 534 before the saturation */
+__STATIC_FORCEINLINE uint32x4_t arm_yuv_to_rgb_component_vec(const uint32x4_t y,
+                                                            const uint32x4_t u,
+                                                            const uint32x4_t v,
+                                                            const int32_t fa,
+                                                            const int32_t fb,
+                                                            const int32_t fc)
+{
+    int32x4_t yw = vsubq_n_s32(vreinterpretq_s32_u32(y), 16);
+    int32x4_t uw = vsubq_n_s32(vreinterpretq_s32_u32(u), 128);
+    int32x4_t vw = vsubq_n_s32(vreinterpretq_s32_u32(v), 128);
+
+    int32x4_t tmp = vmulq_n_s32(yw, fa);
+    tmp = vmlaq_n_s32(tmp, uw, fb);
+    tmp = vmlaq_n_s32(tmp, vw, fc);
+    tmp = vmaxq_s32(tmp, vdupq_n_s32(0));
+    return (vreinterpretq_u32_s32(vshrq_n_s32(tmp, 17)));
+}
+
+/* One component of 16 pixels. The 8-bit lanes are widened to 32 bits
+   in 4 groups (lanes 4k, 4k+2, 4k+1, 4k+3) and narrowed back to their
+   original position with a saturation */
+__STATIC_FORCEINLINE uint8x16_t arm_yuv_to_rgb_component_u8(const uint8x16_t y,
+                                                           const uint8x16_t u,
+                                                           const uint8x16_t v,
+                                                           const int32_t fa,
+                                                           const int32_t fb,
+                                                           const int32_t fc)
+{
+    uint16x8_t yb = vmovlbq_u8(y), yt = vmovltq_u8(y);
+    uint16x8_t ub = vmovlbq_u8(u), ut = vmovltq_u8(u);
+    uint16x8_t vb = vmovlbq_u8(v), vt = vmovltq_u8(v);
+    uint16x8_t resb = vdupq_n_u16(0);
+    uint16x8_t rest = vdupq_n_u16(0);
+    uint8x16_t res = vdupq_n_u8(0);
+
+    resb = vmovnbq_u32(resb, arm_yuv_to_rgb_component_vec(vmovlbq_u16(yb), vmovlbq_u16(ub),
+                                                          vmovlbq_u16(vb), fa, fb, fc));
+    resb = vmovntq_u32(resb, arm_yuv_to_rgb_component_vec(vmovltq_u16(yb), vmovltq_u16(ub),
+                                                          vmovltq_u16(vb), fa, fb, fc));
+    rest = vmovnbq_u32(rest, arm_yuv_to_rgb_component_vec(vmovlbq_u16(yt), vmovlbq_u16(ut),
+                                                          vmovlbq_u16(vt), fa, fb, fc));
+    rest = vmovntq_u32(rest, arm_yuv_to_rgb_component_vec(vmovltq_u16(yt), vmovltq_u16(ut),
+                                                          vmovltq_u16(vt), fa, fb, fc));
+
+    res = vqmovnbq_u16(res, resb);
+    res = vqmovntq_u16(res, rest);
+    return (res);
+}
+
+void arm_yuv422_row_to_rgb24(const channel_uint8_t *pIn,
+                             const uint32_t yOffset,
+                             const uint32_t nbCols,
+                             channel_uint8_t *pOut)
+{
+    /* Pixel 2i of a block is written at 6i, pixel 2i+1 at 6i+3 */
+    const uint8x16_t vOffset = vmulq_n_u8(vidupq_n_u8(0, 1), 6);
+    const uint32_t uOffset = 1 - yOffset;
+    uint32_t blkCnt = nbCols >> 5;
+
+    while (blkCnt > 0U)
+    {
+        /* 32 pixels : val[yOffset] and val[yOffset + 2] are the even and
+           odd Y, val[uOffset] and val[uOffset + 2] the shared U and V */
+        uint8x16x4_t yuv = vld4q(pIn);
+        uint8x16_t y0 = yuv.val[yOffset];
+        uint8x16_t y1 = yuv.val[yOffset + 2];
+        uint8x16_t u = yuv.val[uOffset];
+        uint8x16_t v = yuv.val[uOffset + 2];
+
+        vstrbq_scatter_offset_u8(pOut, vOffset, arm_yuv_to_rgb_component_u8(y0, u, v, 152586, -234, 209163));
+        vstrbq_scatter_offset_u8(pOut + 1, vOffset, arm_yuv_to_rgb_component_u8(y0, u, v, 152586, -51307, -106625));
+        vstrbq_scatter_offset_u8(pOut + 2, vOffset, arm_yuv_to_rgb_component_u8(y0, u, v, 152586, 264481, -163));
+        vstrbq_scatter_offset_u8(pOut + 3, vOffset, arm_yuv_to_rgb_component_u8(y1, u, v, 152586, -234, 209163));
+        vstrbq_scatter_offset_u8(pOut + 4, vOffset, arm_yuv_to_rgb_component_u8(y1, u, v, 152586, -51307, -106625));
+        vstrbq_scatter_offset_u8(pOut + 5, vOffset, arm_yuv_to_rgb_component_u8(y1, u, v, 152586, 264481, -163));
+
+        pIn += 64;
+        pOut += 96;
+        blkCnt--;
+    }
+
+    blkCnt = nbCols & 0x1F;
+    for (uint32_t i = 0; i < blkCnt; i += 2)
+    {
+        arm_yuv422_pair_to_rgb24((int32_t)pIn[yOffset] - 16,
+                                 (int32_t)pIn[yOffset + 2] - 16,
+                                 (int32_t)pIn[uOffset] - 128,
+                                 (int32_t)pIn[uOffset + 2] - 128,
+                                 pOut);
+        pIn += 4;
+        pOut += 6;
+    }
+}
+#else
+void arm_yuv422_row_to_rgb24(const channel_uint8_t *pIn,
+                             const uint32_t yOffset,
+                             const uint32_t nbCols,
+                             channel_uint8_t *pOut)
+{
+    const uint32_t uOffset = 1 - yOffset;
+
+    for (uint32_t i = 0; i < nbCols; i += 2)
+    {
+        arm_yuv422_pair_to_rgb24((int32_t)pIn[yOffset] - 16,
+                                 (int32_t)pIn[yOffset + 2] - 16,
+                                 (int32_t)pIn[uOffset] - 128,
+                                 (int32_t)pIn[uOffset + 2] - 128,
+                                 pOut);
+        pIn += 4;
+        pOut += 6;
+    }
+}
+#endif
+
+static void arm_yuv422_to_rgb24(const channel_uint8_t *pIn,
+                                const uint32_t yOffset,
+                                const uint32_t width,
+                                const uint32_t height,
+                                const uint32_t strideIn,
+                                arm_cv_image_rgb24_t* ImageOut)
+{
+    const uint32_t strideOut = ARM_CV_IMAGE_STRIDE(ImageOut, 3);
+
+    for (uint32_t row = 0; row < height; row++)
+    {
+        arm_yuv422_row_to_rgb24(&pIn[row * strideIn], yOffset, width,
+                                &ImageOut->pData[row * strideOut]);
+    }
+}
+
+/**
+  @ingroup colorTransform
+ */
+
+/**
+ * @brief      YUYV to packed RGB24
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ *
+ * @par YUV format
+ * Packed YUV422, two pixels are Y0,U,Y1,V
+ *
+ * @par Details about the transform
+ *      Same as arm_yuv420_to_rgb24
+ */
+void arm_yuyv_to_rgb24(const arm_cv_image_yuyv_t* ImageIn,
+                       arm_cv_image_rgb24_t* ImageOut)
+{
+    arm_yuv422_to_rgb24(ImageIn->pData, 0, ImageIn->width, ImageIn->height,
+                        ARM_CV_IMAGE_STRIDE(ImageIn, 2), ImageOut);
+}
+
+/**
+  @ingroup colorTransform
+ */
+
+/**
+ * @brief      UYVY to packed RGB24
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ *
+ * @par YUV format
+ * Packed YUV422, two pixels are U,Y0,V,Y1
+ *
+ * @par Details about the transform
+ *      Same as arm_yuv420_to_rgb24
+ */
+void arm_uyvy_to_rgb24(const arm_cv_image_uyvy_t* ImageIn,
+                       arm_cv_image_rgb24_t* ImageOut)
+{
+    arm_yuv422_to_rgb24(ImageIn->pData, 1, ImageIn->width, ImageIn->height,
+                        ARM_CV_IMAGE_STRIDE(ImageIn, 2), ImageOut);
+}
@@ -24,9 +24,12 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include "arm_linear_filter_common.h"
 #include "cv/feature_detection.h"
 #include "dsp/basic_math_functions.h"
 #include "dsp/fast_math_functions.h"
+#include <assert.h>
+#include <stdlib.h>
 
 #define Q15_ONE 0x7FFF
 #define Q8_ONE 0xFF
@@ -174,6 +177,31 @@ The different values of x are angle dependent see helper below, and relative to
         VERTICAL_CASE_BOT_BORDER(thresh, width, data_mag, data_out, idx, mag, x, y)                                    \
     }
 
+// tan(22.5 deg) in q15, used to find the octant of the gradient without computing its angle
+#define TAN_22_5_Q15 13573
+#define MUL_TAN_22_5(a) (((a) * TAN_22_5_Q15) >> 15)
+
+// Same as THRESHOLDING_HYSTERESIS, the direction is found by comparing the absolute values of the gradient.
+// The diagonal is given by the sign of gradx * grady. It is not the same as THRESHOLDING_HYSTERESIS when
+// gradx > 0 because the angle given to THRESHOLDING_HYSTERESIS is an absolute value
+#define THRESHOLDING_HYSTERESIS_OCTANT(gradx, grady, thresh, width, data_mag, data_out, idx, mag, x, y)               \
+    if (abs(gradx) <= MUL_TAN_22_5(abs(grady)))                                                                        \
+    {                                                                                                                  \
+        VERTICAL_CASE(thresh, width, data_mag, data_out, idx, mag, x, y)                                               \
+    }                                                                                                                  \
+    else if (abs(grady) <= MUL_TAN_22_5(abs(gradx)))                                                                   \
+    {                                                                                                                  \
+        HORIZONTAL_CASE(thresh, width, data_mag, data_out, idx, mag, x, y)                                             \
+    }                                                                                                                  \
+    else if (((gradx) ^ (grady)) >= 0)                                                                                 \
+    {                                                                                                                  \
+        DIAGONAL_135_CASE(thresh, width, data_mag, data_out, idx, mag, x, y)                                           \
+    }                                                                                                                  \
+    else                                                                                                               \
+    {                                                                                                                  \
+        DIAGONAL_45_CASE(thresh, width, data_mag, data_out, idx, mag, x, y)                                            \
+    }
+
 /**
   @ingroup featureDetection
  */
@@ -184,18 +212,36 @@ The different values of x are angle dependent see helper below, and relative to
  * @param[in]     width         The width of the image
  * @return		  Scratch size in bytes
  */
-uint16_t arm_cv_get_scratch_size_canny_sobel(int width)
+uint32_t arm_cv_get_scratch_size_canny_sobel(int width)
 {
     return ((NB_LINE_BUF + 2 * NB_LINE_BUF + 2 * NB_LINE_BUF) * width * sizeof(q15_t));
 }
 
+/**
+  @ingroup featureDetection
+ */
+
+/**
+ * @brief      Return the scratch size for canny_gaussian_sobel function
+ *
+ * @param[in]     width         The width of the image
+ * @return		  Scratch size in bytes
+ *
+ * The buffer contains the magnitudes, the gradients, one line of vertical sums of the gaussian
+ * and the smoothed lines
+ */
+uint32_t arm_cv_get_scratch_size_canny_gaussian_sobel(int width)
+{
+    return ((NB_LINE_BUF + 2 * NB_LINE_BUF + 1) * width * sizeof(q15_t) + NB_LINE_BUF * width * sizeof(uint8_t));
+}
+
 #if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
 
 #define ELTS_PER_VECT_16 8
 
 #define MASK_16(x) ((x) & 0x0FFE0)
 
-static void arm_cv_gradient_intermediate(int offsIn, int offsOut, int width, const uint8_t *dataIn,
+static void arm_cv_gradient_intermediate(int offsIn, int offsOut, int strideIn, const uint8_t *dataIn,
                                          arm_cv_gradient_q15_t *dataOut)
 {
     q15x8x2_t vect_2x2;
@@ -224,12 +270,12 @@ static void arm_cv_gradient_intermediate(int offsIn, int offsOut, int width, con
     vect_2x2.val[1] = vshlltq(vect_2, 6);
     vect_1x2.val[1] = vaddq(vect_2x2.val[1], vect_1x2.val[1]);
 
-    uint8x16_t vecth = vld1q(&dataIn[offsIn - width]);
+    uint8x16_t vecth = vld1q(&dataIn[offsIn - strideIn]);
 
     vect_highx2.val[0] = vshllbq(vecth, 5);
     vect_highx2.val[1] = vshlltq(vecth, 5);
 
-    uint8x16_t vectl = vld1q(&dataIn[offsIn + width]);
+    uint8x16_t vectl = vld1q(&dataIn[offsIn + strideIn]);
 
     vect_lowx2.val[0] = vshllbq(vectl, 5);
     vect_lowx2.val[1] = vshlltq(vectl, 5);
@@ -306,31 +352,33 @@ static void arm_cv_gradient_magnitude(int rowIdx, int colIdx, int width, int off
 
 static void arm_cv_gradient_magnitude_tail(int rowIdx, int rowIdxOut, int width, arm_cv_gradient_q15_t *dataGrad1,
                                            arm_cv_gradient_q15_t *dataGrad2, const arm_cv_image_gray8_t *imageIn,
-                                           q15_t *magOut, uint8_t *dataOut)
+                                           q15_t *magOut, uint8_t *dataOut, int strideOut)
 {
+    const int strideIn = ARM_CV_IMAGE_STRIDE(imageIn, 1);
     uint8_t *data_in = imageIn->pData;
     for (int y = MASK_16(width - 1); y < width; y++)
     {
         if ((y == 0 || y == width - 1) && rowIdx != 0 && rowIdx != imageIn->height - 1)
         {
             dataGrad2[rowIdxOut * width + y].y =
-                Q5_10_TO_Q15(data_in[(rowIdx - 1) * width + y] + (data_in[rowIdx * width + y] << 1) +
-                             data_in[(rowIdx + 1) * width + y]);
+                Q5_10_TO_Q15(data_in[(rowIdx - 1) * strideIn + y] + (data_in[rowIdx * strideIn + y] << 1) +
+                             data_in[(rowIdx + 1) * strideIn + y]);
             magOut[((((rowIdx - 1) % NB_LINE_BUF * width)) + y)] = 0;
-            dataOut[rowIdx * width + y] = 0;
+            dataOut[rowIdx * strideOut + y] = 0;
             continue;
         }
         if (rowIdx == 0 || y == 0 || y == width - 1)
         {
             magOut[((((rowIdx - 1) % NB_LINE_BUF * width)) + y)] = 0;
-            dataOut[rowIdx * width + y] = 0;
+            dataOut[rowIdx * strideOut + y] = 0;
             continue;
         }
         dataGrad2[rowIdxOut * width + y].y = Q5_10_TO_Q15(
-            data_in[(rowIdx - 1) * width + y] + (data_in[rowIdx * width + y] << 1) + data_in[(rowIdx + 1) * width + y]);
+            data_in[(rowIdx - 1) * strideIn + y] + (data_in[rowIdx * strideIn + y] << 1) +
+            data_in[(rowIdx + 1) * strideIn + y]);
         dataGrad2[rowIdxOut * width + y].x =
-            Q5_10_TO_Q15(data_in[rowIdx * width + (y - 1)] + (data_in[rowIdx * width + (y)] << 1) +
-                         data_in[rowIdx * width + (y + 1)]);
+            Q5_10_TO_Q15(data_in[rowIdx * strideIn + (y - 1)] + (data_in[rowIdx * strideIn + (y)] << 1) +
+                         data_in[rowIdx * strideIn + (y + 1)]);
         if (rowIdx == 1)
         {
             continue;
@@ -343,7 +391,7 @@ static void arm_cv_gradient_magnitude_tail(int rowIdx, int rowIdxOut, int width,
         if (gradx == 0 && grady == 0)
         {
             magOut[((((rowIdx - 1) % NB_LINE_BUF * width)) + y)] = 0;
-            dataOut[(rowIdx - 1) * width + y] = 0;
+            dataOut[(rowIdx - 1) * strideOut + y] = 0;
             continue;
         }
         q31_t out;
@@ -360,6 +408,8 @@ static void arm_cv_compute_buffer_line_canny_sobel(const arm_cv_image_gray8_t *i
                                                    q15_t *magOut, int rowIdx)
 {
     const int width = imageIn->width;
+    const int strideIn = ARM_CV_IMAGE_STRIDE(imageIn, 1);
+    const int strideOut = ARM_CV_IMAGE_STRIDE(imageOut, 1);
     int xm = rowIdx % NB_LINE_BUF;
     int idx;
     uint8_t *data_in = imageIn->pData;
@@ -367,17 +417,19 @@ static void arm_cv_compute_buffer_line_canny_sobel(const arm_cv_image_gray8_t *i
 
     grad2[xm * width].x = 0;
     grad2[xm * width].y =
-        Q5_10_TO_Q15((data_in[(rowIdx - 1) * width] + (data_in[rowIdx * width] << 1) + data_in[(rowIdx + 1) * width]));
-    data_out[(rowIdx - 1) * width] = 0;
+        Q5_10_TO_Q15((data_in[(rowIdx - 1) * strideIn] + (data_in[rowIdx * strideIn] << 1) +
+                      data_in[(rowIdx + 1) * strideIn]));
+    data_out[(rowIdx - 1) * strideOut] = 0;
     for (int y = 1; y < width - 1; y++)
     {
-        idx = (rowIdx - 1) * width + y;
+        idx = (rowIdx - 1) * strideOut + y;
 
-        grad2[xm * width + y].y = Q5_10_TO_Q15(data_in[(rowIdx - 1) * width + y] + (data_in[rowIdx * width + y] << 1) +
-                                               data_in[(rowIdx + 1) * width + y]);
+        grad2[xm * width + y].y =
+            Q5_10_TO_Q15(data_in[(rowIdx - 1) * strideIn + y] + (data_in[rowIdx * strideIn + y] << 1) +
+                         data_in[(rowIdx + 1) * strideIn + y]);
         grad2[xm * width + y].x =
-            Q5_10_TO_Q15(data_in[rowIdx * width + (y - 1)] + (data_in[rowIdx * width + (y)] << 1) +
-                         data_in[rowIdx * width + (y + 1)]);
+            Q5_10_TO_Q15(data_in[rowIdx * strideIn + (y - 1)] + (data_in[rowIdx * strideIn + (y)] << 1) +
+                         data_in[rowIdx * strideIn + (y + 1)]);
         q15_t gradx = grad2[((rowIdx - 2) % NB_LINE_BUF) * width + y].x - grad2[(xm)*width + y].x;
         q15_t grady = grad2[((rowIdx - 1) % NB_LINE_BUF) * width + (y - 1)].y -
                       grad2[((rowIdx - 1) % NB_LINE_BUF) * width + (y + 1)].y;
@@ -402,9 +454,9 @@ static void arm_cv_compute_buffer_line_canny_sobel(const arm_cv_image_gray8_t *i
     }
     grad2[xm * width].x = 0;
     grad2[xm * width + width - 1].y =
-        Q5_10_TO_Q15(data_in[(rowIdx - 1) * width + width - 1] + (data_in[rowIdx * width + width - 1] << 1) +
-                     data_in[(rowIdx + 1) * width + width - 1]);
-    data_out[(rowIdx - 1) * width + width - 1] = 0;
+        Q5_10_TO_Q15(data_in[(rowIdx - 1) * strideIn + width - 1] + (data_in[rowIdx * strideIn + width - 1] << 1) +
+                     data_in[(rowIdx + 1) * strideIn + width - 1]);
+    data_out[(rowIdx - 1) * strideOut + width - 1] = 0;
 }
 #endif
 /**
@@ -435,6 +487,8 @@ void arm_cv_canny_edge_sobel(const arm_cv_image_gray8_t *imageIn, arm_cv_image_g
     q15x8_t vect_mag;
     int x = 0;
     const int width = imageIn->width;
+    const int strideIn = ARM_CV_IMAGE_STRIDE(imageIn, 1);
+    const int strideOut = ARM_CV_IMAGE_STRIDE(imageOut, 1);
     q31_t low_threshold = U8_TO_Q2_13(lowThreshold);
     q31_t high_threshold = U8_TO_Q2_13(highThreshold);
     arm_cv_gradient_q15_t *data_grad1 = (arm_cv_gradient_q15_t *)&scratch[3 * NB_LINE_BUF * width];
@@ -450,7 +504,7 @@ void arm_cv_canny_edge_sobel(const arm_cv_image_gray8_t *imageIn, arm_cv_image_g
         data_grad2[t].x = 0;
     }
     // First line of buffer
-    data_out[x * width] = 0;
+    memset(data_out, 0, width);
     for (int y = 1; y < ((width) >> 4) + 1; y++)
     {
         int idx = ((y - 1) << 4) + 1;
@@ -482,8 +536,6 @@ void arm_cv_canny_edge_sobel(const arm_cv_image_gray8_t *imageIn, arm_cv_image_g
         vect_1x4.val[2] = vect_2x2.val[1];
         vect_1x4.val[3] = vect_void;
         vst4q((&data_grad2[idx].x), vect_1x4);
-        vst1q(&data_out[idx], (uint8x16_t)vect_void);
-        vst1q(&data_out[idx + 16], (uint8x16_t)vect_void);
     }
     // tail
     int numtail = (width - 1) - MASK_16(width - 1);
@@ -497,17 +549,17 @@ void arm_cv_canny_edge_sobel(const arm_cv_image_gray8_t *imageIn, arm_cv_image_g
             data_out[y + j] = 0;
         }
     }
-    data_out[x * width + width - 1] = 0;
+    data_out[x * strideOut + width - 1] = 0;
     // Second line for buffer
     x = 1;
     data_grad2[x * width].x = 0;
-    data_out[x * width] = 0;
+    data_out[x * strideOut] = 0;
     data_grad2[x * width].y =
-        Q5_10_TO_Q15(data_in[(x - 1) * width] + (data_in[x * width] << 1) + data_in[(x + 1) * width]);
+        Q5_10_TO_Q15(data_in[(x - 1) * strideIn] + (data_in[x * strideIn] << 1) + data_in[(x + 1) * strideIn]);
     for (int y = 1; y < ((width) >> 4) + 1; y++)
     {
-        int idx = width + ((y - 1) << 4) + 1;
-        arm_cv_gradient_intermediate(idx, idx, width, data_in, data_grad2);
+        int col = ((y - 1) << 4) + 1;
+        arm_cv_gradient_intermediate(strideIn + col, width + col, strideIn, data_in, data_grad2);
     }
     // Tail
     if (numtail > 0)
@@ -517,51 +569,51 @@ void arm_cv_canny_edge_sobel(const arm_cv_image_gray8_t *imageIn, arm_cv_image_g
             int x = 1;
             int y = ((width)-numtail - 1);
             data_grad2[x * width + y + j].y =
-                Q5_10_TO_Q15(data_in[(x - 1) * width + y + j] + (data_in[x * width + y + j] << 1) +
-                             data_in[(x + 1) * width + y + j]);
+                Q5_10_TO_Q15(data_in[(x - 1) * strideIn + y + j] + (data_in[x * strideIn + y + j] << 1) +
+                             data_in[(x + 1) * strideIn + y + j]);
             data_grad2[x * width + y + j].x =
-                Q5_10_TO_Q15(data_in[x * width + (y - 1) + j] + (data_in[x * width + (y) + j] << 1) +
-                             data_in[x * width + (y + 1) + j]);
+                Q5_10_TO_Q15(data_in[x * strideIn + (y - 1) + j] + (data_in[x * strideIn + (y) + j] << 1) +
+                             data_in[x * strideIn + (y + 1) + j]);
         }
     }
     data_grad2[width + width - 1].x = 0;
     data_grad2[width + width - 1].y =
-        Q5_10_TO_Q15(data_in[(x - 1) * width + width - 1] + (data_in[x * width + width - 1] << 1) +
-                     data_in[(x + 1) * width + width - 1]);
+        Q5_10_TO_Q15(data_in[(x - 1) * strideIn + width - 1] + (data_in[x * strideIn + width - 1] << 1) +
+                     data_in[(x + 1) * strideIn + width - 1]);
     for (int x = 2; x < 3; x++)
     {
         int x3 = x % NB_LINE_BUF;
         data_grad2[x3 * width].y =
-            Q5_10_TO_Q15(data_in[(x - 1) * width] + (data_in[x * width] << 1) + data_in[(x + 1) * width]);
-        data_out[(x - 2) * width] = 0;
+            Q5_10_TO_Q15(data_in[(x - 1) * strideIn] + (data_in[x * strideIn] << 1) + data_in[(x + 1) * strideIn]);
+        data_out[(x - 2) * strideOut] = 0;
         for (int y = 1; y < width - 15; y += 16)
         {
-            int idx = x * width + y;
+            int idx = x * strideIn + y;
             int idx3 = x3 * width + y;
-            arm_cv_gradient_intermediate(idx, idx3, width, data_in, data_grad2);
+            arm_cv_gradient_intermediate(idx, idx3, strideIn, data_in, data_grad2);
             arm_cv_gradient_magnitude(x, y, width, idx3, data_grad1, data_grad2, data_mag);
         }
         // Tail
-        arm_cv_gradient_magnitude_tail(x, x3, width, data_grad1, data_grad2, imageIn, data_mag, data_out);
+        arm_cv_gradient_magnitude_tail(x, x3, width, data_grad1, data_grad2, imageIn, data_mag, data_out, strideOut);
     }
     // Core loop
     for (int x = 3; x < imageIn->height; x++)
     {
         int x3 = x % NB_LINE_BUF;
         data_grad2[x3 * width].y =
-            Q5_10_TO_Q15(data_in[(x - 1) * width] + (data_in[x * width] << 1) + data_in[(x + 1) * width]);
-        data_out[(x - 2) * width] = 0;
+            Q5_10_TO_Q15(data_in[(x - 1) * strideIn] + (data_in[x * strideIn] << 1) + data_in[(x + 1) * strideIn]);
+        data_out[(x - 2) * strideOut] = 0;
         for (int y = 1; y < width - 16; y += 16)
         {
-            int idx = x * width + y;
+            int idx = x * strideIn + y;
             int idx3 = x3 * width + y;
-            arm_cv_gradient_intermediate(idx, idx3, width, data_in, data_grad2);
+            arm_cv_gradient_intermediate(idx, idx3, strideIn, data_in, data_grad2);
             arm_cv_gradient_magnitude(x, y, width, idx3, data_grad1, data_grad2, data_mag);
         }
-        arm_cv_gradient_magnitude_tail(x, x3, width, data_grad1, data_grad2, imageIn, data_mag, data_out);
+        arm_cv_gradient_magnitude_tail(x, x3, width, data_grad1, data_grad2, imageIn, data_mag, data_out, strideOut);
         for (int y = 1; y < MASK_16(width - 2); y += ELTS_PER_VECT_16)
         {
-            int idx = (x - 2) * width + y;
+            int idx = (x - 2) * strideOut + y;
             vect_mag = vld1q(&data_mag[((x - 2) % NB_LINE_BUF) * (width) + y]);
             uint8x16_t vect_out;
             int16x8x2_t vect_grad = vld2q(&data_grad1[((x - 2) % NB_LINE_BUF) * width + y].x);
@@ -582,12 +634,12 @@ void arm_cv_canny_edge_sobel(const arm_cv_image_gray8_t *imageIn, arm_cv_image_g
                     THRESHOLDING_HYSTERESIS(angle, high_threshold, width, data_mag, vect_out, j, mag, x, y + j)
                 }
             }
-            vst1q((uint8_t *)&data_out[idx], vect_out);
+            vstrbq_p_u8(&data_out[idx], vect_out, vctp8q(ELTS_PER_VECT_16));
         }
         // tail
         for (int y = MASK_16(width - 1); y < width; y++)
         {
-            int idx = (x - 2) * width + y;
+            int idx = (x - 2) * strideOut + y;
             int mag = data_mag[((x - 2) % NB_LINE_BUF) * (width) + y];
             if (mag != 0)
             {
@@ -616,14 +668,14 @@ void arm_cv_canny_edge_sobel(const arm_cv_image_gray8_t *imageIn, arm_cv_image_g
     {
         for (int y = 0; y < MASK_16(width - 2); y += ELTS_PER_VECT_16)
         {
-            data_out[(x - 1) * width] = 0;
-            int idx = (x - 2) * width + y;
+            data_out[(x - 1) * strideOut] = 0;
+            int idx = (x - 2) * strideOut + y;
             vect_mag = vld1q(&data_mag[((x - 2) % NB_LINE_BUF) * (width) + y]);
             uint8x16_t vect_out;
             if (y + 16 < width - 1)
             {
                 uint8x16_t vect_void = vdupq_n_u8(0);
-                vst1q(&data_out[(x - 1) * width + y], vect_void);
+                vst1q(&data_out[(x - 1) * strideOut + y], vect_void);
             }
             int16x8x2_t vect_grad = vld2q(&data_grad1[((x - 2) % NB_LINE_BUF) * width + y].x);
             for (int j = 0; j < ELTS_PER_VECT_16; j++)
@@ -650,14 +702,14 @@ void arm_cv_canny_edge_sobel(const arm_cv_image_gray8_t *imageIn, arm_cv_image_g
                     vect_out[j] = 0;
                 }
             }
-            vst1q((uint8_t *)&data_out[idx], vect_out);
+            vstrbq_p_u8(&data_out[idx], vect_out, vctp8q(ELTS_PER_VECT_16));
         }
         // tail
         for (int y = MASK_16(width - 1); y < width; y++)
         {
-            int idx = (x - 2) * width + y;
+            int idx = (x - 2) * strideOut + y;
             int mag = data_mag[((x - 2) % NB_LINE_BUF) * (width) + y];
-            data_out[idx + width] = 0;
+            data_out[idx + strideOut] = 0;
             q15_t angle;
             arm_cv_gradient_q15_t grad = data_grad1[((x - 2) % NB_LINE_BUF) * width + y];
             arm_atan2_q15(grad.x, grad.y, &angle);
@@ -689,6 +741,8 @@ void arm_cv_canny_edge_sobel(const arm_cv_image_gray8_t *imageIn, arm_cv_image_g
                              uint8_t lowThreshold, uint8_t highThreshold)
 {
     int16_t width = imageIn->width;
+    const int strideIn = ARM_CV_IMAGE_STRIDE(imageIn, 1);
+    const int strideOut = ARM_CV_IMAGE_STRIDE(imageOut, 1);
     q31_t low_threshold = U8_TO_Q2_13(lowThreshold);
     q31_t high_threshold = U8_TO_Q2_13(highThreshold);
 
@@ -704,30 +758,33 @@ void arm_cv_canny_edge_sobel(const arm_cv_image_gray8_t *imageIn, arm_cv_image_g
         data_mag[t] = 0;
         data_grad2[t].x = 0;
     }
-    data_out[x * width] = 0;
+    data_out[x * strideOut] = 0;
     for (int y = 1; y < width - 1; y++)
     {
         // Apply [1,2,1] kernel for computation of a part of the sobel gradient
         data_grad2[x * width + y].x =
-            Q5_10_TO_Q15(data_in[x * width + (y - 1)] + (data_in[x * width + (y)] << 1) + data_in[x * width + (y + 1)]);
-        data_out[x * width + y] = 0;
+            Q5_10_TO_Q15(data_in[x * strideIn + (y - 1)] + (data_in[x * strideIn + (y)] << 1) +
+                         data_in[x * strideIn + (y + 1)]);
+        data_out[x * strideOut + y] = 0;
     }
-    data_out[x * width + width - 1] = 0;
+    data_out[x * strideOut + width - 1] = 0;
     x = 1;
     data_grad2[x * width].y =
-        Q5_10_TO_Q15(data_in[(x - 1) * width] + (data_in[x * width] << 1) + data_in[(x + 1) * width]);
-    data_out[x * width] = 0;
+        Q5_10_TO_Q15(data_in[(x - 1) * strideIn] + (data_in[x * strideIn] << 1) + data_in[(x + 1) * strideIn]);
+    data_out[x * strideOut] = 0;
     for (int y = 1; y < width - 1; y++)
     {
         data_grad2[x * width + y].y =
-            Q5_10_TO_Q15(data_in[(x - 1) * width + y] + (data_in[x * width + y] << 1) + data_in[(x + 1) * width + y]);
+            Q5_10_TO_Q15(data_in[(x - 1) * strideIn + y] + (data_in[x * strideIn + y] << 1) +
+                         data_in[(x + 1) * strideIn + y]);
         data_grad2[x * width + y].x =
-            Q5_10_TO_Q15(data_in[x * width + (y - 1)] + (data_in[x * width + (y)] << 1) + data_in[x * width + (y + 1)]);
+            Q5_10_TO_Q15(data_in[x * strideIn + (y - 1)] + (data_in[x * strideIn + (y)] << 1) +
+                         data_in[x * strideIn + (y + 1)]);
     }
     data_grad2[x * width + width - 1].y =
-        Q5_10_TO_Q15(data_in[(x - 1) * width + width - 1] + (data_in[x * width + width - 1] << 1) +
-                     data_in[(x + 1) * width + width - 1]);
-    data_out[x * width + width - 1] = 0;
+        Q5_10_TO_Q15(data_in[(x - 1) * strideIn + width - 1] + (data_in[x * strideIn + width - 1] << 1) +
+                     data_in[(x + 1) * strideIn + width - 1]);
+    data_out[x * strideOut + width - 1] = 0;
     x = 2;
     // first line
     arm_cv_compute_buffer_line_canny_sobel(imageIn, imageOut, data_grad1, data_grad2, data_mag, x);
@@ -738,7 +795,7 @@ void arm_cv_canny_edge_sobel(const arm_cv_image_gray8_t *imageIn, arm_cv_image_g
 
         for (int y = 1; y < width - 1; y++)
         {
-            int idx = (x - 2) * width + y;
+            int idx = (x - 2) * strideOut + y;
             int mag = data_mag[((x - 2) % NB_LINE_BUF) * (width) + y];
             if (mag < low_threshold)
             {
@@ -757,12 +814,12 @@ void arm_cv_canny_edge_sobel(const arm_cv_image_gray8_t *imageIn, arm_cv_image_g
     }
     // last line
     x = imageIn->height;
-    data_out[(x - 1) * width] = 0;
+    data_out[(x - 1) * strideOut] = 0;
     for (int y = 1; y < width - 1; y++)
     {
-        int idx = (x - 2) * width + y;
+        int idx = (x - 2) * strideOut + y;
         int mag = data_mag[((x - 2) % NB_LINE_BUF) * (width) + y];
-        data_out[idx + width] = 0;
+        data_out[idx + strideOut] = 0;
         if (mag < low_threshold)
         {
             data_out[idx] = 0;
@@ -782,6 +839,915 @@ void arm_cv_canny_edge_sobel(const arm_cv_image_gray8_t *imageIn, arm_cv_image_g
             THRESHOLDING_HYSTERESIS_BOTTOM_BORDER(angle, high_threshold, width, data_mag, data_out, idx, mag, x, y)
         }
     }
-    data_out[(x - 1) * width + width - 1] = 0;
+    data_out[(x - 1) * strideOut + width - 1] = 0;
+}
+#endif
+// Magnitude of the gradient, same fixed point format as the gradient.
+// The L1 norm is saturated, the thresholds are far below the saturation value
+__STATIC_FORCEINLINE q15_t arm_cv_canny_magnitude(q15_t gradx, q15_t grady, const uint8_t flags)
+{
+    if (flags & ARM_CV_CANNY_L1_GRADIENT)
+    {
+        return ((q15_t)__SSAT(abs(gradx) + abs(grady), 16));
+    }
+    if (gradx == 0 && grady == 0)
+    {
+        return (0);
+    }
+    q31_t root;
+    arm_sqrt_q31((gradx * gradx + grady * grady) >> 1, &root);
+    return ((q15_t)Q31_TO_Q15(root));
+}
+
+// Horizontal [1,2,1] kernel of the gaussian on the vertical sums, the division by 16 gives the same
+// result as arm_gaussian_filter_3x3_fixp
+__STATIC_FORCEINLINE uint8_t arm_cv_canny_gaussian_pixel(const uint16_t *vertSum, int y, int width,
+                                                         const int8_t borderType)
+{
+    return ((vertSum[arm_cv_border_index(y - 1, width, borderType)] + (vertSum[y] << 1) +
+             vertSum[arm_cv_border_index(y + 1, width, borderType)]) >>
+            4);
+}
+
+// Gradient of the line lineMid, lineTop and lineBot are the smoothed lines above and below
+__STATIC_FORCEINLINE void arm_cv_canny_gradient_pixel(const uint8_t *lineTop, const uint8_t *lineMid,
+                                                      const uint8_t *lineBot, int y, arm_cv_gradient_q15_t *gradOut,
+                                                      q15_t *magOut, const uint8_t flags)
+{
+    q15_t gradx = Q5_10_TO_Q15(lineTop[y - 1] + (lineTop[y] << 1) + lineTop[y + 1]) -
+                  Q5_10_TO_Q15(lineBot[y - 1] + (lineBot[y] << 1) + lineBot[y + 1]);
+    q15_t grady = Q5_10_TO_Q15(lineTop[y - 1] + (lineMid[y - 1] << 1) + lineBot[y - 1]) -
+                  Q5_10_TO_Q15(lineTop[y + 1] + (lineMid[y + 1] << 1) + lineBot[y + 1]);
+    gradOut[y].x = gradx;
+    gradOut[y].y = grady;
+    magOut[y] = arm_cv_canny_magnitude(gradx, grady, flags);
+}
+
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+static void arm_cv_canny_gaussian_line(const uint8_t *dataIn, int width, int strideIn, int height, int firstRowIn,
+                                       int row, const int8_t borderType, uint16_t *vertSum, uint8_t *lineOut)
+{
+    const uint8_t *dataTop = &dataIn[(arm_cv_border_index(row - 1, height, borderType) - firstRowIn) * strideIn];
+    const uint8_t *dataMid = &dataIn[(row - firstRowIn) * strideIn];
+    const uint8_t *dataBot = &dataIn[(arm_cv_border_index(row + 1, height, borderType) - firstRowIn) * strideIn];
+
+    // Vertical [1,2,1] kernel, the sums are below 1020 so they fit in an uint16
+    for (int y = 0; y < width; y += 8)
+    {
+        mve_pred16_t p0 = vctp16q(width - y);
+        uint16x8_t vec = vldrbq_z_u16(&dataTop[y], p0);
+        vec = vaddq(vec, vshlq_n_u16(vldrbq_z_u16(&dataMid[y], p0), 1));
+        vec = vaddq(vec, vldrbq_z_u16(&dataBot[y], p0));
+        vstrhq_p(&vertSum[y], vec, p0);
+    }
+    // Horizontal [1,2,1] kernel
+    for (int y = 1; y < width - 1; y += 8)
+    {
+        mve_pred16_t p0 = vctp16q(width - 1 - y);
+        uint16x8_t vec = vldrhq_z_u16(&vertSum[y - 1], p0);
+        vec = vaddq(vec, vshlq_n_u16(vldrhq_z_u16(&vertSum[y], p0), 1));
+        vec = vaddq(vec, vldrhq_z_u16(&vertSum[y + 1], p0));
+        vstrbq_p_u16(&lineOut[y], vshrq(vec, 4), p0);
+    }
+    lineOut[0] = arm_cv_canny_gaussian_pixel(vertSum, 0, width, borderType);
+    lineOut[width - 1] = arm_cv_canny_gaussian_pixel(vertSum, width - 1, width, borderType);
+}
+
+static void arm_cv_canny_gradient_line(const uint8_t *lineTop, const uint8_t *lineMid, const uint8_t *lineBot,
+                                       int width, arm_cv_gradient_q15_t *gradOut, q15_t *magOut, const uint8_t flags)
+{
+    int y = 1;
+    for (; y < width - ELTS_PER_VECT_16; y += ELTS_PER_VECT_16)
+    {
+        int16x8_t vect_top_l = vreinterpretq_s16_u16(vldrbq_u16(&lineTop[y - 1]));
+        int16x8_t vect_top_m = vreinterpretq_s16_u16(vldrbq_u16(&lineTop[y]));
+        int16x8_t vect_top_r = vreinterpretq_s16_u16(vldrbq_u16(&lineTop[y + 1]));
+        int16x8_t vect_bot_l = vreinterpretq_s16_u16(vldrbq_u16(&lineBot[y - 1]));
+        int16x8_t vect_bot_m = vreinterpretq_s16_u16(vldrbq_u16(&lineBot[y]));
+        int16x8_t vect_bot_r = vreinterpretq_s16_u16(vldrbq_u16(&lineBot[y + 1]));
+        int16x8_t vect_mid_l = vreinterpretq_s16_u16(vldrbq_u16(&lineMid[y - 1]));
+        int16x8_t vect_mid_r = vreinterpretq_s16_u16(vldrbq_u16(&lineMid[y + 1]));
+
+        // Difference of the horizontal [1,2,1] kernels of the lines above and below
+        int16x8_t vect_gradx = vsubq(vaddq(vect_top_l, vect_top_r), vaddq(vect_bot_l, vect_bot_r));
+        vect_gradx = vaddq(vect_gradx, vshlq_n_s16(vsubq(vect_top_m, vect_bot_m), 1));
+        vect_gradx = vshlq_n_s16(vect_gradx, 5);
+        // Difference of the vertical [1,2,1] kernels of the columns on the left and on the right
+        int16x8_t vect_grady = vsubq(vaddq(vect_top_l, vect_bot_l), vaddq(vect_top_r, vect_bot_r));
+        vect_grady = vaddq(vect_grady, vshlq_n_s16(vsubq(vect_mid_l, vect_mid_r), 1));
+        vect_grady = vshlq_n_s16(vect_grady, 5);
+
+        int16x8x2_t vect_grad;
+        vect_grad.val[0] = vect_gradx;
+        vect_grad.val[1] = vect_grady;
+        vst2q(&gradOut[y].x, vect_grad);
+
+        if (flags & ARM_CV_CANNY_L1_GRADIENT)
+        {
+            vst1q(&magOut[y], vqaddq(vabsq(vect_gradx), vabsq(vect_grady)));
+            continue;
+        }
+        q31x4_t vect_sq_b = vaddq(vmullbq_int(vect_gradx, vect_gradx), vmullbq_int(vect_grady, vect_grady));
+        q31x4_t vect_sq_t = vaddq(vmulltq_int(vect_gradx, vect_gradx), vmulltq_int(vect_grady, vect_grady));
+        vect_sq_b = vshrq(vect_sq_b, 1);
+        vect_sq_t = vshrq(vect_sq_t, 1);
+        int16x8_t vect_mag;
+        for (int j = 0; j < ELTS_PER_VECT_16; j++)
+        {
+            if (vect_gradx[j] == 0 && vect_grady[j] == 0)
+            {
+                vect_mag[j] = 0;
+                continue;
+            }
+            q31_t root;
+            arm_sqrt_q31((j & 1) ? vect_sq_t[j >> 1] : vect_sq_b[j >> 1], &root);
+            vect_mag[j] = Q31_TO_Q15(root);
+        }
+        vst1q(&magOut[y], vect_mag);
+    }
+    // Tail
+    for (; y < width - 1; y++)
+    {
+        arm_cv_canny_gradient_pixel(lineTop, lineMid, lineBot, y, gradOut, magOut, flags);
+    }
+    magOut[0] = 0;
+    magOut[width - 1] = 0;
+}
+#else
+static void arm_cv_canny_gaussian_line(const uint8_t *dataIn, int width, int strideIn, int height, int firstRowIn,
+                                       int row, const int8_t borderType, uint16_t *vertSum, uint8_t *lineOut)
+{
+    const uint8_t *dataTop = &dataIn[(arm_cv_border_index(row - 1, height, borderType) - firstRowIn) * strideIn];
+    const uint8_t *dataMid = &dataIn[(row - firstRowIn) * strideIn];
+    const uint8_t *dataBot = &dataIn[(arm_cv_border_index(row + 1, height, borderType) - firstRowIn) * strideIn];
+
+    // Vertical [1,2,1] kernel
+    for (int y = 0; y < width; y++)
+    {
+        vertSum[y] = dataTop[y] + (dataMid[y] << 1) + dataBot[y];
+    }
+    // Horizontal [1,2,1] kernel
+    for (int y = 1; y < width - 1; y++)
+    {
+        lineOut[y] = (vertSum[y - 1] + (vertSum[y] << 1) + vertSum[y + 1]) >> 4;
+    }
+    lineOut[0] = arm_cv_canny_gaussian_pixel(vertSum, 0, width, borderType);
+    lineOut[width - 1] = arm_cv_canny_gaussian_pixel(vertSum, width - 1, width, borderType);
+}
+
+static void arm_cv_canny_gradient_line(const uint8_t *lineTop, const uint8_t *lineMid, const uint8_t *lineBot,
+                                       int width, arm_cv_gradient_q15_t *gradOut, q15_t *magOut, const uint8_t flags)
+{
+    for (int y = 1; y < width - 1; y++)
+    {
+        arm_cv_canny_gradient_pixel(lineTop, lineMid, lineBot, y, gradOut, magOut, flags);
+    }
+    magOut[0] = 0;
+    magOut[width - 1] = 0;
+}
+#endif
+
+// Label of the pixels above the low threshold waiting to be connected to a strong edge
+#define WEAK_EDGE 1
+
+// Directions of the gradient, in the order of arm_cv_canny_nms_offsets
+#define CANNY_VERTICAL 0
+#define CANNY_DIAGONAL_45 1
+#define CANNY_HORIZONTAL 2
+#define CANNY_DIAGONAL_135 3
+
+// Line and column offsets of the two neighbors compared in the non maximum suppression,
+// same neighbors as the helpers of the DECISION macro
+static const int8_t arm_cv_canny_nms_offsets[4][4] = {{0, -1, 0, 1}, {1, -1, -1, 1}, {-1, 0, 1, 0}, {-1, -1, 1, 1}};
+
+// Bounded stack of the pixels to trace. When it is full, the pixel is still marked as an edge and
+// the tracing of its neighbors is done at the end of the image
+typedef struct
+{
+    uint32_t *pData;
+    uint32_t size;
+    uint32_t nb;
+    int overflow;
+} arm_cv_canny_stack_t;
+
+// Direction of the gradient, same result as THRESHOLDING_HYSTERESIS or THRESHOLDING_HYSTERESIS_OCTANT
+__STATIC_FORCEINLINE int arm_cv_canny_direction(q15_t gradx, q15_t grady, const uint8_t flags)
+{
+    if (flags & ARM_CV_CANNY_OCTANT_DIRECTION)
+    {
+        if (abs(gradx) <= MUL_TAN_22_5(abs(grady)))
+        {
+            return (CANNY_VERTICAL);
+        }
+        if (abs(grady) <= MUL_TAN_22_5(abs(gradx)))
+        {
+            return (CANNY_HORIZONTAL);
+        }
+        return (((gradx ^ grady) >= 0) ? CANNY_DIAGONAL_135 : CANNY_DIAGONAL_45);
+    }
+    q15_t angle;
+    arm_atan2_q15(gradx, grady, &angle);
+    arm_abs_q15(&angle, &angle, 1);
+    if (angle < DEG_TO_RAD_Q2_13(22))
+    {
+        return (CANNY_VERTICAL);
+    }
+    if (angle < DEG_TO_RAD_Q2_13(67))
+    {
+        return (CANNY_DIAGONAL_45);
+    }
+    if (angle < DEG_TO_RAD_Q2_13(112))
+    {
+        return (CANNY_HORIZONTAL);
+    }
+    if (angle < DEG_TO_RAD_Q2_13(160))
+    {
+        return (CANNY_DIAGONAL_135);
+    }
+    return (CANNY_VERTICAL);
+}
+
+// Non maximum suppression of the line row. The pixels are labeled as strong (Q8_ONE) or weak (WEAK_EDGE) edges
+// for the edge tracking. The neighbors compared along the gradient are the same as in the DECISION macros
+static void arm_cv_canny_label_line(int row, int width, const q15_t *dataMag, const arm_cv_gradient_q15_t *dataGrad,
+                                    uint8_t *dataOut, q31_t lowThreshold, q31_t highThreshold, const uint8_t flags)
+{
+    const q15_t *lineMag = &dataMag[(row % NB_LINE_BUF) * width];
+    const arm_cv_gradient_q15_t *lineGrad = &dataGrad[(row % NB_LINE_BUF) * width];
+
+    for (int y = 1; y < width - 1; y++)
+    {
+        int mag = lineMag[y];
+        if (mag < lowThreshold)
+        {
+            dataOut[y] = 0;
+            continue;
+        }
+        const int8_t *offs = arm_cv_canny_nms_offsets[arm_cv_canny_direction(lineGrad[y].x, lineGrad[y].y, flags)];
+        if (mag <= dataMag[((row + offs[0]) % NB_LINE_BUF) * width + y + offs[1]] ||
+            mag <= dataMag[((row + offs[2]) % NB_LINE_BUF) * width + y + offs[3]])
+        {
+            dataOut[y] = 0;
+            continue;
+        }
+        dataOut[y] = (mag < highThreshold) ? WEAK_EDGE : Q8_ONE;
+    }
+}
+
+// Non maximum suppression and hysteresis of the line row, using the angle of the gradient.
+// The magnitudes of the lines row - 1, row and row + 1 are in the circular buffer
+static void arm_cv_canny_decision_line_angle(int row, int width, const q15_t *dataMag,
+                                             const arm_cv_gradient_q15_t *dataGrad, uint8_t *dataOut,
+                                             q31_t lowThreshold, q31_t highThreshold)
+{
+    // The DECISION macros are written relatively to the line being computed, two lines below
+    const int x = row + 2;
+    const q15_t *lineMag = &dataMag[(row % NB_LINE_BUF) * width];
+    const arm_cv_gradient_q15_t *lineGrad = &dataGrad[(row % NB_LINE_BUF) * width];
+
+    for (int y = 1; y < width - 1; y++)
+    {
+        int mag = lineMag[y];
+        if (mag < lowThreshold)
+        {
+            dataOut[y] = 0;
+            continue;
+        }
+        q15_t angle;
+        arm_atan2_q15(lineGrad[y].x, lineGrad[y].y, &angle);
+        arm_abs_q15(&angle, &angle, 1);
+        THRESHOLDING_HYSTERESIS(angle, highThreshold, width, dataMag, dataOut, y, mag, x, y)
+    }
+}
+
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+// Non maximum suppression and hysteresis of the line row, using the octant of the gradient.
+// The decision of the DECISION macros is computed for the 4 directions with vector compares
+// and the result is selected with the octant of each lane
+static void arm_cv_canny_decision_line_octant(int row, int width, const q15_t *dataMag,
+                                              const arm_cv_gradient_q15_t *dataGrad, uint8_t *dataOut,
+                                              q15_t lowThreshold, q15_t highThreshold, const uint8_t flags)
+{
+    const q15_t *magTop = &dataMag[((row - 1) % NB_LINE_BUF) * width];
+    const q15_t *magMid = &dataMag[(row % NB_LINE_BUF) * width];
+    const q15_t *magBot = &dataMag[((row + 1) % NB_LINE_BUF) * width];
+    const arm_cv_gradient_q15_t *lineGrad = &dataGrad[(row % NB_LINE_BUF) * width];
+    // Offsets of the x (or y) members of the gradients, in q15
+    const uint16x8_t vect_offs = vidupq_n_u16(0, 2);
+
+    for (int y = 1; y < width - 1; y += ELTS_PER_VECT_16)
+    {
+        mve_pred16_t p0 = vctp16q(width - 1 - y);
+        int16x8_t vect_gradx = vldrhq_gather_shifted_offset_z_s16(&lineGrad[y].x, vect_offs, p0);
+        int16x8_t vect_grady = vldrhq_gather_shifted_offset_z_s16(&lineGrad[y].y, vect_offs, p0);
+        int16x8_t vect_mag = vldrhq_z_s16(&magMid[y], p0);
+
+        // Octant of the gradient
+        int16x8_t vect_absx = vabsq(vect_gradx);
+        int16x8_t vect_absy = vabsq(vect_grady);
+        mve_pred16_t p_vert = vcmpleq(vect_absx, vqdmulhq_n_s16(vect_absy, TAN_22_5_Q15));
+        mve_pred16_t p_hori = vcmpleq(vect_absy, vqdmulhq_n_s16(vect_absx, TAN_22_5_Q15)) & ~p_vert;
+        mve_pred16_t p_diag = ~(p_vert | p_hori);
+        mve_pred16_t p_diag_135 = vcmpgeq_n_s16(veorq(vect_gradx, vect_grady), 0) & p_diag;
+        mve_pred16_t p_diag_45 = p_diag & ~p_diag_135;
+
+        int16x8_t vect_tl = vldrhq_z_s16(&magTop[y - 1], p0);
+        int16x8_t vect_tc = vldrhq_z_s16(&magTop[y], p0);
+        int16x8_t vect_tr = vldrhq_z_s16(&magTop[y + 1], p0);
+        int16x8_t vect_ml = vldrhq_z_s16(&magMid[y - 1], p0);
+        int16x8_t vect_mr = vldrhq_z_s16(&magMid[y + 1], p0);
+        int16x8_t vect_bl = vldrhq_z_s16(&magBot[y - 1], p0);
+        int16x8_t vect_bc = vldrhq_z_s16(&magBot[y], p0);
+        int16x8_t vect_br = vldrhq_z_s16(&magBot[y + 1], p0);
+
+        // Non maximum suppression along the gradient
+        mve_pred16_t p_suppr = (p_vert & (vcmpleq(vect_mag, vect_ml) | vcmpleq(vect_mag, vect_mr))) |
+                               (p_hori & (vcmpleq(vect_mag, vect_tc) | vcmpleq(vect_mag, vect_bc))) |
+                               (p_diag_45 & (vcmpleq(vect_mag, vect_bl) | vcmpleq(vect_mag, vect_tr))) |
+                               (p_diag_135 & (vcmpleq(vect_mag, vect_tl) | vcmpleq(vect_mag, vect_br)));
+
+        mve_pred16_t p_edge = vcmpgeq_n_s16(vect_mag, lowThreshold) & ~p_suppr;
+        mve_pred16_t p_high = vcmpgeq_n_s16(vect_mag, highThreshold);
+        uint16x8_t vect_out;
+        if (flags & ARM_CV_CANNY_FULL_HYSTERESIS)
+        {
+            // Labels used by the edge tracking
+            vect_out = vdupq_m_n_u16(vdupq_n_u16(0), WEAK_EDGE, p_edge);
+            vect_out = vdupq_m_n_u16(vect_out, Q8_ONE, p_edge & p_high);
+            vstrbq_p_u16(&dataOut[y], vect_out, p0);
+            continue;
+        }
+
+        // Hysteresis with the same neighbors as the DECISION macros
+        mve_pred16_t p_tl = vcmpgeq_n_s16(vect_tl, highThreshold);
+        mve_pred16_t p_tc = vcmpgeq_n_s16(vect_tc, highThreshold);
+        mve_pred16_t p_tr = vcmpgeq_n_s16(vect_tr, highThreshold);
+        mve_pred16_t p_ml = vcmpgeq_n_s16(vect_ml, highThreshold);
+        mve_pred16_t p_mr = vcmpgeq_n_s16(vect_mr, highThreshold);
+        mve_pred16_t p_bl = vcmpgeq_n_s16(vect_bl, highThreshold);
+        mve_pred16_t p_bc = vcmpgeq_n_s16(vect_bc, highThreshold);
+        mve_pred16_t p_br = vcmpgeq_n_s16(vect_br, highThreshold);
+        mve_pred16_t p_strong = (p_vert & (p_tl | p_tc | p_tr | p_bl | p_bc | p_br)) |
+                                (p_hori & (p_tl | p_ml | p_mr | p_br)) |
+                                (p_diag & (p_tl | p_tc | p_ml | p_mr | p_bc | p_br));
+        p_strong |= p_high;
+
+        vect_out = vdupq_m_n_u16(vdupq_n_u16(0), Q8_ONE, p_edge & p_strong);
+        vstrbq_p_u16(&dataOut[y], vect_out, p0);
+    }
+}
+#else
+// Non maximum suppression and hysteresis of the line row, using the octant of the gradient.
+// The magnitudes of the lines row - 1, row and row + 1 are in the circular buffer
+static void arm_cv_canny_decision_line_octant(int row, int width, const q15_t *dataMag,
+                                              const arm_cv_gradient_q15_t *dataGrad, uint8_t *dataOut,
+                                              q15_t lowThreshold, q15_t highThreshold, const uint8_t flags)
+{
+    // The DECISION macros are written relatively to the line being computed, two lines below
+    const int x = row + 2;
+    const q15_t *lineMag = &dataMag[(row % NB_LINE_BUF) * width];
+    const arm_cv_gradient_q15_t *lineGrad = &dataGrad[(row % NB_LINE_BUF) * width];
+
+    if (flags & ARM_CV_CANNY_FULL_HYSTERESIS)
+    {
+        arm_cv_canny_label_line(row, width, dataMag, dataGrad, dataOut, lowThreshold, highThreshold, flags);
+        return;
+    }
+    for (int y = 1; y < width - 1; y++)
+    {
+        int mag = lineMag[y];
+        if (mag < lowThreshold)
+        {
+            dataOut[y] = 0;
+            continue;
+        }
+        THRESHOLDING_HYSTERESIS_OCTANT(lineGrad[y].x, lineGrad[y].y, highThreshold, width, dataMag, dataOut, y, mag,
+                                       x, y)
+    }
+}
+#endif
+
+__STATIC_FORCEINLINE void arm_cv_canny_push_edge(arm_cv_canny_stack_t *stack, uint8_t *dataOut, uint32_t idx)
+{
+    dataOut[idx] = Q8_ONE;
+    if (stack->nb < stack->size)
+    {
+        stack->pData[stack->nb++] = idx;
+    }
+    else
+    {
+        stack->overflow = 1;
+    }
+}
+
+// Promote the weak pixels connected to the pixels of the stack. Only the lines up to lastRow are labeled
+static void arm_cv_canny_trace_edges(arm_cv_canny_stack_t *stack, uint8_t *dataOut, int stride, int lastRow)
+{
+    while (stack->nb > 0)
+    {
+        uint32_t idx = stack->pData[--stack->nb];
+        int row = idx / stride;
+        int rowEnd = (row < lastRow) ? 1 : 0;
+        // The first and last columns and the first line are never labeled
+        for (int i = -1; i <= rowEnd; i++)
+        {
+            uint32_t n = idx + i * stride;
+            for (int j = -1; j <= 1; j++)
+            {
+                if (dataOut[n + j] == WEAK_EDGE)
+                {
+                    arm_cv_canny_push_edge(stack, dataOut, n + j);
+                }
+            }
+        }
+    }
+}
+
+// Edge tracking of the line row once it is labeled. The lines above are already tracked so the weak pixels are
+// promoted by the strong edges of the line row and by the edges of the line above
+static void arm_cv_canny_track_line(arm_cv_canny_stack_t *stack, uint8_t *dataOut, int width, int stride, int row)
+{
+    uint8_t *line = &dataOut[row * stride];
+    const uint8_t *lineAbove = line - stride;
+
+    for (int y = 1; y < width - 1; y++)
+    {
+        if (line[y] == Q8_ONE)
+        {
+            arm_cv_canny_push_edge(stack, dataOut, row * stride + y);
+        }
+        else if (line[y] == WEAK_EDGE &&
+                 (lineAbove[y - 1] == Q8_ONE || lineAbove[y] == Q8_ONE || lineAbove[y + 1] == Q8_ONE))
+        {
+            arm_cv_canny_push_edge(stack, dataOut, row * stride + y);
+        }
+        arm_cv_canny_trace_edges(stack, dataOut, stride, row);
+    }
+}
+
+__STATIC_FORCEINLINE int arm_cv_canny_has_edge_neighbor(const uint8_t *dataOut, int idx, int stride)
+{
+    return (dataOut[idx - stride - 1] == Q8_ONE || dataOut[idx - stride] == Q8_ONE ||
+            dataOut[idx - stride + 1] == Q8_ONE || dataOut[idx - 1] == Q8_ONE || dataOut[idx + 1] == Q8_ONE ||
+            dataOut[idx + stride - 1] == Q8_ONE || dataOut[idx + stride] == Q8_ONE ||
+            dataOut[idx + stride + 1] == Q8_ONE);
+}
+
+// Remove the weak labels of blkCnt consecutive pixels
+static void arm_cv_canny_clear_weak(uint8_t *pOut, int32_t blkCnt)
+{
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+    while (blkCnt > 0)
+    {
+        mve_pred16_t p0 = vctp8q(blkCnt);
+        uint8x16_t vect = vldrbq_z_u8(pOut, p0);
+        vect = vdupq_m_n_u8(vect, 0, vcmpeqq_n_u8(vect, WEAK_EDGE));
+        vstrbq_p_u8(pOut, vect, p0);
+        pOut += 16;
+        blkCnt -= 16;
+    }
+#else
+    for (int32_t i = 0; i < blkCnt; i++)
+    {
+        if (pOut[i] == WEAK_EDGE)
+        {
+            pOut[i] = 0;
+        }
+    }
+#endif
+}
+
+// End of the edge tracking. When the stack has been full, the weak pixels connected to the edges are promoted
+// by scanning the image forward and backward until there is no change. The remaining weak pixels are removed.
+// Only the columns of the image are scanned so the padding at the end of the rows is never modified
+static void arm_cv_canny_finish_tracking(const arm_cv_canny_stack_t *stack, uint8_t *dataOut, int width, int stride,
+                                         int height)
+{
+    if (stack->overflow)
+    {
+        int changed;
+        do
+        {
+            changed = 0;
+            for (int row = 1; row < height - 1; row++)
+            {
+                for (int idx = row * stride + 1; idx < row * stride + width - 1; idx++)
+                {
+                    if (dataOut[idx] == WEAK_EDGE && arm_cv_canny_has_edge_neighbor(dataOut, idx, stride))
+                    {
+                        dataOut[idx] = Q8_ONE;
+                        changed = 1;
+                    }
+                }
+            }
+            for (int row = height - 2; row > 0; row--)
+            {
+                for (int idx = row * stride + width - 2; idx > row * stride; idx--)
+                {
+                    if (dataOut[idx] == WEAK_EDGE && arm_cv_canny_has_edge_neighbor(dataOut, idx, stride))
+                    {
+                        dataOut[idx] = Q8_ONE;
+                        changed = 1;
+                    }
+                }
+            }
+        } while (changed);
+    }
+
+    if (stride == width)
+    {
+        arm_cv_canny_clear_weak(&dataOut[width], (height - 2) * width);
+        return;
+    }
+    for (int row = 1; row < height - 1; row++)
+    {
+        arm_cv_canny_clear_weak(&dataOut[row * stride], width);
+    }
+}
+
+// Non maximum suppression and hysteresis of the line row.
+// The magnitudes of the lines row - 1, row and row + 1 are in the circular buffer
+static void arm_cv_canny_decision_line(int row, int width, const q15_t *dataMag, const arm_cv_gradient_q15_t *dataGrad,
+                                       uint8_t *dataOut, q31_t lowThreshold, q31_t highThreshold, const uint8_t flags)
+{
+    dataOut[0] = 0;
+    if (flags & ARM_CV_CANNY_OCTANT_DIRECTION)
+    {
+        arm_cv_canny_decision_line_octant(row, width, dataMag, dataGrad, dataOut, lowThreshold, highThreshold, flags);
+    }
+    else if (flags & ARM_CV_CANNY_FULL_HYSTERESIS)
+    {
+        arm_cv_canny_label_line(row, width, dataMag, dataGrad, dataOut, lowThreshold, highThreshold, flags);
+    }
+    else
+    {
+        arm_cv_canny_decision_line_angle(row, width, dataMag, dataGrad, dataOut, lowThreshold, highThreshold);
+    }
+    dataOut[width - 1] = 0;
+}
+
+// Canny edge computed line by line. When smooth is not 0, each line is first smoothed with the 3x3 gaussian
+// in a circular buffer. Otherwise, the lines of the input image are used directly.
+// With the full hysteresis, each labeled line is tracked with the stack.
+// When strip is not NULL, only the rows of the strip are written and imageIn starts at the first row
+// needed by the strip. The lines above the strip are computed again to fill the circular buffers
+static void arm_cv_canny_edge_lines(const arm_cv_image_gray8_t *imageIn, arm_cv_image_gray8_t *imageOut,
+                                    const arm_cv_strip_t *strip, q15_t *scratch, uint8_t lowThreshold,
+                                    uint8_t highThreshold, const int8_t borderType, const uint8_t flags,
+                                    const int smooth, uint32_t *stackBuf, uint32_t stackSize)
+{
+    const int width = imageIn->width;
+    const int strideIn = ARM_CV_IMAGE_STRIDE(imageIn, 1);
+    const int strideOut = ARM_CV_IMAGE_STRIDE(imageOut, 1);
+    const int height = strip ? strip->frameHeight : imageIn->height;
+    const int firstRow = strip ? strip->firstRow : 0;
+    const int lastRow = firstRow + imageOut->height - 1;
+    // First line of the circular buffer and first row of the input image
+    const int firstLine = firstRow > 2 ? firstRow - 2 : 0;
+    const int firstRowIn = (smooth && firstLine > 0) ? firstLine - 1 : firstLine;
+    const int lastLine = lastRow + 2 < height ? lastRow + 2 : height - 1;
+    q31_t low_threshold = U8_TO_Q2_13(lowThreshold);
+    q31_t high_threshold = U8_TO_Q2_13(highThreshold);
+    q15_t *data_mag = scratch;
+    arm_cv_gradient_q15_t *data_grad = (arm_cv_gradient_q15_t *)&scratch[NB_LINE_BUF * width];
+    uint16_t *vert_sum = (uint16_t *)&scratch[3 * NB_LINE_BUF * width];
+    uint8_t *data_smooth = (uint8_t *)&scratch[(3 * NB_LINE_BUF + 1) * width];
+    uint8_t *data_out = imageOut->pData;
+    const uint8_t *lines[NB_LINE_BUF];
+    // Without a stack, the edges are only traced at the end by scanning the output image
+    arm_cv_canny_stack_t stack = {stackBuf, stackSize, 0, (stackBuf == NULL || stackSize == 0)};
+    const int trackLines = (flags & ARM_CV_CANNY_FULL_HYSTERESIS) && !stack.overflow;
+
+    if (width < 3 || height < 3)
+    {
+        // Only border pixels
+        for (int row = 0; row < imageOut->height; row++)
+        {
+            memset(&data_out[row * strideOut], 0, width);
+        }
+        return;
+    }
+    // The magnitude of the first line is 0
+    memset(data_mag, 0, NB_LINE_BUF * width * sizeof(q15_t));
+    if (firstRow == 0)
+    {
+        memset(data_out, 0, width);
+    }
+
+    for (int x = firstLine; x <= lastLine; x++)
+    {
+        if (smooth)
+        {
+            lines[x % NB_LINE_BUF] = &data_smooth[(x % NB_LINE_BUF) * width];
+            arm_cv_canny_gaussian_line(imageIn->pData, width, strideIn, height, firstRowIn, x, borderType, vert_sum,
+                                       &data_smooth[(x % NB_LINE_BUF) * width]);
+        }
+        else
+        {
+            lines[x % NB_LINE_BUF] = &imageIn->pData[(x - firstRowIn) * strideIn];
+        }
+        if (x < firstLine + 2)
+        {
+            continue;
+        }
+        // Gradient of the line x - 1
+        arm_cv_canny_gradient_line(lines[(x - 2) % NB_LINE_BUF], lines[(x - 1) % NB_LINE_BUF], lines[x % NB_LINE_BUF],
+                                   width, &data_grad[((x - 1) % NB_LINE_BUF) * width],
+                                   &data_mag[((x - 1) % NB_LINE_BUF) * width], flags);
+        if (x > 2 && x - 2 >= firstRow)
+        {
+            arm_cv_canny_decision_line(x - 2, width, data_mag, data_grad, &data_out[(x - 2 - firstRow) * strideOut],
+                                       low_threshold, high_threshold, flags);
+            if (trackLines)
+            {
+                arm_cv_canny_track_line(&stack, data_out, width, strideOut, x - 2);
+            }
+        }
+    }
+    if (lastLine < height - 1)
+    {
+        return;
+    }
+    // The magnitude of the last line is 0
+    memset(&data_mag[((height - 1) % NB_LINE_BUF) * width], 0, width * sizeof(q15_t));
+    // lastLine is also height - 1 when the strip ends at the row height - 3 or height - 2
+    if (height - 2 >= firstRow && height - 2 <= lastRow)
+    {
+        arm_cv_canny_decision_line(height - 2, width, data_mag, data_grad,
+                                   &data_out[(height - 2 - firstRow) * strideOut], low_threshold, high_threshold,
+                                   flags);
+        if (trackLines)
+        {
+            arm_cv_canny_track_line(&stack, data_out, width, strideOut, height - 2);
+        }
+    }
+    if (lastRow == height - 1)
+    {
+        memset(&data_out[(height - 1 - firstRow) * strideOut], 0, width);
+    }
+    if (flags & ARM_CV_CANNY_FULL_HYSTERESIS)
+    {
+        arm_cv_canny_finish_tracking(&stack, data_out, width, strideOut, height);
+    }
+}
+
+/**
+  @ingroup featureDetection
+ */
+
+/**
+ * @brief      Canny edge with sobel integrated and options
+ *
+ * @param[in]     imageIn         The input image
+ * @param[out]    imageOut        The output image
+ * @param[in,out] scratch         Temporary buffer
+ * @param[in]     lowThreshold    The low threshold
+ * @param[in]     highThreshold   The high threshold
+ * @param[in]     flags           Combination of ARM_CV_CANNY_* options
+ *
+ * @par Options
+ *
+ * With ARM_CV_CANNY_OCTANT_DIRECTION, the direction of the gradient is given by comparing |gx| and |gy|
+ * scaled by tan(22.5 deg) in fixed point instead of computing the angle with arm_atan2_q15. The diagonal is
+ * selected with the sign of gx * gy, so a gradient and its opposite use the same neighbors like in OpenCV.
+ * The default mode folds the angle with its absolute value and the diagonal only depends on the sign of gy.
+ * The two modes select different diagonals when gx > 0, and the limits of the default mode
+ * are 22, 67, 112 and 160 degrees instead of multiples of 22.5 degrees.
+ * With Helium, the non maximum suppression and the hysteresis are then fully computed in vector lanes.
+ *
+ * With ARM_CV_CANNY_L1_GRADIENT, the magnitude of the gradient is |gx| + |gy| instead of
+ * sqrt(gx^2 + gy^2), like OpenCV with L2gradient set to false. It is saturated to q15.
+ *
+ * With ARM_CV_CANNY_FULL_HYSTERESIS, the weak pixels connected to a strong pixel by a chain of weak pixels
+ * are kept. This function has no stack so the edges are only traced at the end, by scanning the output image
+ * forward and backward until there is no change. It can take many passes on a large image,
+ * arm_cv_canny_edge_sobel_hysteresis with a stack gives the same result in a single pass.
+ *
+ * The image is processed line by line and the borders of the output image are set to 0.
+ *
+ * @par  Temporary buffer sizing:
+ *
+ * Will use a temporary buffer to store intermediate values of gradient and magnitude.
+ *
+ * Size of temporary buffer is given by
+ * arm_cv_get_scratch_size_canny_sobel(int width)
+ */
+void arm_cv_canny_edge_sobel_flags(const arm_cv_image_gray8_t *imageIn, arm_cv_image_gray8_t *imageOut,
+                                   q15_t *scratch, uint8_t lowThreshold, uint8_t highThreshold, const uint8_t flags)
+{
+    arm_cv_canny_edge_lines(imageIn, imageOut, NULL, scratch, lowThreshold, highThreshold, ARM_CV_BORDER_NEAREST,
+                            flags, 0, NULL, 0);
+}
+
+/**
+  @ingroup featureDetection
+ */
+
+/**
+ * @brief      Canny edge with the 3x3 gaussian and sobel integrated
+ *
+ * @param[in]     imageIn         The input image
+ * @param[out]    imageOut        The output image
+ * @param[in,out] scratch         Temporary buffer
+ * @param[in]     lowThreshold    The low threshold
+ * @param[in]     highThreshold   The high threshold
+ * @param[in]     borderType      Type of border used by the gaussian, supported are Nearest, Wrap and Reflect
+ * @param[in]     flags           Combination of ARM_CV_CANNY_* options, see arm_cv_canny_edge_sobel_flags
+ *
+ * @par Algorithm
+ *
+ * Each line of the input is smoothed with the same kernel as arm_gaussian_filter_3x3_fixp when it
+ * is needed by the sobel. Only the three last smoothed lines are kept in a circular buffer
+ * so there is no need for a full frame intermediate image.
+ * The borders of the output image are set to 0.
+ *
+ * @par  Temporary buffer sizing:
+ *
+ * Will use a temporary buffer to store the smoothed lines and the intermediate values of gradient and magnitude.
+ *
+ * Size of temporary buffer is given by
+ * arm_cv_get_scratch_size_canny_gaussian_sobel(int width)
+ */
+void arm_cv_canny_edge_gaussian_sobel(const arm_cv_image_gray8_t *imageIn, arm_cv_image_gray8_t *imageOut,
+                                      q15_t *scratch, uint8_t lowThreshold, uint8_t highThreshold,
+                                      const int8_t borderType, const uint8_t flags)
+{
+    arm_cv_canny_edge_lines(imageIn, imageOut, NULL, scratch, lowThreshold, highThreshold, borderType, flags, 1, NULL,
+                            0);
+}
+
+/**
+  @ingroup featureDetection
+ */
+
+/**
+ * @brief      Canny edge with sobel integrated and the full hysteresis
+ *
+ * @param[in]     imageIn         The input image
+ * @param[out]    imageOut        The output image
+ * @param[in,out] scratch         Temporary buffer
+ * @param[in]     lowThreshold    The low threshold
+ * @param[in]     highThreshold   The high threshold
+ * @param[in]     flags           Combination of ARM_CV_CANNY_* options, see arm_cv_canny_edge_sobel_flags
+ * @param[in,out] stack           Buffer of the edge tracking
+ * @param[in]     stackSize       Number of elements of the stack
+ *
+ * @par Algorithm
+ *
+ * The edges are always tracked through the whole image: ARM_CV_CANNY_FULL_HYSTERESIS is implied,
+ * it can be omitted from flags and it has no other effect. The weak pixels are kept if they are connected
+ * to a strong pixel by a chain of weak pixels, like OpenCV.
+ * The edges are traced with the stack just after the non maximum suppression of each line, so the
+ * image is processed in a single pass and only the labels of the output image are read again.
+ *
+ * @par  Stack sizing:
+ *
+ * A stack of 2 * width elements is enough for most images. When the stack is full, the result
+ * is the same but the remaining tracing is done by scanning the output image at the end.
+ * The stack can be NULL with a stackSize of 0, then the whole tracing is done by this scan.
+ *
+ * @par  Temporary buffer sizing:
+ *
+ * Size of temporary buffer is given by
+ * arm_cv_get_scratch_size_canny_sobel(int width)
+ */
+void arm_cv_canny_edge_sobel_hysteresis(const arm_cv_image_gray8_t *imageIn, arm_cv_image_gray8_t *imageOut,
+                                        q15_t *scratch, uint8_t lowThreshold, uint8_t highThreshold,
+                                        const uint8_t flags, uint32_t *stack, uint32_t stackSize)
+{
+    arm_cv_canny_edge_lines(imageIn, imageOut, NULL, scratch, lowThreshold, highThreshold, ARM_CV_BORDER_NEAREST,
+                            flags | ARM_CV_CANNY_FULL_HYSTERESIS, 0, stack, stackSize);
+}
+
+/**
+  @ingroup featureDetection
+ */
+
+/**
+ * @brief      Canny edge with the 3x3 gaussian and sobel integrated and the full hysteresis
+ *
+ * @param[in]     imageIn         The input image
+ * @param[out]    imageOut        The output image
+ * @param[in,out] scratch         Temporary buffer
+ * @param[in]     lowThreshold    The low threshold
+ * @param[in]     highThreshold   The high threshold
+ * @param[in]     borderType      Type of border used by the gaussian, supported are Nearest, Wrap and Reflect
+ * @param[in]     flags           Combination of ARM_CV_CANNY_* options, see arm_cv_canny_edge_sobel_flags
+ * @param[in,out] stack           Buffer of the edge tracking
+ * @param[in]     stackSize       Number of elements of the stack
+ *
+ * @par Algorithm
+ *
+ * Same as arm_cv_canny_edge_gaussian_sobel with the edge tracking of arm_cv_canny_edge_sobel_hysteresis.
+ *
+ * @par  Temporary buffer sizing:
+ *
+ * Size of temporary buffer is given by
+ * arm_cv_get_scratch_size_canny_gaussian_sobel(int width)
+ */
+void arm_cv_canny_edge_gaussian_sobel_hysteresis(const arm_cv_image_gray8_t *imageIn, arm_cv_image_gray8_t *imageOut,
+                                                 q15_t *scratch, uint8_t lowThreshold, uint8_t highThreshold,
+                                                 const int8_t borderType, const uint8_t flags, uint32_t *stack,
+                                                 uint32_t stackSize)
+{
+    arm_cv_canny_edge_lines(imageIn, imageOut, NULL, scratch, lowThreshold, highThreshold, borderType,
+                            flags | ARM_CV_CANNY_FULL_HYSTERESIS, 1, stack, stackSize);
+}
+
+/**
+  @ingroup featureDetection
+ */
+
+/**
+ * @brief      Canny edge with sobel integrated on a strip of the image
+ *
+ * @param[in]     imageIn         The rows of the input image needed by the strip
+ * @param[out]    imageOut        The rows of the strip in the output image
+ * @param[in]     strip           The position of the strip in the image
+ * @param[in,out] scratch         Temporary buffer
+ * @param[in]     lowThreshold    The low threshold
+ * @param[in]     highThreshold   The high threshold
+ * @param[in]     flags           Combination of ARM_CV_CANNY_* options, see arm_cv_canny_edge_sobel_flags
+ *
+ * @par Strip processing
+ *
+ * The output rows are the same as the rows computed by arm_cv_canny_edge_sobel_flags on the full image.
+ * imageIn starts at the row given by arm_cv_get_strip_first_input_row with the radius
+ * ARM_CV_STRIP_RADIUS_CANNY_SOBEL and contains the number of rows given by arm_cv_get_strip_nb_input_rows.
+ * The two lines of gradients above the strip are computed again for each strip.
+ *
+ * @par Hysteresis
+ *
+ * The hysteresis is local, like arm_cv_canny_edge_sobel_flags without ARM_CV_CANNY_FULL_HYSTERESIS:
+ * a pixel above the low threshold is kept when its magnitude, or the magnitude of one of the neighbors
+ * selected by its gradient direction, is above the high threshold. The neighbors in the rows around the
+ * strip are computed from the rows of imageIn, so the strips are independent and can be processed in any order.
+ * The edges crossing the strips cannot be traced so ARM_CV_CANNY_FULL_HYSTERESIS is not supported:
+ * it is asserted in debug builds and the output is not written otherwise.
+ *
+ * @par  Temporary buffer sizing:
+ *
+ * Size of temporary buffer is given by
+ * arm_cv_get_scratch_size_canny_sobel(int width)
+ */
+void arm_cv_canny_edge_sobel_strip(const arm_cv_image_gray8_t *imageIn, arm_cv_image_gray8_t *imageOut,
+                                   const arm_cv_strip_t *strip, q15_t *scratch, uint8_t lowThreshold,
+                                   uint8_t highThreshold, const uint8_t flags)
+{
+    assert((flags & ARM_CV_CANNY_FULL_HYSTERESIS) == 0);
+    if (flags & ARM_CV_CANNY_FULL_HYSTERESIS)
+    {
+        return;
+    }
+    arm_cv_canny_edge_lines(imageIn, imageOut, strip, scratch, lowThreshold, highThreshold, ARM_CV_BORDER_NEAREST,
+                            flags, 0, NULL, 0);
+}
+
+/**
+  @ingroup featureDetection
+ */
+
+/**
+ * @brief      Canny edge with the 3x3 gaussian and sobel integrated on a strip of the image
+ *
+ * @param[in]     imageIn         The rows of the input image needed by the strip
+ * @param[out]    imageOut        The rows of the strip in the output image
+ * @param[in]     strip           The position of the strip in the image
+ * @param[in,out] scratch         Temporary buffer
+ * @param[in]     lowThreshold    The low threshold
+ * @param[in]     highThreshold   The high threshold
+ * @param[in]     borderType      Type of border used by the gaussian, supported are Nearest and Reflect
+ * @param[in]     flags           Combination of ARM_CV_CANNY_* options, see arm_cv_canny_edge_sobel_flags
+ *
+ * @par Strip processing
+ *
+ * The output rows are the same as the rows computed by arm_cv_canny_edge_gaussian_sobel on the full image.
+ * imageIn starts at the row given by arm_cv_get_strip_first_input_row with the radius
+ * ARM_CV_STRIP_RADIUS_CANNY_GAUSSIAN_SOBEL and contains the number of rows given by
+ * arm_cv_get_strip_nb_input_rows. The two smoothed lines and the two lines of gradients above the strip
+ * are computed again for each strip.
+ * The wrap border needs the rows of the other side of the image so it is not supported:
+ * it is asserted in debug builds and the output is not written otherwise.
+ *
+ * @par Hysteresis
+ *
+ * Same as arm_cv_canny_edge_sobel_strip, ARM_CV_CANNY_FULL_HYSTERESIS is not supported.
+ *
+ * @par  Temporary buffer sizing:
+ *
+ * Size of temporary buffer is given by
+ * arm_cv_get_scratch_size_canny_gaussian_sobel(int width)
+ */
+void arm_cv_canny_edge_gaussian_sobel_strip(const arm_cv_image_gray8_t *imageIn, arm_cv_image_gray8_t *imageOut,
+                                            const arm_cv_strip_t *strip, q15_t *scratch, uint8_t lowThreshold,
+                                            uint8_t highThreshold, const int8_t borderType, const uint8_t flags)
+{
+    assert(borderType != ARM_CV_BORDER_WRAP);
+    assert((flags & ARM_CV_CANNY_FULL_HYSTERESIS) == 0);
+    if ((borderType == ARM_CV_BORDER_WRAP) || (flags & ARM_CV_CANNY_FULL_HYSTERESIS))
+    {
+        return;
+    }
+    arm_cv_canny_edge_lines(imageIn, imageOut, strip, scratch, lowThreshold, highThreshold, borderType, flags, 1,
+                            NULL, 0);
 }
-#endif
\ No newline at end of file
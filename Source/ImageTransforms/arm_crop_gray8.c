@@ -38,6 +38,11 @@
  * @param[in]  top       The top boundary
  * @param[in]  right     The right boundary
  * @param[in]  bottom    The bottom boundary
+ *
+ * @par Copy
+ *      The pixels are copied to ImageOut. arm_cv_image_view_gray8
+ *      gives the same region without copy when a packed buffer
+ *      is not required.
  */
 #if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
 void arm_crop_gray8(const arm_cv_image_gray8_t* ImageIn,
@@ -48,7 +53,9 @@ void arm_crop_gray8(const arm_cv_image_gray8_t* ImageIn,
                           const uint32_t bottom
                     )
 {
-   const uint8_t *pSrc = ImageIn->pData + left + top*(ImageIn->width);
+   const uint32_t strideIn = ARM_CV_IMAGE_STRIDE(ImageIn, 1);
+   const uint32_t strideOut = ARM_CV_IMAGE_STRIDE(ImageOut, 1);
+   const uint8_t *pSrc = ImageIn->pData + left + top*strideIn;
    uint8_t *pDst = ImageOut->pData;
    uint8x16_t gray;
 
@@ -67,7 +74,8 @@ void arm_crop_gray8(const arm_cv_image_gray8_t* ImageIn,
        {
          *pDst++ = *pSrc++;
        }
-       pSrc += ImageIn->width - (right - left);
+       pSrc += strideIn - (right - left);
+       pDst += strideOut - (right - left);
    }
 
 }
@@ -81,7 +89,9 @@ void arm_crop_gray8(const arm_cv_image_gray8_t* ImageIn,
                           const uint32_t bottom
                     )
 {
-    const uint8_t *pSrc = ImageIn->pData + left + top*(ImageIn->width);
+    const uint32_t strideIn = ARM_CV_IMAGE_STRIDE(ImageIn, 1);
+    const uint32_t strideOut = ARM_CV_IMAGE_STRIDE(ImageOut, 1);
+    const uint8_t *pSrc = ImageIn->pData + left + top*strideIn;
     uint8_t *pDst = ImageOut->pData;
     for(uint32_t row=top; row < bottom; row ++)
     {
@@ -89,7 +99,8 @@ void arm_crop_gray8(const arm_cv_image_gray8_t* ImageIn,
        {
          *pDst++ = *pSrc++;
        }
-       pSrc += ImageIn->width - (right - left);
+       pSrc += strideIn - (right - left);
+       pDst += strideOut - (right - left);
     }
 }
 #endif
\ No newline at end of file
@@ -38,6 +38,11 @@
  * @param[in]  top       The top boundary
  * @param[in]  right     The right boundary
  * @param[in]  bottom    The bottom boundary
+ *
+ * @par Copy
+ *      The pixels are copied to ImageOut. arm_cv_image_view_rgb24
+ *      gives the same region without copy when a packed buffer
+ *      is not required.
  */
 #if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
 void arm_crop_rgb24(const arm_cv_image_rgb24_t* ImageIn,
@@ -48,7 +53,9 @@ void arm_crop_rgb24(const arm_cv_image_rgb24_t* ImageIn,
                           const uint32_t bottom
                     )
 {
-   const uint8_t *pSrc = ImageIn->pData + 3*left + 3*top*(ImageIn->width);
+   const uint32_t strideIn = ARM_CV_IMAGE_STRIDE(ImageIn, 3);
+   const uint32_t strideOut = ARM_CV_IMAGE_STRIDE(ImageOut, 3);
+   const uint8_t *pSrc = ImageIn->pData + 3*left + top*strideIn;
    uint8_t *pDst = ImageOut->pData;
    uint8x16_t vec;
 
@@ -67,7 +74,8 @@ void arm_crop_rgb24(const arm_cv_image_rgb24_t* ImageIn,
        {
          *pDst++ = *pSrc++;
        }
-       pSrc += 3*ImageIn->width - 3*(right - left);
+       pSrc += strideIn - 3*(right - left);
+       pDst += strideOut - 3*(right - left);
    }
 
 }
@@ -80,7 +88,9 @@ void arm_crop_rgb24(const arm_cv_image_rgb24_t* ImageIn,
                           const uint32_t bottom
                     )
 {
-    const uint8_t *pSrc = ImageIn->pData + 3*left + 3*top*(ImageIn->width);
+    const uint32_t strideIn = ARM_CV_IMAGE_STRIDE(ImageIn, 3);
+    const uint32_t strideOut = ARM_CV_IMAGE_STRIDE(ImageOut, 3);
+    const uint8_t *pSrc = ImageIn->pData + 3*left + top*strideIn;
     uint8_t *pDst = ImageOut->pData;
     for(uint32_t row=top; row < bottom; row ++)
     {
@@ -88,7 +98,8 @@ void arm_crop_rgb24(const arm_cv_image_rgb24_t* ImageIn,
        {
          *pDst++ = *pSrc++;
        }
-       pSrc += 3*ImageIn->width - 3*(right - left);
+       pSrc += strideIn - 3*(right - left);
+       pDst += strideOut - 3*(right - left);
     }
 }
 #endif
\ No newline at end of file
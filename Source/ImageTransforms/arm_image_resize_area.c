@@ -0,0 +1,432 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS CV Library
+ * Title:        arm_image_resize_area.c
+ * Description:  downscale by area averaging
+ *
+ * Target Processor: Cortex-M
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2024 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "cv/image_transforms.h"
+
+/*
+
+An output pixel is the average of the input pixels covered by its area.
+
+When the input dimensions are multiples of the output dimensions, the
+output pixel is the sum of a block of fx x fy input pixels multiplied by
+round(2^24 / (fx * fy)) and rounded (pixel binning).
+
+Otherwise, an input pixel is weighted by the part of it which is inside
+the output pixel. The weights are q16 and the weights of an output pixel
+sum to 65536 in each dimension, so no input pixel is dropped even with
+the largest ratios. The horizontal sums are computed in 32 bits for each
+input row, rounded to q8 and accumulated in 32 bits with the vertical
+weights.
+
+*/
+
+/* Largest block of the binning (the product by the reciprocal must fit in 32 bits) */
+#define AREA_MAX_BINNING 65535
+
+typedef struct {
+    int input_w;
+    int input_h;
+
+    int output_w;
+    int output_h;
+
+    int input_stride;
+    int output_stride;
+
+    int nb_channels;
+
+    const channel_uint8_t *pIn;
+    channel_uint8_t *pOut;
+} _common_resize_area_t;
+
+/* q16 position of d in an output pixel of size "size". d <= size <= 65535 so
+   the product fits in 32 bits */
+__STATIC_FORCEINLINE uint32_t arm_image_resize_area_pos(const uint32_t d, const uint32_t size)
+{
+    return ((d * 65536 + size / 2) / size);
+}
+
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+static void arm_image_resize_area_binning(const _common_resize_area_t *common)
+{
+    const int output_w = common->output_w;
+    const int nb = common->nb_channels;
+    const int input_stride = common->input_stride;
+    const int fx = common->input_w / output_w;
+    const int fy = common->input_h / common->output_h;
+    const uint32_t recip = ((1U << 24) + (fx * fy) / 2) / (fx * fy);
+    const uint32x4_t vOffset = vmulq_n_u32(vidupq_n_u32(0, 1), (uint32_t)(fx * nb));
+
+    for (int r = 0; r < common->output_h; r++)
+    {
+        const channel_uint8_t *pRow = common->pIn + r * fy * input_stride;
+        channel_uint8_t *pOut = common->pOut + r * common->output_stride;
+
+        if ((nb == 1) && (fx == 2) && (fy == 2))
+        {
+            /* 2x2 binning of a gray image : the even and odd pixels of 16
+               input pixels are added in 16 bits */
+            for (int c = 0; c < output_w; c += 8)
+            {
+                mve_pred16_t p8 = vctp8q((uint32_t)(2 * (output_w - c)));
+                uint8x16_t v0 = vld1q_z_u8(&pRow[2 * c], p8);
+                uint8x16_t v1 = vld1q_z_u8(&pRow[2 * c + input_stride], p8);
+                uint16x8_t sum = vaddq_u16(vmovlbq_u8(v0), vmovltq_u8(v0));
+                sum = vaddq_u16(sum, vaddq_u16(vmovlbq_u8(v1), vmovltq_u8(v1)));
+                vstrbq_p_u16(&pOut[c], vrshrq_n_u16(sum, 2), vctp16q((uint32_t)(output_w - c)));
+            }
+            continue;
+        }
+
+        for (int c = 0; c < output_w; c += 4)
+        {
+            mve_pred16_t p = vctp32q((uint32_t)(output_w - c));
+            const channel_uint8_t *pBlock = pRow + c * fx * nb;
+
+            for (int k = 0; k < nb; k++)
+            {
+                uint32x4_t acc = vdupq_n_u32(0);
+                for (int y = 0; y < fy; y++)
+                {
+                    const channel_uint8_t *pLine = pBlock + y * input_stride + k;
+                    for (int x = 0; x < fx; x++)
+                    {
+                        acc = vaddq_u32(acc, vldrbq_gather_offset_z_u32(pLine + x * nb, vOffset, p));
+                    }
+                }
+                acc = vshrq_n_u32(vaddq_n_u32(vmulq_n_u32(acc, recip), 1U << 23), 24);
+                if (nb == 1)
+                {
+                    vstrbq_p_u32(&pOut[c], acc, p);
+                }
+                else
+                {
+                    vstrbq_scatter_offset_p_u32(&pOut[c * nb + k], vmulq_n_u32(vidupq_n_u32(0, 1), (uint32_t)nb),
+                                                acc, p);
+                }
+            }
+        }
+    }
+}
+
+/* Add the weighted horizontal sums of an input row, rounded to q8, to the accumulators */
+static void arm_image_resize_area_accumulate(uint32_t *pAcc, const uint32_t *pLine, const uint32_t weight,
+                                             const int size)
+{
+    for (int i = 0; i < size; i += 4)
+    {
+        mve_pred16_t p = vctp32q((uint32_t)(size - i));
+        uint32x4_t acc = vld1q_z_u32(&pAcc[i], p);
+        acc = vmlaq_n_u32(acc, vrshrq_n_u32(vld1q_z_u32(&pLine[i], p), 8), weight);
+        vst1q_p_u32(&pAcc[i], acc, p);
+    }
+}
+
+static void arm_image_resize_area_store(const uint32_t *pAcc, channel_uint8_t *pOut, const int size)
+{
+    for (int i = 0; i < size; i += 4)
+    {
+        mve_pred16_t p = vctp32q((uint32_t)(size - i));
+        uint32x4_t acc = vld1q_z_u32(&pAcc[i], p);
+        vstrbq_p_u32(&pOut[i], vshrq_n_u32(vaddq_n_u32(acc, 1U << 23), 24), p);
+    }
+}
+#else
+static void arm_image_resize_area_binning(const _common_resize_area_t *common)
+{
+    const int output_w = common->output_w;
+    const int nb = common->nb_channels;
+    const int input_stride = common->input_stride;
+    const int fx = common->input_w / output_w;
+    const int fy = common->input_h / common->output_h;
+    const uint32_t recip = ((1U << 24) + (fx * fy) / 2) / (fx * fy);
+
+    for (int r = 0; r < common->output_h; r++)
+    {
+        const channel_uint8_t *pRow = common->pIn + r * fy * input_stride;
+        channel_uint8_t *pOut = common->pOut + r * common->output_stride;
+
+        for (int c = 0; c < output_w; c++)
+        {
+            const channel_uint8_t *pBlock = pRow + c * fx * nb;
+            for (int k = 0; k < nb; k++)
+            {
+                uint32_t acc = 0;
+                for (int y = 0; y < fy; y++)
+                {
+                    const channel_uint8_t *pLine = pBlock + y * input_stride + k;
+                    for (int x = 0; x < fx; x++)
+                    {
+                        acc += pLine[x * nb];
+                    }
+                }
+                pOut[c * nb + k] = (channel_uint8_t)((acc * recip + (1U << 23)) >> 24);
+            }
+        }
+    }
+}
+
+static void arm_image_resize_area_accumulate(uint32_t *pAcc, const uint32_t *pLine, const uint32_t weight,
+                                             const int size)
+{
+    for (int i = 0; i < size; i++)
+    {
+        pAcc[i] += ((pLine[i] + 128) >> 8) * weight;
+    }
+}
+
+static void arm_image_resize_area_store(const uint32_t *pAcc, channel_uint8_t *pOut, const int size)
+{
+    for (int i = 0; i < size; i++)
+    {
+        pOut[i] = (channel_uint8_t)((pAcc[i] + (1U << 23)) >> 24);
+    }
+}
+#endif
+
+static void arm_image_resize_area_fractional(const _common_resize_area_t *common, uint32_t *scratch)
+{
+    const uint32_t input_w = (uint32_t)common->input_w;
+    const uint32_t input_h = (uint32_t)common->input_h;
+    const uint32_t output_w = (uint32_t)common->output_w;
+    const uint32_t output_h = (uint32_t)common->output_h;
+    const int nb = common->nb_channels;
+    const int line_size = output_w * nb;
+
+    /* Layout of the scratch. A weight is 65536 when the input and output
+       widths are the same so the weights are 32 bits */
+    uint32_t *pAcc = scratch;
+    uint32_t *pLine = pAcc + line_size;
+    uint32_t *pWeight0 = pLine + line_size + nb;
+    uint32_t *pWeight1 = pWeight0 + input_w;
+    uint16_t *pCol = (uint16_t *)(pWeight1 + input_w);
+
+    /* Each input column is in 1 or 2 output columns */
+    for (uint32_t i = 0; i < input_w; i++)
+    {
+        uint32_t c = (i * output_w) / input_w;
+        uint32_t start = i * output_w - c * input_w;
+        uint32_t end = start + output_w;
+
+        pCol[i] = (uint16_t)c;
+        if (end <= input_w)
+        {
+            pWeight0[i] = arm_image_resize_area_pos(end, input_w) - arm_image_resize_area_pos(start, input_w);
+            pWeight1[i] = 0;
+        }
+        else
+        {
+            pWeight0[i] = 65536 - arm_image_resize_area_pos(start, input_w);
+            pWeight1[i] = arm_image_resize_area_pos(end - input_w, input_w);
+        }
+    }
+
+    for (uint32_t r = 0; r < output_h; r++)
+    {
+        const uint32_t first = (r * input_h) / output_h;
+        const uint32_t last = ((r + 1) * input_h - 1) / output_h;
+
+        memset(pAcc, 0, line_size * sizeof(uint32_t));
+        for (uint32_t y = first; y <= last; y++)
+        {
+            const channel_uint8_t *pRow = common->pIn + y * common->input_stride;
+            uint32_t start = (y * output_h > r * input_h) ? y * output_h - r * input_h : 0;
+            uint32_t end = (y + 1) * output_h - r * input_h;
+            if (end > input_h)
+            {
+                end = input_h;
+            }
+
+            /* The sums are at most 255 * 65536 */
+            memset(pLine, 0, (line_size + nb) * sizeof(uint32_t));
+            for (uint32_t i = 0; i < input_w; i++)
+            {
+                uint32_t *pDst = &pLine[pCol[i] * nb];
+                for (int k = 0; k < nb; k++)
+                {
+                    uint32_t v = pRow[i * nb + k];
+                    pDst[k] += v * pWeight0[i];
+                    pDst[k + nb] += v * pWeight1[i];
+                }
+            }
+
+            arm_image_resize_area_accumulate(pAcc, pLine,
+                                             arm_image_resize_area_pos(end, input_h) -
+                                             arm_image_resize_area_pos(start, input_h),
+                                             line_size);
+        }
+        arm_image_resize_area_store(pAcc, common->pOut + r * common->output_stride, line_size);
+    }
+}
+
+static void arm_image_resize_area_common(const _common_resize_area_t *common, uint32_t *scratch)
+{
+    /* Only downscaling is supported */
+    if ((common->output_w == 0) || (common->output_h == 0) || (common->output_w > common->input_w) ||
+        (common->output_h > common->input_h))
+    {
+        return;
+    }
+    if ((common->input_w % common->output_w == 0) && (common->input_h % common->output_h == 0) &&
+        ((common->input_w / common->output_w) * (common->input_h / common->output_h) <= AREA_MAX_BINNING))
+    {
+        arm_image_resize_area_binning(common);
+    }
+    else
+    {
+        arm_image_resize_area_fractional(common, scratch);
+    }
+}
+
+/**
+  @ingroup imageTransform
+ */
+
+/**
+ * @brief      Return the scratch size for the area resize functions
+ *
+ * @param[in]     inputWidth   The width of the input image
+ * @param[in]     outputWidth  The width of the output image
+ * @param[in]     nbChannels   Number of interleaved channels (1 for gray8 and bgr_8U3C, 3 for rgb24)
+ * @return		  Scratch size in bytes
+ */
+uint32_t arm_get_scratch_size_resize_area(const int inputWidth, const int outputWidth, const uint8_t nbChannels)
+{
+    return (((2 * outputWidth + 1) * nbChannels + 2 * inputWidth) * sizeof(uint32_t) + inputWidth * sizeof(uint16_t));
+}
+
+/**
+  @ingroup imageTransform
+ */
+
+/**
+ * @brief      Downscale a gray8 image by area averaging
+ *
+ * @param[in]      ImageIn   The input image
+ * @param          ImageOut  The output image
+ * @param[in,out]  scratch   Temporary buffer
+ *
+ * @par  Temporary buffer sizing:
+ * arm_get_scratch_size_resize_area(ImageIn->width, ImageOut->width, 1)
+ *
+ * @par  Dimensions
+ *       The output dimensions must not be zero and not be bigger than
+ *       the input ones, otherwise the output image is not written.
+ *       Use the bilinear arm_image_resize_gray8_fixp to upscale.
+ *       When the input dimensions are multiples of the output ones, the
+ *       scratch is not used and the blocks of pixels are directly averaged.
+ */
+void arm_image_resize_area_gray8(const arm_cv_image_gray8_t *ImageIn,
+                                 arm_cv_image_gray8_t *ImageOut,
+                                 uint32_t *scratch)
+{
+    _common_resize_area_t common;
+
+    common.input_w = ImageIn->width;
+    common.input_h = ImageIn->height;
+    common.output_w = ImageOut->width;
+    common.output_h = ImageOut->height;
+    common.input_stride = ARM_CV_IMAGE_STRIDE(ImageIn, 1);
+    common.output_stride = ARM_CV_IMAGE_STRIDE(ImageOut, 1);
+    common.nb_channels = 1;
+
+    common.pIn = ImageIn->pData;
+    common.pOut = ImageOut->pData;
+    arm_image_resize_area_common(&common, scratch);
+}
+
+/**
+  @ingroup imageTransform
+ */
+
+/**
+ * @brief      Downscale a BGR 8U3C image by area averaging
+ *
+ * @param[in]      ImageIn   The input image
+ * @param          ImageOut  The output image
+ * @param[in,out]  scratch   Temporary buffer
+ *
+ * @par  Temporary buffer sizing:
+ * arm_get_scratch_size_resize_area(ImageIn->width, ImageOut->width, 1)
+ *
+ * @par  Dimensions
+ *       Same constraints as arm_image_resize_area_gray8
+ */
+void arm_image_resize_area_bgr_8U3C(const arm_cv_image_bgr_8U3C_t *ImageIn,
+                                    arm_cv_image_bgr_8U3C_t *ImageOut,
+                                    uint32_t *scratch)
+{
+    _common_resize_area_t common;
+
+    common.input_w = ImageIn->width;
+    common.input_h = ImageIn->height;
+    common.output_w = ImageOut->width;
+    common.output_h = ImageOut->height;
+    common.input_stride = ARM_CV_IMAGE_STRIDE(ImageIn, 1);
+    common.output_stride = ARM_CV_IMAGE_STRIDE(ImageOut, 1);
+    common.nb_channels = 1;
+
+    for (int plane = 0; plane < 3; plane++)
+    {
+        common.pIn = ImageIn->pData + plane * (common.input_stride * common.input_h);
+        common.pOut = ImageOut->pData + plane * (common.output_stride * common.output_h);
+        arm_image_resize_area_common(&common, scratch);
+    }
+}
+
+/**
+  @ingroup imageTransform
+ */
+
+/**
+ * @brief      Downscale a RGB24 image by area averaging
+ *
+ * @param[in]      ImageIn   The input image
+ * @param          ImageOut  The output image
+ * @param[in,out]  scratch   Temporary buffer
+ *
+ * @par  Temporary buffer sizing:
+ * arm_get_scratch_size_resize_area(ImageIn->width, ImageOut->width, 3)
+ *
+ * @par  Dimensions
+ *       Same constraints as arm_image_resize_area_gray8
+ */
+void arm_image_resize_area_rgb24(const arm_cv_image_rgb24_t *ImageIn,
+                                 arm_cv_image_rgb24_t *ImageOut,
+                                 uint32_t *scratch)
+{
+    _common_resize_area_t common;
+
+    common.input_w = ImageIn->width;
+    common.input_h = ImageIn->height;
+    common.output_w = ImageOut->width;
+    common.output_h = ImageOut->height;
+    common.input_stride = ARM_CV_IMAGE_STRIDE(ImageIn, 3);
+    common.output_stride = ARM_CV_IMAGE_STRIDE(ImageOut, 3);
+    common.nb_channels = 3;
+
+    common.pIn = ImageIn->pData;
+    common.pOut = ImageOut->pData;
+    arm_image_resize_area_common(&common, scratch);
+}
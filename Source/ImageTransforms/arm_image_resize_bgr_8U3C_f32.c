@@ -55,6 +55,9 @@ void arm_image_resize_bgr_8U3C_f32(const arm_cv_image_bgr_8U3C_t* ImageIn,
     common.output_w = ImageOut->width;
     common.output_h = ImageOut->height;
 
+    common.input_stride = ARM_CV_IMAGE_STRIDE(ImageIn, 1);
+    common.output_stride = ARM_CV_IMAGE_STRIDE(ImageOut, 1);
+
 	  common.w_scale = (float)(common.input_w - 1) / (common.output_w - 1);
 	  common.h_scale = (float)(common.input_h - 1) / (common.output_h - 1);	
 	
@@ -63,12 +66,12 @@ void arm_image_resize_bgr_8U3C_f32(const arm_cv_image_bgr_8U3C_t* ImageIn,
     common.pOut = ImageOut->pData;
 	  arm_image_resize_common_f32(&common,p_img);
 
-	  common.pIn  = ImageIn->pData + (common.input_w * common.input_h);
-    common.pOut = ImageOut->pData + (common.output_w * common.output_h);
+	  common.pIn  = ImageIn->pData + (common.input_stride * common.input_h);
+    common.pOut = ImageOut->pData + (common.output_stride * common.output_h);
 	  arm_image_resize_common_f32(&common,p_img);
 
-	  common.pIn  = ImageIn->pData + 2 * (common.input_w * common.input_h);
-    common.pOut = ImageOut->pData + 2 * (common.output_w * common.output_h);
+	  common.pIn  = ImageIn->pData + 2 * (common.input_stride * common.input_h);
+    common.pOut = ImageOut->pData + 2 * (common.output_stride * common.output_h);
 	  arm_image_resize_common_f32(&common,p_img);
 
 
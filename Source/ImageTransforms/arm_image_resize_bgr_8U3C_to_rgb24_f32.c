@@ -41,9 +41,9 @@ __STATIC_INLINE uint32x4_t get_pixel_index(int32x4_t x_s32, int32x4_t y_s32, flo
 }
 
 #else
-__STATIC_INLINE float get_bgr_8U3C_image_pixel(uint8_t* m, int x, int y, int c, int w, int h)
+__STATIC_INLINE float get_bgr_8U3C_image_pixel(uint8_t* m, int x, int y, int c, int stride, int h)
 {
-  return m[c*h*w + y * w + x];
+  return m[c*h*stride + y * stride + x];
 }
 __STATIC_INLINE void set_tmp_image_pixel(uint8_t* m, int x, int y, int c, float val, int w)
 {
@@ -51,10 +51,10 @@ __STATIC_INLINE void set_tmp_image_pixel(uint8_t* m, int x, int y, int c, float
   m[c*2*w + y * w + x] = (uint8_t)(val+0.5f);
 }
 
-__STATIC_INLINE void set_rgb24_image_pixel(uint8_t* m, int x, int y, int c, float val, int w)
+__STATIC_INLINE void set_rgb24_image_pixel(uint8_t* m, int x, int y, int c, float val, int stride)
 {
   /* x, y, c are already validated by upper layers */
-  m[(y * w + x) * 3 + (2 - c) ] = (uint8_t)(val+0.5f);
+  m[y * stride + x * 3 + (2 - c) ] = (uint8_t)(val+0.5f);
 }
 #endif
 /**
@@ -87,6 +87,9 @@ void arm_image_resize_bgr_8U3C_to_rgb24_f32(const arm_cv_image_bgr_8U3C_t* Image
     const int output_w = ImageOut->width;
     const int output_h = ImageOut->height;
 
+    const int strideIn = ARM_CV_IMAGE_STRIDE(ImageIn, 1);
+    const int strideOut = ARM_CV_IMAGE_STRIDE(ImageOut, 3);
+
 	  float w_scale = (float)( input_w - 1) / ( output_w - 1);
 	  float h_scale = (float)( input_h - 1) / ( output_h - 1);	
 
@@ -116,7 +119,7 @@ void arm_image_resize_bgr_8U3C_to_rgb24_f32(const arm_cv_image_bgr_8U3C_t* Image
       float32_t sy;
       int32_t iy = 0, pre_iy = -1, _iy;
       float32_t dy;	
-      float32_t inimg_c_offset = k* input_w* input_h;
+      float32_t inimg_c_offset = k* strideIn* input_h;
       for (r = 0; r <  output_h - 1 ; ++r) {
         sy = r *  h_scale;
         iy = (int)sy;
@@ -141,7 +144,7 @@ void arm_image_resize_bgr_8U3C_to_rgb24_f32(const arm_cv_image_bgr_8U3C_t* Image
 
               //val = dx * pixel'
               ix2_s32 = vaddq_n_s32(ix_s32, 1);
-              pixel_u32 = get_pixel_index(ix2_s32, iy_s32, (float32_t) input_w, inimg_c_offset);
+              pixel_u32 = get_pixel_index(ix2_s32, iy_s32, (float32_t) strideIn, inimg_c_offset);
               temp_u32 = vldrbq_gather_offset_u32(&(pIn[0]), pixel_u32);
               val_f32 = vcvtq_f32_u32(temp_u32);
               total_f32 = vmulq_f32(val_f32, dx_f32);
@@ -149,7 +152,7 @@ void arm_image_resize_bgr_8U3C_to_rgb24_f32(const arm_cv_image_bgr_8U3C_t* Image
               //val += (1+dx) * pixel'
               temp_f32 = vdupq_n_f32(1.0f);
               weight_f32 = vsubq_f32(temp_f32, dx_f32);
-              pixel_u32 = get_pixel_index(ix_s32, iy_s32, (float32_t) input_w, inimg_c_offset);		
+              pixel_u32 = get_pixel_index(ix_s32, iy_s32, (float32_t) strideIn, inimg_c_offset);		
               temp_u32 = vldrbq_gather_offset_u32(&(pIn[0]), pixel_u32);
               pixel_f32 = vcvtq_f32_u32(temp_u32);
               val_f32 = vmulq_f32(pixel_f32, weight_f32);	
@@ -183,7 +186,7 @@ void arm_image_resize_bgr_8U3C_to_rgb24_f32(const arm_cv_image_bgr_8U3C_t* Image
             //val = dx * pixel'
             ix2_s32 = vaddq_n_s32(ix_s32, 1);
             // ix2_s32 = vsetq_lane_s32(0, ix_s32, 3);
-            pixel_u32 = get_pixel_index(ix2_s32, iy_s32, (float32_t) input_w, inimg_c_offset);
+            pixel_u32 = get_pixel_index(ix2_s32, iy_s32, (float32_t) strideIn, inimg_c_offset);
             temp_u32 = vldrbq_gather_offset_u32(&(pIn[0]), pixel_u32);
             val_f32 = vcvtq_f32_u32(temp_u32);
             total_f32 = vmulq_f32(val_f32, dx_f32);
@@ -193,7 +196,7 @@ void arm_image_resize_bgr_8U3C_to_rgb24_f32(const arm_cv_image_bgr_8U3C_t* Image
             temp_f32 = vdupq_n_f32(1.0f);
             weight_f32 = vsubq_f32(temp_f32, dx_f32);
             weight_f32 = vsetq_lane_f32((float32_t)1.0, weight_f32, 3);
-            pixel_u32 = get_pixel_index(ix_s32, iy_s32, (float32_t) input_w, inimg_c_offset);
+            pixel_u32 = get_pixel_index(ix_s32, iy_s32, (float32_t) strideIn, inimg_c_offset);
             temp_u32 = vldrbq_gather_offset_u32(&(pIn[0]), pixel_u32);
             pixel_f32 = vcvtq_f32_u32(temp_u32);
             val_f32 = vmulq_f32(pixel_f32, weight_f32);	
@@ -239,10 +242,10 @@ void arm_image_resize_bgr_8U3C_to_rgb24_f32(const arm_cv_image_bgr_8U3C_t* Image
           temp_y_u32 = vcvtq_u32_f32(total_f32);
 
           //[[bbb],[ggg],[rrr]]--> [[rgb],[rgb],[rgb]]
-          uint32_t loc = ( output_w*r + c)*3 + (2-k);
+          uint32_t loc = strideOut*r + c*3 + (2-k);
 
           //(uint8_t * base, uint8x16_t offset, uint8x16_t value)
-          vstrbq_scatter_offset_u32(&(pOut[loc]), str_offset, temp_y_u32);
+          vstrbq_scatter_offset_p_u32(&(pOut[loc]), str_offset, temp_y_u32, vctp32q(output_w - c));
         }
         
         pre_iy = iy;	
@@ -271,7 +274,7 @@ void arm_image_resize_bgr_8U3C_to_rgb24_f32(const arm_cv_image_bgr_8U3C_t* Image
 
           //val = dx * pixel'
           ix2_s32 = vaddq_n_s32(ix_s32, 1);
-          pixel_u32 = get_pixel_index(ix2_s32, iy_s32,  input_w, inimg_c_offset);
+          pixel_u32 = get_pixel_index(ix2_s32, iy_s32,  strideIn, inimg_c_offset);
           temp_u32 = vldrbq_gather_offset_u32(&(pIn[0]), pixel_u32);
           val_f32 = vcvtq_f32_u32(temp_u32);
           total_f32 = vmulq_f32(val_f32, dx_f32);
@@ -279,7 +282,7 @@ void arm_image_resize_bgr_8U3C_to_rgb24_f32(const arm_cv_image_bgr_8U3C_t* Image
           //val += (1+dx) * pixel'
           temp_f32 = vdupq_n_f32(1.0f);
           weight_f32 = vsubq_f32(temp_f32, dx_f32);
-          pixel_u32 = get_pixel_index(ix_s32, iy_s32,  input_w, inimg_c_offset);	
+          pixel_u32 = get_pixel_index(ix_s32, iy_s32,  strideIn, inimg_c_offset);	
           temp_u32 = vldrbq_gather_offset_u32(&(pIn[0]), pixel_u32);
           pixel_f32 = vcvtq_f32_u32(temp_u32);
           val_f32 = vmulq_f32(pixel_f32, weight_f32);	
@@ -314,7 +317,7 @@ void arm_image_resize_bgr_8U3C_to_rgb24_f32(const arm_cv_image_bgr_8U3C_t* Image
         // loc =  input_w * iy +  input_w - 1;
         ix2_s32 = vaddq_n_s32(ix_s32, 1);
         // ix2_s32 = vsetq_lane_s32(0, ix_s32, 3);
-        pixel_u32 = get_pixel_index(ix2_s32, iy_s32,  input_w, inimg_c_offset);
+        pixel_u32 = get_pixel_index(ix2_s32, iy_s32,  strideIn, inimg_c_offset);
         temp_u32 = vldrbq_gather_offset_u32(&(pIn[0]), pixel_u32);
         val_f32 = vcvtq_f32_u32(temp_u32);
         total_f32 = vmulq_f32(val_f32, dx_f32);
@@ -324,7 +327,7 @@ void arm_image_resize_bgr_8U3C_to_rgb24_f32(const arm_cv_image_bgr_8U3C_t* Image
         temp_f32 = vdupq_n_f32(1.0f);
         weight_f32 = vsubq_f32(temp_f32, dx_f32);
         weight_f32 = vsetq_lane_f32((float32_t)1.0, weight_f32, 3);
-        pixel_u32 = get_pixel_index(ix_s32, iy_s32,  input_w, inimg_c_offset);
+        pixel_u32 = get_pixel_index(ix_s32, iy_s32,  strideIn, inimg_c_offset);
         temp_u32 = vldrbq_gather_offset_u32(&(pIn[0]), pixel_u32);
         pixel_f32 = vcvtq_f32_u32(temp_u32);
         val_f32 = vmulq_f32(pixel_f32, weight_f32);	
@@ -357,10 +360,10 @@ void arm_image_resize_bgr_8U3C_to_rgb24_f32(const arm_cv_image_bgr_8U3C_t* Image
         temp_y_u32 = vcvtq_u32_f32(val_f32);
 
         //[[bbb],[ggg],[rrr]]--> [[rgb],[rgb],[rgb]]
-        uint32_t loc = ( output_w*r + c)*3 + (2-k);
+        uint32_t loc = strideOut*r + c*3 + (2-k);
 
         //(uint8_t * base, uint8x16_t offset, uint8x16_t value)
-        vstrbq_scatter_offset_u32(&(pOut[loc]), str_offset, temp_y_u32);
+        vstrbq_scatter_offset_p_u32(&(pOut[loc]), str_offset, temp_y_u32, vctp32q(output_w - c));
       }		
 
     }	
@@ -379,6 +382,9 @@ void arm_image_resize_bgr_8U3C_to_rgb24_f32(const arm_cv_image_bgr_8U3C_t* Image
   const int output_w = ImageOut->width;
   const int output_h = ImageOut->height;
 
+  const int strideIn = ARM_CV_IMAGE_STRIDE(ImageIn, 1);
+  const int strideOut = ARM_CV_IMAGE_STRIDE(ImageOut, 3);
+
 
   channel_uint8_t *pIn  = ImageIn->pData;
 
@@ -416,10 +422,10 @@ void arm_image_resize_bgr_8U3C_to_rgb24_f32(const arm_cv_image_bgr_8U3C_t* Image
 						float sx = col * w_scale;
 						int ix = (int)sx;
 						float dx = sx - ix;		
-						re_v = dx * get_bgr_8U3C_image_pixel(pIn, ix + 1, iy + d, ch_cnt, input_w, input_h) + (1 - dx) * get_bgr_8U3C_image_pixel(pIn, ix, iy + d, ch_cnt, input_w, input_h);
+						re_v = dx * get_bgr_8U3C_image_pixel(pIn, ix + 1, iy + d, ch_cnt, strideIn, input_h) + (1 - dx) * get_bgr_8U3C_image_pixel(pIn, ix, iy + d, ch_cnt, strideIn, input_h);
 						set_tmp_image_pixel(p_img, col, d, 0, re_v, output_w);
 					}
-					re_v = get_bgr_8U3C_image_pixel(pIn, input_w - 1, iy + d, ch_cnt, input_w, input_h);
+					re_v = get_bgr_8U3C_image_pixel(pIn, input_w - 1, iy + d, ch_cnt, strideIn, input_h);
 					set_tmp_image_pixel(p_img, col, d, 0, re_v, output_w);
 				}				
 			}
@@ -428,7 +434,7 @@ void arm_image_resize_bgr_8U3C_to_rgb24_f32(const arm_cv_image_bgr_8U3C_t* Image
 			{
 				re_v = (1 - dy) * get_bgr_8U3C_image_pixel(p_img, col, 0, 0, output_w, 2);
 				re_v = (uint8_t)re_v + dy * get_bgr_8U3C_image_pixel(p_img, col, 1, 0, output_w, 2);
-				set_rgb24_image_pixel(pOut, col, row, ch_cnt, re_v, output_w);
+				set_rgb24_image_pixel(pOut, col, row, ch_cnt, re_v, strideOut);
 			}	
 			pre_iy = iy;		
 		}
@@ -445,17 +451,17 @@ void arm_image_resize_bgr_8U3C_to_rgb24_f32(const arm_cv_image_bgr_8U3C_t* Image
 				float sx = col * w_scale;
 				int ix = (int)sx;
 				float dx = sx - ix;		
-				re_v = (1 - dx) * get_bgr_8U3C_image_pixel(pIn, ix, iy, ch_cnt, input_w, input_h) + dx * get_bgr_8U3C_image_pixel(pIn, ix + 1, iy, ch_cnt, input_w, input_h);
+				re_v = (1 - dx) * get_bgr_8U3C_image_pixel(pIn, ix, iy, ch_cnt, strideIn, input_h) + dx * get_bgr_8U3C_image_pixel(pIn, ix + 1, iy, ch_cnt, strideIn, input_h);
 				set_tmp_image_pixel(p_img, col, 0, 0, re_v, output_w);
 			}
-			re_v = get_bgr_8U3C_image_pixel(pIn, input_w - 1, iy, ch_cnt, input_w, input_h);
+			re_v = get_bgr_8U3C_image_pixel(pIn, input_w - 1, iy, ch_cnt, strideIn, input_h);
 			set_tmp_image_pixel(p_img, col, 0, 0, re_v, output_w);			
 		}
 		for (col = 0; col < output_w; ++col)
 		{
       ////let the latest row be exactly the same with lastest tmp buffer
 			re_v = (get_bgr_8U3C_image_pixel(p_img, col, 0, 0, output_w, 2));
-			set_rgb24_image_pixel(pOut, col, output_h - 1, ch_cnt, re_v, output_w);
+			set_rgb24_image_pixel(pOut, col, output_h - 1, ch_cnt, re_v, strideOut);
 		}	
 	}
 
@@ -39,6 +39,9 @@ void arm_image_resize_common_f32(const _common_resize_t *common,
     const int output_w = common->output_w;
     const int output_h = common->output_h;
 
+    const int input_stride = common->input_stride;
+    const int output_stride = common->output_stride;
+
  
     channel_uint8_t *pIn  = common->pIn;
     channel_uint8_t *pOut = common->pOut;
@@ -66,7 +69,7 @@ void arm_image_resize_common_f32(const _common_resize_t *common,
         float32_t dy;       
         int proc_y_offset;
         for (r = 0; r < output_h - 1 ; ++r) {
-            proc_y_offset = output_w * r;
+            proc_y_offset = output_stride * r;
             sy = r * h_scale;
             iy = (int)sy;
             dy = sy - iy;   
@@ -90,7 +93,7 @@ void arm_image_resize_common_f32(const _common_resize_t *common,
 
                         //val = dx * pixel'
                         ix2_s32 = vaddq_n_s32(ix_s32, 1);
-                        pixel_u32 = get_image_pixel_index(ix2_s32, iy_s32, (float32_t)input_w);
+                        pixel_u32 = get_image_pixel_index(ix2_s32, iy_s32, (float32_t)input_stride);
                         temp_u32 = vldrbq_gather_offset_u32(&(pIn[0]), pixel_u32);
                         val_f32 = vcvtq_f32_u32(temp_u32);
                         total_f32 = vmulq_f32(val_f32, dx_f32);
@@ -98,7 +101,7 @@ void arm_image_resize_common_f32(const _common_resize_t *common,
                         //val += (1+dx) * pixel'
                         temp_f32 = vdupq_n_f32(1.0f);
                         weight_f32 = vsubq_f32(temp_f32, dx_f32);
-                        pixel_u32 = get_image_pixel_index(ix_s32, iy_s32, (float32_t)input_w);      
+                        pixel_u32 = get_image_pixel_index(ix_s32, iy_s32, (float32_t)input_stride);      
                         temp_u32 = vldrbq_gather_offset_u32(&(pIn[0]), pixel_u32);
                         pixel_f32 = vcvtq_f32_u32(temp_u32);
                         val_f32 = vmulq_f32(pixel_f32, weight_f32); 
@@ -132,7 +135,7 @@ void arm_image_resize_common_f32(const _common_resize_t *common,
                     //val = dx * pixel'
                     ix2_s32 = vaddq_n_s32(ix_s32, 1);
                     // ix2_s32 = vsetq_lane_s32(0, ix_s32, 3);
-                    pixel_u32 = get_image_pixel_index(ix2_s32, iy_s32, (float32_t)input_w);
+                    pixel_u32 = get_image_pixel_index(ix2_s32, iy_s32, (float32_t)input_stride);
                     temp_u32 = vldrbq_gather_offset_u32(&(pIn[0]), pixel_u32);
                     val_f32 = vcvtq_f32_u32(temp_u32);
                     total_f32 = vmulq_f32(val_f32, dx_f32);
@@ -142,7 +145,7 @@ void arm_image_resize_common_f32(const _common_resize_t *common,
                     temp_f32 = vdupq_n_f32(1.0f);
                     weight_f32 = vsubq_f32(temp_f32, dx_f32);
                     weight_f32 = vsetq_lane_f32((float32_t)1.0, weight_f32, 3);
-                    pixel_u32 = get_image_pixel_index(ix_s32, iy_s32, (float32_t)input_w);
+                    pixel_u32 = get_image_pixel_index(ix_s32, iy_s32, (float32_t)input_stride);
                     temp_u32 = vldrbq_gather_offset_u32(&(pIn[0]), pixel_u32);
                     pixel_f32 = vcvtq_f32_u32(temp_u32);
                     val_f32 = vmulq_f32(pixel_f32, weight_f32); 
@@ -188,7 +191,7 @@ void arm_image_resize_common_f32(const _common_resize_t *common,
                 loc = proc_y_offset + c;
                 total_f32 = vaddq_n_f32(total_f32, 0.5f); 
                 temp_y_u32 = vcvtq_u32_f32(total_f32);
-                vstrbq_u32(&(pOut[loc]), temp_y_u32);   
+                vstrbq_p_u32(&(pOut[loc]), temp_y_u32, vctp32q(output_w - c));   
             }
             
             pre_iy = iy;    
@@ -198,7 +201,7 @@ void arm_image_resize_common_f32(const _common_resize_t *common,
         sy = r * h_scale;
         iy = (int)sy;
         dy = sy - iy;   
-        proc_y_offset = output_w * r;
+        proc_y_offset = output_stride * r;
         if(iy != pre_iy){
             for(c = 0; c < output_w-4 ; c += 4)
             {   
@@ -218,7 +221,7 @@ void arm_image_resize_common_f32(const _common_resize_t *common,
 
                 //val = dx * pixel'
                 ix2_s32 = vaddq_n_s32(ix_s32, 1);
-                pixel_u32 = get_image_pixel_index(ix2_s32, iy_s32, input_w);
+                pixel_u32 = get_image_pixel_index(ix2_s32, iy_s32, input_stride);
                 temp_u32 = vldrbq_gather_offset_u32(&(pIn[0]), pixel_u32);
                 val_f32 = vcvtq_f32_u32(temp_u32);
                 total_f32 = vmulq_f32(val_f32, dx_f32);
@@ -226,7 +229,7 @@ void arm_image_resize_common_f32(const _common_resize_t *common,
                 //val += (1+dx) * pixel'
                 temp_f32 = vdupq_n_f32(1.0f);
                 weight_f32 = vsubq_f32(temp_f32, dx_f32);
-                pixel_u32 = get_image_pixel_index(ix_s32, iy_s32, input_w); 
+                pixel_u32 = get_image_pixel_index(ix_s32, iy_s32, input_stride); 
                 temp_u32 = vldrbq_gather_offset_u32(&(pIn[0]), pixel_u32);
                 pixel_f32 = vcvtq_f32_u32(temp_u32);
                 val_f32 = vmulq_f32(pixel_f32, weight_f32); 
@@ -258,10 +261,10 @@ void arm_image_resize_common_f32(const _common_resize_t *common,
             iy_s32 = vdupq_n_s32(iy);
 
             //val = dx * pixel'
-            loc = input_w * iy + input_w - 1;
+            loc = input_stride * iy + input_w - 1;
             ix2_s32 = vaddq_n_s32(ix_s32, 1);
             // ix2_s32 = vsetq_lane_s32(0, ix_s32, 3);
-            pixel_u32 = get_image_pixel_index(ix2_s32, iy_s32, input_w);
+            pixel_u32 = get_image_pixel_index(ix2_s32, iy_s32, input_stride);
             temp_u32 = vldrbq_gather_offset_u32(&(pIn[0]), pixel_u32);
             val_f32 = vcvtq_f32_u32(temp_u32);
             total_f32 = vmulq_f32(val_f32, dx_f32);
@@ -271,7 +274,7 @@ void arm_image_resize_common_f32(const _common_resize_t *common,
             temp_f32 = vdupq_n_f32(1.0f);
             weight_f32 = vsubq_f32(temp_f32, dx_f32);
             weight_f32 = vsetq_lane_f32((float32_t)1.0, weight_f32, 3);
-            pixel_u32 = get_image_pixel_index(ix_s32, iy_s32, input_w);
+            pixel_u32 = get_image_pixel_index(ix_s32, iy_s32, input_stride);
             temp_u32 = vldrbq_gather_offset_u32(&(pIn[0]), pixel_u32);
             pixel_f32 = vcvtq_f32_u32(temp_u32);
             val_f32 = vmulq_f32(pixel_f32, weight_f32); 
@@ -301,7 +304,7 @@ void arm_image_resize_common_f32(const _common_resize_t *common,
             // val_f32 = vrndnq_f32(val_f32);
             val_f32 = vaddq_n_f32(val_f32, 0.5f);  
             temp_y_u32 = vcvtq_u32_f32(val_f32);
-            vstrbq_u32(&(pOut[loc]), temp_y_u32);   
+            vstrbq_p_u32(&(pOut[loc]), temp_y_u32, vctp32q(output_w - c));   
         }       
 
 }
@@ -317,6 +320,9 @@ void arm_image_resize_common_f32(const _common_resize_t *common,
     const int output_w = common->output_w;
     const int output_h = common->output_h;
 
+    const int input_stride = common->input_stride;
+    const int output_stride = common->output_stride;
+
  
     channel_uint8_t *pIn  = common->pIn;
     channel_uint8_t *pOut = common->pOut;
@@ -345,10 +351,10 @@ void arm_image_resize_common_f32(const _common_resize_t *common,
                     float sx = col * w_scale;
                     int ix = (int)sx;
                     float dx = sx - ix;     
-                    re_v = (1 - dx) * get_image_pixel(pIn, ix, iy + d, input_w) + dx * get_image_pixel(pIn, ix + 1, iy + d, input_w);
+                    re_v = (1 - dx) * get_image_pixel(pIn, ix, iy + d, input_stride) + dx * get_image_pixel(pIn, ix + 1, iy + d, input_stride);
                     set_image_pixel(p_img, col, d, re_v, output_w);
                 }
-                re_v = get_image_pixel(pIn, input_w - 1, iy + d, input_w);
+                re_v = get_image_pixel(pIn, input_w - 1, iy + d, input_stride);
                 set_image_pixel(p_img, col, d, re_v, output_w);
             }               
         }
@@ -356,7 +362,7 @@ void arm_image_resize_common_f32(const _common_resize_t *common,
         for (col = 0; col < output_w; ++col){
             re_v = (1 - dy) * get_image_pixel(p_img, col, 0, output_w);
             re_v = (uint8_t)re_v + dy * get_image_pixel(p_img, col, 1, output_w);
-            set_image_pixel(pOut, col, row, re_v, output_w);
+            set_image_pixel(pOut, col, row, re_v, output_stride);
         }   
         pre_iy = iy;        
     }
@@ -373,16 +379,16 @@ void arm_image_resize_common_f32(const _common_resize_t *common,
             float sx = col * w_scale;
             int ix = (int)sx;
             float dx = sx - ix;     
-            re_v = (1 - dx) * get_image_pixel(pIn, ix, iy, input_w) + dx * get_image_pixel(pIn, ix + 1, iy, input_w);
+            re_v = (1 - dx) * get_image_pixel(pIn, ix, iy, input_stride) + dx * get_image_pixel(pIn, ix + 1, iy, input_stride);
             set_image_pixel(p_img, col, 0, re_v, output_w);
         }
-        re_v = get_image_pixel(pIn, input_w - 1, iy, input_w);
+        re_v = get_image_pixel(pIn, input_w - 1, iy, input_stride);
         set_image_pixel(p_img, col, 0, re_v, output_w);          
     }
     for (col = 0; col < output_w; ++col){
         ////let the latest row be exactly the same with lastest tmp buffer
         re_v = get_image_pixel(p_img, col, 0, output_w);
-        set_image_pixel(pOut, col, output_h - 1, re_v, output_w);
+        set_image_pixel(pOut, col, output_h - 1, re_v, output_stride);
     }   
 }
 #endif
\ No newline at end of file
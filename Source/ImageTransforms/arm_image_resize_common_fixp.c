@@ -0,0 +1,295 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS CV Library
+ * Title:        arm_image_resize_common_fixp
+ * Description:  common code used by the fixed point resize functions
+ *
+ * Target Processor: Cortex-M
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2024 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cv/image_transforms.h"
+#include "arm_image_resize_common.h"
+
+/*
+
+The positions in the input image are q16.16 and the interpolation
+weights are their fractional part rounded to 8 bits.
+
+A row of the input is first interpolated horizontally into a line
+of uint16 (pixel * 256). The two lines around an output row are then
+interpolated vertically and rounded. All the computations are done
+on integers so the scalar and Helium versions give the same result.
+
+*/
+
+/* q16.16 step so that the first and last pixels of the output
+   are the first and last pixels of the input (like the f32 version) */
+static uint32_t arm_image_resize_scale_fixp(const int input_size, const int output_size)
+{
+    if ((output_size <= 1) || (input_size <= 1))
+    {
+        return (0);
+    }
+    return ((((uint32_t)(input_size - 1) << 16) + (uint32_t)(output_size - 1) / 2) /
+            (uint32_t)(output_size - 1));
+}
+
+void arm_image_resize_common_init_fixp(_common_resize_fixp_t *common)
+{
+    common->plan = NULL;
+    common->w_scale = arm_image_resize_scale_fixp(common->input_w, common->output_w);
+    common->h_scale = arm_image_resize_scale_fixp(common->input_h, common->output_h);
+}
+
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+static void arm_image_resize_row_fixp(const _common_resize_fixp_t *common,
+                                      const channel_uint8_t *pRow,
+                                      uint16_t *pLine)
+{
+    const int output_w = common->output_w;
+    const int nb = common->nb_channels;
+    const uint32_t w_scale = common->w_scale;
+    const arm_image_resize_plan_t *plan = common->plan;
+    const uint32x4_t vLast = vdupq_n_u32((uint32_t)(common->input_w - 1));
+    const uint32x4_t vOne = vdupq_n_u32(256);
+    const uint32x4_t vMask = vdupq_n_u32(0xFF);
+
+    for (int c = 0; c < output_w; c += 4)
+    {
+        mve_pred16_t p = vctp32q((uint32_t)(output_w - c));
+        uint32x4_t vix, vix1, vfx;
+        if (plan != NULL)
+        {
+            vix = vldrhq_z_u32(&plan->xIndex[c], p);
+            vix1 = vldrhq_z_u32(&plan->xIndex1[c], p);
+            vfx = vldrbq_z_u32(&plan->xWeight[c], p);
+        }
+        else
+        {
+            uint32x4_t vsx = vmulq_n_u32(vidupq_n_u32((uint32_t)c, 1), w_scale);
+            vsx = vaddq_n_u32(vsx, 128);
+            vix = vshrq_n_u32(vsx, 16);
+            vfx = vandq_u32(vshrq_n_u32(vsx, 8), vMask);
+            vix1 = vminq_u32(vaddq_n_u32(vix, 1), vLast);
+        }
+        uint32x4_t vfx0 = vsubq_u32(vOne, vfx);
+
+        vix = vmulq_n_u32(vix, (uint32_t)nb);
+        vix1 = vmulq_n_u32(vix1, (uint32_t)nb);
+
+        for (int k = 0; k < nb; k++)
+        {
+            uint32x4_t p0 = vldrbq_gather_offset_z_u32(pRow, vaddq_n_u32(vix, (uint32_t)k), p);
+            uint32x4_t p1 = vldrbq_gather_offset_z_u32(pRow, vaddq_n_u32(vix1, (uint32_t)k), p);
+            uint32x4_t h = vaddq_u32(vmulq_u32(p0, vfx0), vmulq_u32(p1, vfx));
+            vstrhq_p_u32(&pLine[k * output_w + c], h, p);
+        }
+    }
+}
+
+static void arm_image_resize_vert_fixp(const _common_resize_fixp_t *common,
+                                       const uint16_t *pLine0,
+                                       const uint16_t *pLine1,
+                                       const uint32_t fy,
+                                       channel_uint8_t *pOut)
+{
+    const int output_w = common->output_w;
+    const int nb = common->nb_channels;
+
+    for (int c = 0; c < output_w; c += 4)
+    {
+        mve_pred16_t p = vctp32q((uint32_t)(output_w - c));
+        uint32x4_t vOffset = vmulq_n_u32(vidupq_n_u32((uint32_t)c, 1), (uint32_t)nb);
+
+        for (int k = 0; k < nb; k++)
+        {
+            uint32x4_t v = vldrhq_z_u32(&pLine0[k * output_w + c], p);
+            if (fy == 0)
+            {
+                v = vshrq_n_u32(vaddq_n_u32(v, 128), 8);
+            }
+            else
+            {
+                uint32x4_t v1 = vldrhq_z_u32(&pLine1[k * output_w + c], p);
+                v = vmulq_n_u32(v, 256 - fy);
+                v = vmlaq_n_u32(v, v1, fy);
+                v = vshrq_n_u32(vaddq_n_u32(v, 32768), 16);
+            }
+            if (nb == 1)
+            {
+                vstrbq_p_u32(&pOut[c], v, p);
+            }
+            else
+            {
+                vstrbq_scatter_offset_p_u32(pOut, vaddq_n_u32(vOffset, (uint32_t)k), v, p);
+            }
+        }
+    }
+}
+#else
+static void arm_image_resize_row_fixp(const _common_resize_fixp_t *common,
+                                      const channel_uint8_t *pRow,
+                                      uint16_t *pLine)
+{
+    const int output_w = common->output_w;
+    const int nb = common->nb_channels;
+    const uint32_t w_scale = common->w_scale;
+    const arm_image_resize_plan_t *plan = common->plan;
+    const uint32_t last = (uint32_t)(common->input_w - 1);
+
+    for (int c = 0; c < output_w; c++)
+    {
+        uint32_t ix, ix1, fx;
+        if (plan != NULL)
+        {
+            ix = plan->xIndex[c];
+            ix1 = plan->xIndex1[c];
+            fx = plan->xWeight[c];
+        }
+        else
+        {
+            arm_image_resize_pos_fixp((uint32_t)c, w_scale, last, &ix, &ix1, &fx);
+        }
+
+        ix = ix * nb;
+        ix1 = ix1 * nb;
+        for (int k = 0; k < nb; k++)
+        {
+            pLine[k * output_w + c] = (uint16_t)(pRow[ix + k] * (256 - fx) + pRow[ix1 + k] * fx);
+        }
+    }
+}
+
+static void arm_image_resize_vert_fixp(const _common_resize_fixp_t *common,
+                                       const uint16_t *pLine0,
+                                       const uint16_t *pLine1,
+                                       const uint32_t fy,
+                                       channel_uint8_t *pOut)
+{
+    const int output_w = common->output_w;
+    const int nb = common->nb_channels;
+
+    for (int k = 0; k < nb; k++)
+    {
+        const uint16_t *p0 = &pLine0[k * output_w];
+        const uint16_t *p1 = &pLine1[k * output_w];
+        if (fy == 0)
+        {
+            for (int c = 0; c < output_w; c++)
+            {
+                pOut[c * nb + k] = (channel_uint8_t)((p0[c] + 128) >> 8);
+            }
+        }
+        else
+        {
+            for (int c = 0; c < output_w; c++)
+            {
+                uint32_t v = p0[c] * (256 - fy) + p1[c] * fy;
+                pOut[c * nb + k] = (channel_uint8_t)((v + 32768) >> 16);
+            }
+        }
+    }
+}
+#endif
+
+void arm_image_resize_rows_init_fixp(_resize_fixp_rows_t *rows,
+                                     const _common_resize_fixp_t *common,
+                                     uint16_t *p_lines)
+{
+    rows->common = common;
+    rows->pLine0 = p_lines;
+    rows->pLine1 = p_lines + common->output_w * common->nb_channels;
+    rows->row0 = -1;
+    rows->row1 = -1;
+}
+
+void arm_image_resize_output_row_fixp(_resize_fixp_rows_t *rows,
+                                      const int r,
+                                      channel_uint8_t *pOut)
+{
+    const _common_resize_fixp_t *common = rows->common;
+    const int input_h = common->input_h;
+    const int input_stride = common->input_stride;
+    const arm_image_resize_plan_t *plan = common->plan;
+
+    uint32_t y, y1, fy;
+    if (plan != NULL)
+    {
+        y = plan->yIndex[r];
+        y1 = (y + 1 < (uint32_t)input_h) ? y + 1 : (uint32_t)(input_h - 1);
+        fy = plan->yWeight[r];
+    }
+    else
+    {
+        arm_image_resize_pos_fixp((uint32_t)r, common->h_scale, (uint32_t)(input_h - 1), &y, &y1, &fy);
+    }
+    int iy = (int)y;
+    int iy1 = (int)y1;
+
+    if (iy != rows->row0)
+    {
+        if (iy == rows->row1)
+        {
+            uint16_t *tmp = rows->pLine0;
+            rows->pLine0 = rows->pLine1;
+            rows->pLine1 = tmp;
+            rows->row1 = rows->row0;
+        }
+        else
+        {
+            arm_image_resize_row_fixp(common, common->pIn + iy * input_stride, rows->pLine0);
+        }
+        rows->row0 = iy;
+    }
+    if ((fy != 0) && (iy1 != rows->row1))
+    {
+        arm_image_resize_row_fixp(common, common->pIn + iy1 * input_stride, rows->pLine1);
+        rows->row1 = iy1;
+    }
+
+    arm_image_resize_vert_fixp(common, rows->pLine0, rows->pLine1, fy, pOut);
+}
+
+void arm_image_resize_common_fixp(const _common_resize_fixp_t *common,
+                                  uint16_t *p_lines)
+{
+    _resize_fixp_rows_t rows;
+    arm_image_resize_rows_init_fixp(&rows, common, p_lines);
+
+    for (int r = 0; r < common->output_h; r++)
+    {
+        arm_image_resize_output_row_fixp(&rows, r, common->pOut + r * common->output_stride);
+    }
+}
+
+/**
+  @ingroup imageTransform
+ */
+
+/**
+ * @brief      Return the scratch size for the fixed point resize functions
+ *
+ * @param[in]     outputWidth  The width of the output image
+ * @param[in]     nbChannels   Number of interleaved channels (1 for gray8 and bgr_8U3C, 3 for rgb24)
+ * @return		  Scratch size in bytes
+ */
+uint32_t arm_get_scratch_size_resize_fixp(const int outputWidth, const uint8_t nbChannels)
+{
+    return (2 * outputWidth * nbChannels * sizeof(uint16_t));
+}
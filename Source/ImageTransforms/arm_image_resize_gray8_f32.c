@@ -55,6 +55,9 @@ void arm_image_resize_gray8_f32(const arm_cv_image_gray8_t* ImageIn,
     common.output_w = ImageOut->width;
     common.output_h = ImageOut->height;
 
+    common.input_stride = ARM_CV_IMAGE_STRIDE(ImageIn, 1);
+    common.output_stride = ARM_CV_IMAGE_STRIDE(ImageOut, 1);
+
  
     common.pIn  = ImageIn->pData;
 
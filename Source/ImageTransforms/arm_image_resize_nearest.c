@@ -0,0 +1,272 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS CV Library
+ * Title:        arm_image_resize_nearest.c
+ * Description:  nearest neighbour resize
+ *
+ * Target Processor: Cortex-M
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2024 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "cv/image_transforms.h"
+
+/*
+
+The output pixel (c, r) is the input pixel
+(c * input_w / output_w, r * input_h / output_h), rounded down.
+
+The offsets of the input pixels in a row are computed once in the
+scratch and used for all the rows. When several output rows come from
+the same input row (upscale), the previous output row is copied.
+
+*/
+
+typedef struct {
+    int input_w;
+    int input_h;
+
+    int output_w;
+    int output_h;
+
+    int input_stride;
+    int output_stride;
+
+    int nb_channels;
+
+    const channel_uint8_t *pIn;
+    channel_uint8_t *pOut;
+} _common_resize_nearest_t;
+
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+static void arm_image_resize_nearest_row(const channel_uint8_t *pRow,
+                                         channel_uint8_t *pOut,
+                                         const uint32_t *scratch,
+                                         const int output_w,
+                                         const int nb)
+{
+    if (nb == 1)
+    {
+        const uint16_t *pOffset = (const uint16_t *)scratch;
+        for (int c = 0; c < output_w; c += 8)
+        {
+            mve_pred16_t p = vctp16q((uint32_t)(output_w - c));
+            uint16x8_t offset = vld1q_z_u16(&pOffset[c], p);
+            vstrbq_p_u16(&pOut[c], vldrbq_gather_offset_z_u16(pRow, offset, p), p);
+        }
+    }
+    else
+    {
+        const uint32x4_t vStore = vmulq_n_u32(vidupq_n_u32(0, 1), (uint32_t)nb);
+        for (int c = 0; c < output_w; c += 4)
+        {
+            mve_pred16_t p = vctp32q((uint32_t)(output_w - c));
+            uint32x4_t offset = vld1q_z_u32(&scratch[c], p);
+            for (int k = 0; k < nb; k++)
+            {
+                uint32x4_t v = vldrbq_gather_offset_z_u32(pRow + k, offset, p);
+                vstrbq_scatter_offset_p_u32(&pOut[c * nb + k], vStore, v, p);
+            }
+        }
+    }
+}
+#else
+static void arm_image_resize_nearest_row(const channel_uint8_t *pRow,
+                                         channel_uint8_t *pOut,
+                                         const uint32_t *scratch,
+                                         const int output_w,
+                                         const int nb)
+{
+    if (nb == 1)
+    {
+        const uint16_t *pOffset = (const uint16_t *)scratch;
+        for (int c = 0; c < output_w; c++)
+        {
+            pOut[c] = pRow[pOffset[c]];
+        }
+    }
+    else
+    {
+        for (int c = 0; c < output_w; c++)
+        {
+            for (int k = 0; k < nb; k++)
+            {
+                pOut[c * nb + k] = pRow[scratch[c] + k];
+            }
+        }
+    }
+}
+#endif
+
+static void arm_image_resize_nearest_common(const _common_resize_nearest_t *common, uint32_t *scratch)
+{
+    const uint32_t input_w = (uint32_t)common->input_w;
+    const uint32_t input_h = (uint32_t)common->input_h;
+    const uint32_t output_w = (uint32_t)common->output_w;
+    const uint32_t output_h = (uint32_t)common->output_h;
+    const int nb = common->nb_channels;
+    int previous = -1;
+
+    /* The offsets of a gray row fit in 16 bits */
+    for (uint32_t c = 0; c < output_w; c++)
+    {
+        uint32_t offset = ((c * input_w) / output_w) * nb;
+        if (nb == 1)
+        {
+            ((uint16_t *)scratch)[c] = (uint16_t)offset;
+        }
+        else
+        {
+            scratch[c] = offset;
+        }
+    }
+
+    for (uint32_t r = 0; r < output_h; r++)
+    {
+        int y = (int)((r * input_h) / output_h);
+        channel_uint8_t *pOut = common->pOut + r * common->output_stride;
+
+        if (y == previous)
+        {
+            memcpy(pOut, pOut - common->output_stride, output_w * nb);
+        }
+        else
+        {
+            arm_image_resize_nearest_row(common->pIn + y * common->input_stride, pOut, scratch, output_w, nb);
+            previous = y;
+        }
+    }
+}
+
+/**
+  @ingroup imageTransform
+ */
+
+/**
+ * @brief      Return the scratch size for the nearest neighbour resize functions
+ *
+ * @param[in]     outputWidth  The width of the output image
+ * @return		  Scratch size in bytes
+ */
+uint32_t arm_get_scratch_size_resize_nearest(const int outputWidth)
+{
+    return (outputWidth * sizeof(uint32_t));
+}
+
+/**
+  @ingroup imageTransform
+ */
+
+/**
+ * @brief      Resize a gray8 image with the nearest neighbour
+ *
+ * @param[in]      ImageIn   The input image
+ * @param          ImageOut  The output image
+ * @param[in,out]  scratch   Temporary buffer
+ *
+ * @par  Temporary buffer sizing:
+ * arm_get_scratch_size_resize_nearest(ImageOut->width)
+ *
+ * @par  Dimensions
+ *       The output can be smaller or bigger than the input
+ */
+void arm_image_resize_nearest_gray8(const arm_cv_image_gray8_t *ImageIn,
+                                    arm_cv_image_gray8_t *ImageOut,
+                                    uint32_t *scratch)
+{
+    _common_resize_nearest_t common;
+
+    common.input_w = ImageIn->width;
+    common.input_h = ImageIn->height;
+    common.output_w = ImageOut->width;
+    common.output_h = ImageOut->height;
+    common.input_stride = ARM_CV_IMAGE_STRIDE(ImageIn, 1);
+    common.output_stride = ARM_CV_IMAGE_STRIDE(ImageOut, 1);
+    common.nb_channels = 1;
+
+    common.pIn = ImageIn->pData;
+    common.pOut = ImageOut->pData;
+    arm_image_resize_nearest_common(&common, scratch);
+}
+
+/**
+  @ingroup imageTransform
+ */
+
+/**
+ * @brief      Resize a BGR 8U3C image with the nearest neighbour
+ *
+ * @param[in]      ImageIn   The input image
+ * @param          ImageOut  The output image
+ * @param[in,out]  scratch   Temporary buffer
+ *
+ * @par  Temporary buffer sizing:
+ * arm_get_scratch_size_resize_nearest(ImageOut->width)
+ */
+void arm_image_resize_nearest_bgr_8U3C(const arm_cv_image_bgr_8U3C_t *ImageIn,
+                                       arm_cv_image_bgr_8U3C_t *ImageOut,
+                                       uint32_t *scratch)
+{
+    _common_resize_nearest_t common;
+
+    common.input_w = ImageIn->width;
+    common.input_h = ImageIn->height;
+    common.output_w = ImageOut->width;
+    common.output_h = ImageOut->height;
+    common.input_stride = ARM_CV_IMAGE_STRIDE(ImageIn, 1);
+    common.output_stride = ARM_CV_IMAGE_STRIDE(ImageOut, 1);
+    common.nb_channels = 1;
+
+    for (int plane = 0; plane < 3; plane++)
+    {
+        common.pIn = ImageIn->pData + plane * (common.input_stride * common.input_h);
+        common.pOut = ImageOut->pData + plane * (common.output_stride * common.output_h);
+        arm_image_resize_nearest_common(&common, scratch);
+    }
+}
+
+/**
+  @ingroup imageTransform
+ */
+
+/**
+ * @brief      Resize a RGB24 image with the nearest neighbour
+ *
+ * @param[in]      ImageIn   The input image
+ * @param          ImageOut  The output image
+ * @param[in,out]  scratch   Temporary buffer
+ *
+ * @par  Temporary buffer sizing:
+ * arm_get_scratch_size_resize_nearest(ImageOut->width)
+ */
+void arm_image_resize_nearest_rgb24(const arm_cv_image_rgb24_t *ImageIn,
+                                    arm_cv_image_rgb24_t *ImageOut,
+                                    uint32_t *scratch)
+{
+    _common_resize_nearest_t common;
+
+    common.input_w = ImageIn->width;
+    common.input_h = ImageIn->height;
+    common.output_w = ImageOut->width;
+    common.output_h = ImageOut->height;
+    common.input_stride = ARM_CV_IMAGE_STRIDE(ImageIn, 3);
+    common.output_stride = ARM_CV_IMAGE_STRIDE(ImageOut, 3);
+    common.nb_channels = 3;
+
+    common.pIn = ImageIn->pData;
+    common.pOut = ImageOut->pData;
+    arm_image_resize_nearest_common(&common, scratch);
+}
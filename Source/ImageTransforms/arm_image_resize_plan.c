@@ -0,0 +1,242 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS CV Library
+ * Title:        arm_image_resize_plan.c
+ * Description:  fixed point resize with precomputed positions
+ *
+ * Target Processor: Cortex-M
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2024 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cv/image_transforms.h"
+#include "arm_image_resize_common.h"
+
+/**
+  @ingroup imageTransform
+ */
+
+/**
+ * @brief      Return the size of the buffer of a resize plan
+ *
+ * @param[in]     outputWidth   The width of the output image
+ * @param[in]     outputHeight  The height of the output image
+ * @return		  Buffer size in bytes
+ */
+uint32_t arm_get_buffer_size_resize_plan(const int outputWidth, const int outputHeight)
+{
+    return (outputWidth * (2 * sizeof(uint16_t) + sizeof(uint8_t)) +
+            outputHeight * (sizeof(uint16_t) + sizeof(uint8_t)));
+}
+
+/**
+  @ingroup imageTransform
+ */
+
+/**
+ * @brief          Compute the positions used by the fixed point resize
+ *
+ * @param[out]     plan          The resize plan
+ * @param[in]      inputWidth    The width of the input image
+ * @param[in]      inputHeight   The height of the input image
+ * @param[in]      outputWidth   The width of the output image
+ * @param[in]      outputHeight  The height of the output image
+ * @param[in,out]  buffer        Buffer for the tables of the plan, 16 bits aligned
+ *
+ * @par  Buffer sizing:
+ * arm_get_buffer_size_resize_plan(outputWidth, outputHeight)
+ *
+ * The plan only needs to be computed once for a pair of input and output
+ * sizes and can be used for all the frames and all the image formats.
+ * The result of the resize is the same as without a plan.
+ */
+void arm_image_resize_plan_init(arm_image_resize_plan_t *plan,
+                                const uint16_t inputWidth,
+                                const uint16_t inputHeight,
+                                const uint16_t outputWidth,
+                                const uint16_t outputHeight,
+                                uint8_t *buffer)
+{
+    _common_resize_fixp_t common;
+    uint32_t idx, idx1, weight;
+
+    common.input_w = inputWidth;
+    common.input_h = inputHeight;
+    common.output_w = outputWidth;
+    common.output_h = outputHeight;
+    arm_image_resize_common_init_fixp(&common);
+
+    plan->inputWidth = inputWidth;
+    plan->inputHeight = inputHeight;
+    plan->outputWidth = outputWidth;
+    plan->outputHeight = outputHeight;
+
+    /* 16 bits tables first to keep them aligned */
+    plan->xIndex = (uint16_t *)buffer;
+    plan->xIndex1 = plan->xIndex + outputWidth;
+    plan->yIndex = plan->xIndex1 + outputWidth;
+    plan->xWeight = (uint8_t *)(plan->yIndex + outputHeight);
+    plan->yWeight = plan->xWeight + outputWidth;
+
+    for (int c = 0; c < outputWidth; c++)
+    {
+        arm_image_resize_pos_fixp((uint32_t)c, common.w_scale, (uint32_t)(inputWidth - 1), &idx, &idx1, &weight);
+        plan->xIndex[c] = (uint16_t)idx;
+        plan->xIndex1[c] = (uint16_t)idx1;
+        plan->xWeight[c] = (uint8_t)weight;
+    }
+
+    for (int r = 0; r < outputHeight; r++)
+    {
+        arm_image_resize_pos_fixp((uint32_t)r, common.h_scale, (uint32_t)(inputHeight - 1), &idx, &idx1, &weight);
+        plan->yIndex[r] = (uint16_t)idx;
+        plan->yWeight[r] = (uint8_t)weight;
+    }
+}
+
+static void arm_image_resize_plan_common(const arm_image_resize_plan_t *plan,
+                                         _common_resize_fixp_t *common,
+                                         const int nbChannels)
+{
+    common->input_w = plan->inputWidth;
+    common->input_h = plan->inputHeight;
+    common->output_w = plan->outputWidth;
+    common->output_h = plan->outputHeight;
+    common->nb_channels = nbChannels;
+
+    /* The scales are not used when there is a plan */
+    common->w_scale = 0;
+    common->h_scale = 0;
+    common->plan = plan;
+}
+
+/**
+  @ingroup imageTransform
+ */
+
+/**     
+ * @brief      Resize gray image with a plan (fixed point implementation)
+ *
+ * @param[in]  plan      The resize plan
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ * @param[in,out]  p_lines   Temporary buffer
+ * 
+ * @par  Temporary buffer sizing:
+ * 
+ * Size of temporary buffers:
+ *   - p_lines\n
+ *     arm_get_scratch_size_resize_fixp(ImageOut->width, 1)
+ *
+ * The images must have the sizes used to compute the plan.
+ * The result is the same as arm_image_resize_gray8_fixp.
+ */
+void arm_image_resize_gray8_plan(const arm_image_resize_plan_t *plan,
+                                 const arm_cv_image_gray8_t* ImageIn,
+                                       arm_cv_image_gray8_t* ImageOut,
+                                       uint16_t *p_lines)
+{
+    _common_resize_fixp_t common;
+
+    arm_image_resize_plan_common(plan, &common, 1);
+
+    common.input_stride = ARM_CV_IMAGE_STRIDE(ImageIn, 1);
+    common.output_stride = ARM_CV_IMAGE_STRIDE(ImageOut, 1);
+
+    common.pIn  = ImageIn->pData;
+    common.pOut = ImageOut->pData;
+    arm_image_resize_common_fixp(&common,p_lines);
+}
+
+/**
+  @ingroup imageTransform
+ */
+
+/**     
+ * @brief      Resize BGR 8U3C image with a plan (fixed point implementation)
+ *
+ * @param[in]  plan      The resize plan
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ * @param[in,out]  p_lines   Temporary buffer
+ * 
+ * @par  Temporary buffer sizing:
+ * 
+ * Size of temporary buffers:
+ *   - p_lines\n
+ *     arm_get_scratch_size_resize_fixp(ImageOut->width, 1)
+ *
+ * The images must have the sizes used to compute the plan.
+ * The result is the same as arm_image_resize_bgr_8U3C_fixp.
+ */
+void arm_image_resize_bgr_8U3C_plan(const arm_image_resize_plan_t *plan,
+                                    const arm_cv_image_bgr_8U3C_t* ImageIn,
+                                          arm_cv_image_bgr_8U3C_t* ImageOut,
+                                          uint16_t *p_lines)
+{
+    _common_resize_fixp_t common;
+
+    arm_image_resize_plan_common(plan, &common, 1);
+
+    common.input_stride = ARM_CV_IMAGE_STRIDE(ImageIn, 1);
+    common.output_stride = ARM_CV_IMAGE_STRIDE(ImageOut, 1);
+
+    for (int plane = 0; plane < 3; plane++)
+    {
+        common.pIn  = ImageIn->pData + plane * (common.input_stride * common.input_h);
+        common.pOut = ImageOut->pData + plane * (common.output_stride * common.output_h);
+        arm_image_resize_common_fixp(&common,p_lines);
+    }
+}
+
+/**
+  @ingroup imageTransform
+ */
+
+/**     
+ * @brief      Resize RGB24 image with a plan (fixed point implementation)
+ *
+ * @param[in]  plan      The resize plan
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ * @param[in,out]  p_lines   Temporary buffer
+ * 
+ * @par  Temporary buffer sizing:
+ * 
+ * Size of temporary buffers:
+ *   - p_lines\n
+ *     arm_get_scratch_size_resize_fixp(ImageOut->width, 3)
+ *
+ * The images must have the sizes used to compute the plan.
+ * The result is the same as arm_image_resize_rgb24_fixp.
+ */
+void arm_image_resize_rgb24_plan(const arm_image_resize_plan_t *plan,
+                                 const arm_cv_image_rgb24_t* ImageIn,
+                                       arm_cv_image_rgb24_t* ImageOut,
+                                       uint16_t *p_lines)
+{
+    _common_resize_fixp_t common;
+
+    arm_image_resize_plan_common(plan, &common, 3);
+
+    common.input_stride = ARM_CV_IMAGE_STRIDE(ImageIn, 3);
+    common.output_stride = ARM_CV_IMAGE_STRIDE(ImageOut, 3);
+
+    common.pIn  = ImageIn->pData;
+    common.pOut = ImageOut->pData;
+    arm_image_resize_common_fixp(&common,p_lines);
+}
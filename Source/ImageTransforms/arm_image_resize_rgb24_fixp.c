@@ -0,0 +1,72 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS CV Library
+ * Title:        arm_image_resize_rgb24_fixp
+ * Description:  fixed point image resize of rgb24
+ *
+ * Target Processor: Cortex-M
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2024 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cv/image_transforms.h"
+#include "arm_image_resize_common.h"
+
+/**
+  @ingroup imageTransform
+ */
+
+
+/**     
+ * @brief      Resize RGB24 image (fixed point implementation)
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ * @param[in,out]  p_lines   Temporary buffer
+ * 
+ * @par  Temporary buffer sizing:
+ * 
+ * Size of temporary buffers:
+ *   - p_lines\n
+ *     arm_get_scratch_size_resize_fixp(ImageOut->width, 3)
+ *
+ * @par  Interpolation
+ *       Same as arm_image_resize_gray8_fixp, applied to each channel
+ */
+void arm_image_resize_rgb24_fixp(const arm_cv_image_rgb24_t* ImageIn,
+                                       arm_cv_image_rgb24_t* ImageOut,
+                                       uint16_t *p_lines)
+{
+    _common_resize_fixp_t common;
+
+    common.input_w = ImageIn->width;
+    common.input_h = ImageIn->height;
+
+    common.output_w = ImageOut->width;
+    common.output_h = ImageOut->height;
+
+    common.input_stride = ARM_CV_IMAGE_STRIDE(ImageIn, 3);
+    common.output_stride = ARM_CV_IMAGE_STRIDE(ImageOut, 3);
+
+    common.nb_channels = 3;
+
+    arm_image_resize_common_init_fixp(&common);
+
+    common.pIn  = ImageIn->pData;
+    common.pOut = ImageOut->pData;
+    arm_image_resize_common_fixp(&common,p_lines);
+}
@@ -0,0 +1,303 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS CV Library
+ * Title:        arm_image_resize_yuv420_to_rgb24_fixp
+ * Description:  Resize a YUV420, NV12 or NV21 image and convert it to RGB24
+ *
+ * Target Processor: Cortex-M
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2024 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "cv/image_transforms.h"
+#include "arm_image_resize_common.h"
+#include "dsp/none.h"
+
+/*
+
+The Y, U and V planes are resized independently to the output
+dimensions with the fixed point bilinear interpolation. Only one
+output row of each plane is kept: it is converted to RGB24 with the
+same Q17 coefficients as arm_yuv420_to_rgb24 before the next row is
+computed. The full resolution chroma planes are never built.
+
+The interleaved UV plane of NV12 and NV21 is resized as an image
+with 2 channels so it is never de-interleaved in memory.
+
+*/
+
+// Conversion of one row of resized Y, U and V.
+// stepUV is 2 when U and V are interleaved
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+#define YUV_TO_RGB(FA,FB,FC)                              \
+    tmp = vmulq_n_s32(yw, (FA));                          \
+    tmp = vmlaq_n_s32(tmp, uw, (FB));                     \
+    tmp = vmlaq_n_s32(tmp, vw, (FC));                     \
+    tmp = vmaxq_s32(tmp, vdupq_n_s32(0));                 \
+    tmp = vshrq_n_s32(tmp, 17);                           \
+    tmp = vminq_s32(tmp, vdupq_n_s32(255));
+
+static void arm_yuv_row_to_rgb24(const channel_uint8_t *pY,
+                                 const channel_uint8_t *pU,
+                                 const channel_uint8_t *pV,
+                                 const uint32_t stepUV,
+                                 const int nbCols,
+                                 channel_uint8_t *pOut)
+{
+    for (int c = 0; c < nbCols; c += 4)
+    {
+        mve_pred16_t p = vctp32q((uint32_t)(nbCols - c));
+        uint32x4_t vOffset = vmulq_n_u32(vidupq_n_u32((uint32_t)c, 1), 3);
+        uint32x4_t vOffsetUV = vmulq_n_u32(vidupq_n_u32((uint32_t)c, 1), stepUV);
+        int32x4_t tmp;
+
+        int32x4_t yw = vreinterpretq_s32_u32(vldrbq_z_u32(&pY[c], p));
+        int32x4_t uw = vreinterpretq_s32_u32(vldrbq_gather_offset_z_u32(pU, vOffsetUV, p));
+        int32x4_t vw = vreinterpretq_s32_u32(vldrbq_gather_offset_z_u32(pV, vOffsetUV, p));
+        yw = vsubq_n_s32(yw, 16);
+        uw = vsubq_n_s32(uw, 128);
+        vw = vsubq_n_s32(vw, 128);
+
+        // Fixed point coefficients are in Q17 format
+        YUV_TO_RGB(152586, -234, 209163);
+        vstrbq_scatter_offset_p_u32(pOut, vOffset, vreinterpretq_u32_s32(tmp), p);
+
+        YUV_TO_RGB(152586, -51307, -106625);
+        vstrbq_scatter_offset_p_u32(pOut, vaddq_n_u32(vOffset, 1), vreinterpretq_u32_s32(tmp), p);
+
+        YUV_TO_RGB(152586, 264481, -163);
+        vstrbq_scatter_offset_p_u32(pOut, vaddq_n_u32(vOffset, 2), vreinterpretq_u32_s32(tmp), p);
+    }
+}
+#else
+static void arm_yuv_row_to_rgb24(const channel_uint8_t *pY,
+                                 const channel_uint8_t *pU,
+                                 const channel_uint8_t *pV,
+                                 const uint32_t stepUV,
+                                 const int nbCols,
+                                 channel_uint8_t *pOut)
+{
+    for (int c = 0; c < nbCols; c++)
+    {
+        int32_t y = pY[c] - 16;
+        int32_t u = pU[c * stepUV] - 128;
+        int32_t v = pV[c * stepUV] - 128;
+        int32_t tmp;
+
+        // Fixed point coefficients are in Q17 format
+        tmp = 152586 * y - 234 * u + 209163 * v;
+        tmp = (tmp < 0) ? 0 : tmp;
+        pOut[3 * c] = (channel_uint8_t)__USAT((uint16_t)(tmp >> 17), 8);
+
+        tmp = 152586 * y - 51307 * u - 106625 * v;
+        tmp = (tmp < 0) ? 0 : tmp;
+        pOut[3 * c + 1] = (channel_uint8_t)__USAT((uint16_t)(tmp >> 17), 8);
+
+        tmp = 152586 * y + 264481 * u - 163 * v;
+        tmp = (tmp < 0) ? 0 : tmp;
+        pOut[3 * c + 2] = (channel_uint8_t)__USAT((uint16_t)(tmp >> 17), 8);
+    }
+}
+#endif
+
+static void arm_image_resize_yuv420_plane_init(_common_resize_fixp_t *common,
+                                               const int nb_channels,
+                                               const int input_w,
+                                               const int input_h,
+                                               const int input_stride,
+                                               channel_uint8_t *pIn,
+                                               const arm_cv_image_rgb24_t *ImageOut)
+{
+    common->input_w = input_w;
+    common->input_h = input_h;
+
+    common->output_w = ImageOut->width;
+    common->output_h = ImageOut->height;
+
+    common->input_stride = input_stride;
+    common->output_stride = ImageOut->width * nb_channels;
+
+    common->nb_channels = nb_channels;
+
+    arm_image_resize_common_init_fixp(common);
+
+    common->pIn = pIn;
+    common->pOut = NULL;
+}
+
+/**
+  @ingroup imageTransform
+ */
+
+/**
+ * @brief      Return the scratch size for arm_image_resize_yuv420_to_rgb24_fixp,
+ *             arm_image_resize_nv12_to_rgb24_fixp and arm_image_resize_nv21_to_rgb24_fixp
+ *
+ * @param[in]     outputWidth  The width of the output image
+ * @return		  Scratch size in bytes
+ */
+uint32_t arm_get_scratch_size_resize_yuv420_to_rgb24_fixp(const int outputWidth)
+{
+    return (3 * arm_get_scratch_size_resize_fixp(outputWidth, 1) +
+            3 * outputWidth * sizeof(channel_uint8_t));
+}
+
+/**
+ * @brief      Resize YUV420 image and convert to RGB24 (fixed point implementation)
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ * @param[in,out]  p_lines   Temporary buffer
+ *
+ * @par  Temporary buffer sizing:
+ *
+ * Size of temporary buffers:
+ *   - p_lines\n
+ *     arm_get_scratch_size_resize_yuv420_to_rgb24_fixp(ImageOut->width)
+ *
+ * @par  Interpolation
+ *       Each plane is resized like in arm_image_resize_gray8_fixp, the
+ *       chroma planes directly from their half resolution, and the
+ *       result is converted like in arm_yuv420_to_rgb24. Only the
+ *       input pixels needed for the output are read.
+ */
+void arm_image_resize_yuv420_to_rgb24_fixp(const arm_cv_image_yuv420_t* ImageIn,
+                                                 arm_cv_image_rgb24_t* ImageOut,
+                                                 uint16_t *p_lines)
+{
+    const int width = ImageIn->width;
+    const int height = ImageIn->height;
+    const int output_w = ImageOut->width;
+    const uint32_t strideY = ARM_CV_IMAGE_STRIDE(ImageIn, 1);
+    const uint32_t strideUV = strideY >> 1;
+    const uint32_t strideOut = ARM_CV_IMAGE_STRIDE(ImageOut, 3);
+
+    channel_uint8_t *pYPlane = ImageIn->pData;
+    channel_uint8_t *pUPlane = pYPlane + strideY * height;
+    channel_uint8_t *pVPlane = pUPlane + strideUV * (height >> 1);
+
+    _common_resize_fixp_t commonY, commonU, commonV;
+    _resize_fixp_rows_t rowsY, rowsU, rowsV;
+
+    arm_image_resize_yuv420_plane_init(&commonY, 1, width, height, strideY, pYPlane, ImageOut);
+    arm_image_resize_yuv420_plane_init(&commonU, 1, width >> 1, height >> 1, strideUV, pUPlane, ImageOut);
+    arm_image_resize_yuv420_plane_init(&commonV, 1, width >> 1, height >> 1, strideUV, pVPlane, ImageOut);
+
+    arm_image_resize_rows_init_fixp(&rowsY, &commonY, p_lines);
+    arm_image_resize_rows_init_fixp(&rowsU, &commonU, p_lines + 2 * output_w);
+    arm_image_resize_rows_init_fixp(&rowsV, &commonV, p_lines + 4 * output_w);
+
+    channel_uint8_t *pY = (channel_uint8_t *)(p_lines + 6 * output_w);
+    channel_uint8_t *pU = pY + output_w;
+    channel_uint8_t *pV = pU + output_w;
+
+    for (int r = 0; r < ImageOut->height; r++)
+    {
+        arm_image_resize_output_row_fixp(&rowsY, r, pY);
+        arm_image_resize_output_row_fixp(&rowsU, r, pU);
+        arm_image_resize_output_row_fixp(&rowsV, r, pV);
+
+        arm_yuv_row_to_rgb24(pY, pU, pV, 1, output_w, ImageOut->pData + r * strideOut);
+    }
+}
+
+/* Y plane and interleaved chroma plane. uFirst is 1 when the
+   chroma pairs are U,V (NV12) and 0 when they are V,U (NV21) */
+static void arm_image_resize_semi_planar_to_rgb24_fixp(channel_uint8_t *pData,
+                                                       const int width,
+                                                       const int height,
+                                                       const uint32_t strideY,
+                                                       const int uFirst,
+                                                       arm_cv_image_rgb24_t* ImageOut,
+                                                       uint16_t *p_lines)
+{
+    const int output_w = ImageOut->width;
+    const uint32_t strideOut = ARM_CV_IMAGE_STRIDE(ImageOut, 3);
+
+    _common_resize_fixp_t commonY, commonUV;
+    _resize_fixp_rows_t rowsY, rowsUV;
+
+    arm_image_resize_yuv420_plane_init(&commonY, 1, width, height, strideY, pData, ImageOut);
+    arm_image_resize_yuv420_plane_init(&commonUV, 2, width >> 1, height >> 1, strideY,
+                                       pData + strideY * height, ImageOut);
+
+    arm_image_resize_rows_init_fixp(&rowsY, &commonY, p_lines);
+    arm_image_resize_rows_init_fixp(&rowsUV, &commonUV, p_lines + 2 * output_w);
+
+    channel_uint8_t *pY = (channel_uint8_t *)(p_lines + 6 * output_w);
+    channel_uint8_t *pUV = pY + output_w;
+    const channel_uint8_t *pU = uFirst ? pUV : pUV + 1;
+    const channel_uint8_t *pV = uFirst ? pUV + 1 : pUV;
+
+    for (int r = 0; r < ImageOut->height; r++)
+    {
+        arm_image_resize_output_row_fixp(&rowsY, r, pY);
+        arm_image_resize_output_row_fixp(&rowsUV, r, pUV);
+
+        arm_yuv_row_to_rgb24(pY, pU, pV, 2, output_w, ImageOut->pData + r * strideOut);
+    }
+}
+
+/**
+ * @brief      Resize NV12 image and convert to RGB24 (fixed point implementation)
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ * @param[in,out]  p_lines   Temporary buffer
+ *
+ * @par  Temporary buffer sizing:
+ *
+ * Size of temporary buffers:
+ *   - p_lines\n
+ *     arm_get_scratch_size_resize_yuv420_to_rgb24_fixp(ImageOut->width)
+ *
+ * @par  Interpolation
+ *       Same as arm_image_resize_yuv420_to_rgb24_fixp
+ */
+void arm_image_resize_nv12_to_rgb24_fixp(const arm_cv_image_nv12_t* ImageIn,
+                                               arm_cv_image_rgb24_t* ImageOut,
+                                               uint16_t *p_lines)
+{
+    arm_image_resize_semi_planar_to_rgb24_fixp(ImageIn->pData, ImageIn->width, ImageIn->height,
+                                               ARM_CV_IMAGE_STRIDE(ImageIn, 1), 1,
+                                               ImageOut, p_lines);
+}
+
+/**
+ * @brief      Resize NV21 image and convert to RGB24 (fixed point implementation)
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The output image
+ * @param[in,out]  p_lines   Temporary buffer
+ *
+ * @par  Temporary buffer sizing:
+ *
+ * Size of temporary buffers:
+ *   - p_lines\n
+ *     arm_get_scratch_size_resize_yuv420_to_rgb24_fixp(ImageOut->width)
+ *
+ * @par  Interpolation
+ *       Same as arm_image_resize_yuv420_to_rgb24_fixp
+ */
+void arm_image_resize_nv21_to_rgb24_fixp(const arm_cv_image_nv21_t* ImageIn,
+                                               arm_cv_image_rgb24_t* ImageOut,
+                                               uint16_t *p_lines)
+{
+    arm_image_resize_semi_planar_to_rgb24_fixp(ImageIn->pData, ImageIn->width, ImageIn->height,
+                                               ARM_CV_IMAGE_STRIDE(ImageIn, 1), 0,
+                                               ImageOut, p_lines);
+}
@@ -0,0 +1,99 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS CV Library
+ * Title:        arm_image_view
+ * Description:  Region of interest of an image without copy
+ *
+ * Target Processor: Cortex-M
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2024 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "cv/image_transforms.h"
+
+/**
+  @ingroup imageTransform
+ */
+
+
+/**
+ * @brief      Gray8 view of a region of an image
+ *
+ * @param[in]  ImageIn   The image in
+ * @param[out] ImageOut  The view
+ * @param[in]  left      The left boundary
+ * @param[in]  top       The top boundary
+ * @param[in]  right     The right boundary
+ * @param[in]  bottom    The bottom boundary
+ *
+ * @par No copy
+ *      ImageOut points to the pixels of ImageIn and has the stride
+ *      of ImageIn. No pixel is copied and ImageIn must remain valid
+ *      while the view is used. arm_crop_gray8 should be used when a
+ *      packed buffer is required.
+ */
+void arm_cv_image_view_gray8(const arm_cv_image_gray8_t* ImageIn,
+                                   arm_cv_image_gray8_t* ImageOut,
+                                   const uint32_t left,
+                                   const uint32_t top,
+                                   const uint32_t right,
+                                   const uint32_t bottom
+                             )
+{
+    const uint32_t strideIn = ARM_CV_IMAGE_STRIDE(ImageIn, 1);
+
+    ImageOut->width = (uint16_t)(right - left);
+    ImageOut->height = (uint16_t)(bottom - top);
+    ImageOut->pData = ImageIn->pData + left + top*strideIn;
+    ImageOut->stride = strideIn;
+}
+
+/**
+  @ingroup imageTransform
+ */
+
+
+/**
+ * @brief      RGB24 view of a region of an image
+ *
+ * @param[in]  ImageIn   The image in
+ * @param[out] ImageOut  The view
+ * @param[in]  left      The left boundary
+ * @param[in]  top       The top boundary
+ * @param[in]  right     The right boundary
+ * @param[in]  bottom    The bottom boundary
+ *
+ * @par No copy
+ *      ImageOut points to the pixels of ImageIn and has the stride
+ *      of ImageIn. No pixel is copied and ImageIn must remain valid
+ *      while the view is used. arm_crop_rgb24 should be used when a
+ *      packed buffer is required.
+ */
+void arm_cv_image_view_rgb24(const arm_cv_image_rgb24_t* ImageIn,
+                                   arm_cv_image_rgb24_t* ImageOut,
+                                   const uint32_t left,
+                                   const uint32_t top,
+                                   const uint32_t right,
+                                   const uint32_t bottom
+                             )
+{
+    const uint32_t strideIn = ARM_CV_IMAGE_STRIDE(ImageIn, 3);
+
+    ImageOut->width = (uint16_t)(right - left);
+    ImageOut->height = (uint16_t)(bottom - top);
+    ImageOut->pData = ImageIn->pData + left*3 + top*strideIn;
+    ImageOut->stride = strideIn;
+}
@@ -0,0 +1,243 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS CV Library
+ * Title:        arm_integral_gray8.c
+ * Description:  Integral image and squared integral image of a gray8 image
+ *
+ * Target Processor: Cortex-M
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2024 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "cv/image_transforms.h"
+
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+/*
+
+Prefix sum inside a vector : [a, a+b, a+b+c, a+b+c+d]
+The whole vector shift by 32 bits is moving each lane to the next one.
+
+*/
+__STATIC_FORCEINLINE uint32x4_t arm_cv_prefix_sum_u32(uint32x4_t vec)
+{
+    uint32_t carry = 0;
+    uint32x4_t tmp;
+
+    vec = vaddq(vec, vshlcq(vec, &carry, 32));
+    carry = 0;
+    tmp = vshlcq(vec, &carry, 32);
+    carry = 0;
+    tmp = vshlcq(tmp, &carry, 32);
+    return(vaddq(vec, tmp));
+}
+#endif
+
+/**
+  @ingroup imageTransform
+ */
+
+
+/**
+ * @brief      Integral image of a gray8 image
+ *
+ * @param[in]  ImageIn   The input image
+ * @param      ImageOut  The integral image, of dimension (width + 1) x (height + 1)
+ *
+ * @par Output format
+ * Same convention as OpenCV : the first row and the first column are 0 and
+ * the pixel (x+1,y+1) contains the sum of all the input pixels in the
+ * rectangle [0,x] x [0,y]. The sum of any rectangle can then be computed
+ * with 4 memory accesses.
+ * The sums fit in an uint32 for images up to 16 Mpixels.
+ */
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+void arm_integral_gray8(const arm_cv_image_gray8_t* ImageIn,
+                              arm_cv_image_u32_t* ImageOut)
+{
+    const int32_t width = ImageIn->width;
+    const int32_t height = ImageIn->height;
+    const int32_t outWidth = width + 1;
+    const uint32_t strideIn = ARM_CV_IMAGE_STRIDE(ImageIn, 1);
+    const uint32_t strideOut = ARM_CV_IMAGE_STRIDE(ImageOut, 1);
+    const uint8_t *pIn = ImageIn->pData;
+    uint32_t *pOut = ImageOut->pData;
+
+    memset(pOut, 0, outWidth * sizeof(uint32_t));
+    for(int32_t row = 0; row < height; row++)
+    {
+        const uint32_t *pPrev = pOut + 1;
+        pOut += strideOut;
+        pOut[0] = 0;
+
+        uint32_t rowSum = 0;
+        for(int32_t x = 0; x < width; x += 4)
+        {
+            mve_pred16_t p0 = vctp32q(width - x);
+            uint32x4_t vec = vldrbq_z_u32(&pIn[x], p0);
+
+            vec = arm_cv_prefix_sum_u32(vec);
+            vec = vaddq_n_u32(vec, rowSum);
+            // Masked lanes are 0 so the last lane is always the sum of the row up to now
+            rowSum = vgetq_lane(vec, 3);
+            vec = vaddq(vec, vldrwq_z_u32(&pPrev[x], p0));
+            vstrwq_p(&pOut[x + 1], vec, p0);
+        }
+        pIn += strideIn;
+    }
+}
+#else
+void arm_integral_gray8(const arm_cv_image_gray8_t* ImageIn,
+                              arm_cv_image_u32_t* ImageOut)
+{
+    const int32_t width = ImageIn->width;
+    const int32_t height = ImageIn->height;
+    const int32_t outWidth = width + 1;
+    const uint32_t strideIn = ARM_CV_IMAGE_STRIDE(ImageIn, 1);
+    const uint32_t strideOut = ARM_CV_IMAGE_STRIDE(ImageOut, 1);
+    const uint8_t *pIn = ImageIn->pData;
+    uint32_t *pOut = ImageOut->pData;
+
+    memset(pOut, 0, outWidth * sizeof(uint32_t));
+    for(int32_t row = 0; row < height; row++)
+    {
+        const uint32_t *pPrev = pOut;
+        pOut += strideOut;
+        pOut[0] = 0;
+
+        uint32_t rowSum = 0;
+        for(int32_t x = 0; x < width; x++)
+        {
+            rowSum += pIn[x];
+            pOut[x + 1] = pPrev[x + 1] + rowSum;
+        }
+        pIn += strideIn;
+    }
+}
+#endif
+
+/**
+  @ingroup imageTransform
+ */
+
+
+/**
+ * @brief      Integral image and squared integral image of a gray8 image
+ *
+ * @param[in]  ImageIn     The input image
+ * @param      ImageOut    The integral image, of dimension (width + 1) x (height + 1)
+ * @param      ImageSqOut  The integral image of the squared pixels, of dimension (width + 1) x (height + 1)
+ *
+ * @par Output format
+ * Same convention as arm_integral_gray8. The squared sums are
+ * accumulated on 64 bits. The squared sum of a row is
+ * computed on 32 bits which is enough for any row width.
+ */
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+void arm_integral_squared_gray8(const arm_cv_image_gray8_t* ImageIn,
+                                      arm_cv_image_u32_t* ImageOut,
+                                      arm_cv_image_u64_t* ImageSqOut)
+{
+    const int32_t width = ImageIn->width;
+    const int32_t height = ImageIn->height;
+    const int32_t outWidth = width + 1;
+    const uint32_t strideIn = ARM_CV_IMAGE_STRIDE(ImageIn, 1);
+    const uint32_t strideOut = ARM_CV_IMAGE_STRIDE(ImageOut, 1);
+    const uint8_t *pIn = ImageIn->pData;
+    uint32_t *pOut = ImageOut->pData;
+    uint64_t *pSqOut = ImageSqOut->pData;
+    const uint32_t strideSqOut = ARM_CV_IMAGE_STRIDE(ImageSqOut, 1);
+    uint32_t sqPrefix[4];
+
+    memset(pOut, 0, outWidth * sizeof(uint32_t));
+    memset(pSqOut, 0, outWidth * sizeof(uint64_t));
+    for(int32_t row = 0; row < height; row++)
+    {
+        const uint32_t *pPrev = pOut + 1;
+        const uint64_t *pSqPrev = pSqOut + 1;
+        pOut += strideOut;
+        pSqOut += strideSqOut;
+        pOut[0] = 0;
+        pSqOut[0] = 0;
+
+        uint32_t rowSum = 0;
+        uint32_t rowSqSum = 0;
+        for(int32_t x = 0; x < width; x += 4)
+        {
+            mve_pred16_t p0 = vctp32q(width - x);
+            uint32x4_t vec = vldrbq_z_u32(&pIn[x], p0);
+            uint32x4_t vecSq = vmulq(vec, vec);
+
+            vec = arm_cv_prefix_sum_u32(vec);
+            vec = vaddq_n_u32(vec, rowSum);
+            rowSum = vgetq_lane(vec, 3);
+            vec = vaddq(vec, vldrwq_z_u32(&pPrev[x], p0));
+            vstrwq_p(&pOut[x + 1], vec, p0);
+
+            vecSq = arm_cv_prefix_sum_u32(vecSq);
+            vecSq = vaddq_n_u32(vecSq, rowSqSum);
+            rowSqSum = vgetq_lane(vecSq, 3);
+            vst1q(sqPrefix, vecSq);
+
+            // No 64 bit lanes in Helium, the vertical accumulation is done in scalar
+            const int32_t nb = (width - x) < 4 ? (width - x) : 4;
+            for(int32_t i = 0; i < nb; i++)
+            {
+                pSqOut[x + 1 + i] = pSqPrev[x + i] + sqPrefix[i];
+            }
+        }
+        pIn += strideIn;
+    }
+}
+#else
+void arm_integral_squared_gray8(const arm_cv_image_gray8_t* ImageIn,
+                                      arm_cv_image_u32_t* ImageOut,
+                                      arm_cv_image_u64_t* ImageSqOut)
+{
+    const int32_t width = ImageIn->width;
+    const int32_t height = ImageIn->height;
+    const int32_t outWidth = width + 1;
+    const uint32_t strideIn = ARM_CV_IMAGE_STRIDE(ImageIn, 1);
+    const uint32_t strideOut = ARM_CV_IMAGE_STRIDE(ImageOut, 1);
+    const uint8_t *pIn = ImageIn->pData;
+    uint32_t *pOut = ImageOut->pData;
+    uint64_t *pSqOut = ImageSqOut->pData;
+    const uint32_t strideSqOut = ARM_CV_IMAGE_STRIDE(ImageSqOut, 1);
+
+    memset(pOut, 0, outWidth * sizeof(uint32_t));
+    memset(pSqOut, 0, outWidth * sizeof(uint64_t));
+    for(int32_t row = 0; row < height; row++)
+    {
+        const uint32_t *pPrev = pOut;
+        const uint64_t *pSqPrev = pSqOut;
+        pOut += strideOut;
+        pSqOut += strideSqOut;
+        pOut[0] = 0;
+        pSqOut[0] = 0;
+
+        uint32_t rowSum = 0;
+        uint32_t rowSqSum = 0;
+        for(int32_t x = 0; x < width; x++)
+        {
+            const uint32_t pixel = pIn[x];
+            rowSum += pixel;
+            rowSqSum += pixel * pixel;
+            pOut[x + 1] = pPrev[x + 1] + rowSum;
+            pSqOut[x + 1] = pSqPrev[x + 1] + rowSqSum;
+        }
+        pIn += strideIn;
+    }
+}
+#endif
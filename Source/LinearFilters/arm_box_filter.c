@@ -0,0 +1,162 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS CV Library
+ * Title:        arm_box_filter.c
+ * Description:  Box filter using running sums for CMSIS-CV
+ *
+ *
+ * Target Processor: Cortex-M
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2024 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_linear_filter_common.h"
+#include "cv/linear_filters.h"
+#include "dsp/none.h"
+
+// The division by the kernel area is replaced by a multiplication by ceil(2^32 / area) keeping the high part.
+// Adding area / 2 before gives the rounded result. It is exact as long as sum < 2^32 / area which is always true
+// for an uint8 image and a radius up to ARM_CV_BOX_FILTER_MAX_RADIUS
+__STATIC_FORCEINLINE uint8_t arm_cv_box_normalize(const uint32_t sum, const uint32_t half, const uint32_t recip)
+{
+    return ((uint8_t)(((uint64_t)(sum + half) * recip) >> 32));
+}
+
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+// Add the row add and remove the row sub from the column sums
+__STATIC_FORCEINLINE void arm_cv_box_update_columns(uint16_t *colSums, const uint8_t *rowAdd, const uint8_t *rowSub,
+                                                    const int width)
+{
+    for (int x = 0; x < width; x += 8)
+    {
+        mve_pred16_t p0 = vctp16q(width - x);
+        uint16x8_t vecSum = vldrhq_z_u16(&colSums[x], p0);
+        vecSum = vaddq(vecSum, vldrbq_z_u16(&rowAdd[x], p0));
+        vecSum = vsubq(vecSum, vldrbq_z_u16(&rowSub[x], p0));
+        vstrhq_p(&colSums[x], vecSum, p0);
+    }
+}
+
+// Add the row to the column sums
+__STATIC_FORCEINLINE void arm_cv_box_add_columns(uint16_t *colSums, const uint8_t *row, const int width)
+{
+    for (int x = 0; x < width; x += 8)
+    {
+        mve_pred16_t p0 = vctp16q(width - x);
+        uint16x8_t vecSum = vldrhq_z_u16(&colSums[x], p0);
+        vecSum = vaddq(vecSum, vldrbq_z_u16(&row[x], p0));
+        vstrhq_p(&colSums[x], vecSum, p0);
+    }
+}
+#else
+// Add the row add and remove the row sub from the column sums
+__STATIC_FORCEINLINE void arm_cv_box_update_columns(uint16_t *colSums, const uint8_t *rowAdd, const uint8_t *rowSub,
+                                                    const int width)
+{
+    for (int x = 0; x < width; x++)
+    {
+        colSums[x] += rowAdd[x] - rowSub[x];
+    }
+}
+
+// Add the row to the column sums
+__STATIC_FORCEINLINE void arm_cv_box_add_columns(uint16_t *colSums, const uint8_t *row, const int width)
+{
+    for (int x = 0; x < width; x++)
+    {
+        colSums[x] += row[x];
+    }
+}
+#endif
+
+/**
+  @ingroup linearFilter
+ */
+
+/**
+ * @brief          Box filter computing the mean of the pixels in a square of size (2 * radius + 1)
+ *
+ * @param[in]      imageIn     The input image
+ * @param[out]     imageOut    The output image
+ * @param[in,out]  scratch     Temporary buffer
+ * @param[in]      radius      Radius of the box, between 1 and ARM_CV_BOX_FILTER_MAX_RADIUS
+ * @param[in]      borderType  Type of border to use, supported are Nearest, Wrap and Reflect
+ *
+ * @par Algorithm
+ *
+ * The q15 line buffer keeps the sums of the columns of the box. When moving to the next line,
+ * only the entering row is added and the leaving row is removed. The horizontal pass is a sliding window
+ * on those sums. So the cost per pixel does not depend on the radius.
+ *
+ * @par Temporary buffer sizing:
+ *
+ * Size of temporary buffer is given by
+ * arm_get_scratch_size_box_filter(int width, uint8_t radius)
+ */
+void arm_box_filter_u8(const arm_cv_image_gray8_t *imageIn, arm_cv_image_gray8_t *imageOut, q15_t *scratch,
+                       const uint8_t radius, const int8_t borderType)
+{
+    const int width = imageOut->width;
+    const int height = imageOut->height;
+    const int strideIn = ARM_CV_IMAGE_STRIDE(imageIn, 1);
+    const int strideOut = ARM_CV_IMAGE_STRIDE(imageOut, 1);
+    const int kernelSize = 2 * radius + 1;
+    const uint32_t area = kernelSize * kernelSize;
+    const uint32_t half = area >> 1;
+    const uint32_t recip = (uint32_t)((((uint64_t)1 << 32) + area - 1) / area);
+    const uint8_t *dataIn = imageIn->pData;
+    uint8_t *dataOut = imageOut->pData;
+    // The sums are positive and below 255 * (2 * ARM_CV_BOX_FILTER_MAX_RADIUS + 1)
+    uint16_t *colSums = (uint16_t *)&scratch[radius];
+    uint16_t *lineBuffer = (uint16_t *)scratch;
+
+    memset(colSums, 0, width * sizeof(uint16_t));
+    for (int k = -radius; k <= radius; k++)
+    {
+        arm_cv_box_add_columns(colSums, &dataIn[arm_cv_border_index(k, height, borderType) * strideIn], width);
+    }
+
+    for (int line = 0; line < height; line++)
+    {
+        if (line > 0)
+        {
+            const uint8_t *rowAdd = &dataIn[arm_cv_border_index(line + radius, height, borderType) * strideIn];
+            const uint8_t *rowSub = &dataIn[arm_cv_border_index(line - radius - 1, height, borderType) * strideIn];
+            arm_cv_box_update_columns(colSums, rowAdd, rowSub, width);
+        }
+
+        for (int x = 1; x <= radius; x++)
+        {
+            lineBuffer[radius - x] = colSums[arm_cv_border_index(-x, width, borderType)];
+            lineBuffer[radius + width - 1 + x] = colSums[arm_cv_border_index(width - 1 + x, width, borderType)];
+        }
+
+        // Horizontal sliding window, lineBuffer[x] is the first column of the box of output x
+        uint8_t *pOut = &dataOut[line * strideOut];
+        uint32_t sum = 0;
+        for (int k = 0; k < kernelSize; k++)
+        {
+            sum += lineBuffer[k];
+        }
+        pOut[0] = arm_cv_box_normalize(sum, half, recip);
+        for (int x = 1; x < width; x++)
+        {
+            sum += lineBuffer[x + kernelSize - 1] - lineBuffer[x - 1];
+            pOut[x] = arm_cv_box_normalize(sum, half, recip);
+        }
+    }
+}
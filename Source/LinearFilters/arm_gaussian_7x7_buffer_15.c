@@ -179,4 +179,36 @@ void arm_gaussian_filter_7x7_buffer_15_fixp(const arm_cv_image_gray8_t *imageIn,
     _ARM_LINEAR_GENERIC(imageIn, imageOut, scratch, borderType)
 }
 
+/**
+  @ingroup linearFilter
+ */
+
+/**
+ * @brief          Gaussian filter applying a 7x7 kernel and using q15 as intermediate values on a strip of the image
+ *
+ * @param[in]      imageIn     The rows of the input image needed by the strip
+ * @param[out]     imageOut    The rows of the strip in the output image
+ * @param[in]      strip       The position of the strip in the image
+ * @param[in,out]  scratch     Temporary buffer
+ * @param[in]      borderType  Type of border to use, supported are Nearest and Reflect
+ *
+ * @par Strip processing
+ *
+ * The output rows are the same as the rows computed by arm_gaussian_filter_7x7_buffer_15_fixp on the full image.
+ * imageIn starts at the row given by arm_cv_get_strip_first_input_row with the radius
+ * ARM_CV_STRIP_RADIUS_7x7 and contains the number of rows given by arm_cv_get_strip_nb_input_rows.
+ * The wrap border needs the rows of the other side of the image so it is not supported.
+ * borderType must not be ARM_CV_BORDER_WRAP, it is asserted in debug builds.
+ *
+ * @par Temporary buffer sizing:
+ *
+ * Size of temporary buffer is given by
+ * arm_get_linear_scratch_size_buffer_15(int width)
+ */
+void arm_gaussian_filter_7x7_buffer_15_fixp_strip(const arm_cv_image_gray8_t *imageIn, arm_cv_image_gray8_t *imageOut,
+                                                  const arm_cv_strip_t *strip, q15_t *scratch, const int8_t borderType)
+{
+    _ARM_LINEAR_GENERIC_STRIP(imageIn, imageOut, strip, scratch, borderType)
+}
+
 #undef KERNEL_7
\ No newline at end of file
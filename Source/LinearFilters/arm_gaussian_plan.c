@@ -0,0 +1,308 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS CV Library
+ * Title:        arm_gaussian_plan.c
+ * Description:  Gaussian filter with a kernel computed from sigma for CMSIS-CV
+ *
+ *
+ * Target Processor: Cortex-M
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2024 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <math.h>
+#include "arm_linear_filter_common.h"
+#include "cv/linear_filters.h"
+#include "dsp/none.h"
+
+// With a q15 buffer the coefficients are in q7 so that the vertical pass of an uint8 (255 * 128) fits in a q15
+#define GAUSSIAN_BUFFER_15_COEF_BITS 7
+// With a q31 buffer the coefficients are in q14 so that the biggest coefficient fits in a q15
+#define GAUSSIAN_BUFFER_31_COEF_BITS 14
+// Maximum relative error on a coefficient for the q7 quantization to be accepted
+#define GAUSSIAN_BUFFER_15_TOLERANCE (1.0f / 32.0f)
+
+// Quantize the normalized kernel with coefBits fractional bits.
+// The center coefficient is adjusted so that the sum of the coefficients is exactly 1 and a flat image stays flat
+static void arm_cv_gaussian_quantize(const float32_t *kernel, const int kernelSize, const int coefBits, q15_t *coefs)
+{
+    int32_t sum = 0;
+    for (int k = 0; k < kernelSize; k++)
+    {
+        coefs[k] = (q15_t)(kernel[k] * (1 << coefBits) + 0.5f);
+        sum += coefs[k];
+    }
+    coefs[kernelSize >> 1] += (1 << coefBits) - sum;
+}
+
+/**
+  @ingroup linearFilter
+ */
+
+/**
+ * @brief          Compute the fixed point kernel of a gaussian filter
+ *
+ * @param[out]     plan        The gaussian plan
+ * @param[in]      sigma       Standard deviation of the gaussian, computed from kernelSize when not positive
+ * @param[in]      kernelSize  Size of the kernel, odd number between 3 and 15, computed from sigma when 0
+ *
+ * @par Maximum sigma
+ *
+ * When kernelSize is 0, the size computed from sigma is clamped to 15 taps.
+ * So sigma must not be bigger than about 2.3 (7 / 3) for the kernel to cover +/- 3 sigma.
+ * With a larger sigma the gaussian is truncated to +/- 7 pixels and the
+ * result is not the one of the expected gaussian.
+ *
+ * @par Choice of the intermediate buffer
+ *
+ * The kernel is first quantized in q7 which allows the use of a q15 line buffer.
+ * When a coefficient can't be represented with a relative error below 1/32 (large sigma or long tail)
+ * the kernel is quantized in q14 and a q31 line buffer is used instead.
+ * The plan only needs to be computed once and can be shared by several images.
+ */
+void arm_gaussian_plan_init(arm_cv_gaussian_plan_t *plan, const float32_t sigma, const uint8_t kernelSize)
+{
+    float32_t kernel[ARM_CV_SEPARABLE_MAX_KERNEL_SIZE];
+    float32_t s = sigma;
+    int size = kernelSize;
+
+    // Same rules as the usual vision libraries when one of the parameters is not given
+    if (size == 0)
+    {
+        size = ((int)(s * 6.0f + 1.5f)) | 1;
+    }
+    size |= 1;
+    if (size < 3)
+    {
+        size = 3;
+    }
+    if (size > ARM_CV_SEPARABLE_MAX_KERNEL_SIZE)
+    {
+        size = ARM_CV_SEPARABLE_MAX_KERNEL_SIZE;
+    }
+    if (s <= 0.0f)
+    {
+        s = 0.3f * ((size - 1) * 0.5f - 1.0f) + 0.8f;
+    }
+
+    const int radius = size >> 1;
+    float32_t sum = 0.0f;
+    for (int k = 0; k < size; k++)
+    {
+        float32_t x = (float32_t)(k - radius);
+        kernel[k] = expf(-(x * x) / (2.0f * s * s));
+        sum += kernel[k];
+    }
+    for (int k = 0; k < size; k++)
+    {
+        kernel[k] = kernel[k] / sum;
+    }
+
+    plan->kernelSize = (uint8_t)size;
+
+    arm_cv_gaussian_quantize(kernel, size, GAUSSIAN_BUFFER_15_COEF_BITS, plan->coefs);
+    plan->bufferType = ARM_CV_GAUSSIAN_PLAN_BUFFER_15;
+    plan->shift = 2 * GAUSSIAN_BUFFER_15_COEF_BITS;
+    for (int k = 0; k < size; k++)
+    {
+        float32_t exact = kernel[k] * (1 << GAUSSIAN_BUFFER_15_COEF_BITS);
+        if (fabsf((float32_t)plan->coefs[k] - exact) > GAUSSIAN_BUFFER_15_TOLERANCE * exact)
+        {
+            plan->bufferType = ARM_CV_GAUSSIAN_PLAN_BUFFER_31;
+            break;
+        }
+    }
+
+    if (plan->bufferType == ARM_CV_GAUSSIAN_PLAN_BUFFER_31)
+    {
+        arm_cv_gaussian_quantize(kernel, size, GAUSSIAN_BUFFER_31_COEF_BITS, plan->coefs);
+        plan->shift = 2 * GAUSSIAN_BUFFER_31_COEF_BITS;
+    }
+}
+
+/**
+  @ingroup linearFilter
+ */
+
+/**
+ * @brief      Return the scratch size for the gaussian filter using a plan
+ *
+ * @param[in]     plan         The gaussian plan
+ * @param[in]     width        The width of the image in pixels
+ * @return		  Scratch size in bytes
+ */
+uint32_t arm_get_scratch_size_gaussian_plan(const arm_cv_gaussian_plan_t *plan, const int width)
+{
+    if (plan->bufferType == ARM_CV_GAUSSIAN_PLAN_BUFFER_15)
+    {
+        return ((width + plan->kernelSize - 1) * sizeof(q15_t));
+    }
+    return (arm_get_scratch_size_separable_filter(width, plan->kernelSize));
+}
+
+// Two pass filter with a q15 line buffer, the line buffer is extended by the kernel radius on each side
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+static void arm_cv_gaussian_plan_buffer_15(const arm_cv_gaussian_plan_t *plan, const arm_cv_image_gray8_t *imageIn,
+                                           arm_cv_image_gray8_t *imageOut, q15_t *scratch, const int8_t borderType)
+{
+    const int width = imageOut->width;
+    const int height = imageOut->height;
+    const int strideIn = ARM_CV_IMAGE_STRIDE(imageIn, 1);
+    const int strideOut = ARM_CV_IMAGE_STRIDE(imageOut, 1);
+    const int kernelSize = plan->kernelSize;
+    const int radius = kernelSize >> 1;
+    const q15_t *coefs = plan->coefs;
+    const uint8_t *dataIn = imageIn->pData;
+    uint8_t *dataOut = imageOut->pData;
+    const uint8_t *rows[ARM_CV_SEPARABLE_MAX_KERNEL_SIZE];
+    int16x8_t coefsVec[(ARM_CV_SEPARABLE_MAX_KERNEL_SIZE + 7) >> 3];
+    const int nbCoefsVec = (kernelSize + 7) >> 3;
+    const mve_pred16_t pLast = vctp16q(kernelSize - ((nbCoefsVec - 1) << 3));
+
+    for (int j = 0; j < nbCoefsVec; j++)
+    {
+        coefsVec[j] = vldrhq_z_s16(&coefs[j << 3], vctp16q(kernelSize - (j << 3)));
+    }
+
+    for (int line = 0; line < height; line++)
+    {
+        for (int k = 0; k < kernelSize; k++)
+        {
+            rows[k] = &dataIn[arm_cv_border_index(line - radius + k, height, borderType) * strideIn];
+        }
+
+        // Vertical pass, 8 pixels at a time, 255 * 128 can't overflow a q15
+        q15_t *pBuf = &scratch[radius];
+        for (int x = 0; x < width; x += 8)
+        {
+            mve_pred16_t p0 = vctp16q(width - x);
+            int16x8_t acc = vdupq_n_s16(0);
+            for (int k = 0; k < kernelSize; k++)
+            {
+                int16x8_t vec = vreinterpretq_s16_u16(vldrbq_z_u16(&rows[k][x], p0));
+                acc = vmlaq_n_s16(acc, vec, coefs[k]);
+            }
+            vstrhq_p(&pBuf[x], acc, p0);
+        }
+
+        for (int x = 1; x <= radius; x++)
+        {
+            scratch[radius - x] = pBuf[arm_cv_border_index(-x, width, borderType)];
+            scratch[radius + width - 1 + x] = pBuf[arm_cv_border_index(width - 1 + x, width, borderType)];
+        }
+
+        // Horizontal pass, the result of the dot product fits in 32 bits
+        uint8_t *pOut = &dataOut[line * strideOut];
+        for (int x = 0; x < width; x++)
+        {
+            int32_t acc = 0;
+            int j = 0;
+            for (; j < nbCoefsVec - 1; j++)
+            {
+                acc = vmladavaq(acc, vld1q(&scratch[x + (j << 3)]), coefsVec[j]);
+            }
+            acc = vmladavaq(acc, vldrhq_z_s16(&scratch[x + (j << 3)], pLast), coefsVec[j]);
+            pOut[x] = (uint8_t)__USAT((acc + (1 << (plan->shift - 1))) >> plan->shift, 8);
+        }
+    }
+}
+#else
+static void arm_cv_gaussian_plan_buffer_15(const arm_cv_gaussian_plan_t *plan, const arm_cv_image_gray8_t *imageIn,
+                                           arm_cv_image_gray8_t *imageOut, q15_t *scratch, const int8_t borderType)
+{
+    const int width = imageOut->width;
+    const int height = imageOut->height;
+    const int strideIn = ARM_CV_IMAGE_STRIDE(imageIn, 1);
+    const int strideOut = ARM_CV_IMAGE_STRIDE(imageOut, 1);
+    const int kernelSize = plan->kernelSize;
+    const int radius = kernelSize >> 1;
+    const q15_t *coefs = plan->coefs;
+    const uint8_t *dataIn = imageIn->pData;
+    uint8_t *dataOut = imageOut->pData;
+    const uint8_t *rows[ARM_CV_SEPARABLE_MAX_KERNEL_SIZE];
+
+    for (int line = 0; line < height; line++)
+    {
+        for (int k = 0; k < kernelSize; k++)
+        {
+            rows[k] = &dataIn[arm_cv_border_index(line - radius + k, height, borderType) * strideIn];
+        }
+
+        // Vertical pass, 255 * 128 can't overflow a q15
+        q15_t *pBuf = &scratch[radius];
+        for (int x = 0; x < width; x++)
+        {
+            int32_t acc = 0;
+            for (int k = 0; k < kernelSize; k++)
+            {
+                acc += coefs[k] * rows[k][x];
+            }
+            pBuf[x] = (q15_t)acc;
+        }
+
+        for (int x = 1; x <= radius; x++)
+        {
+            scratch[radius - x] = pBuf[arm_cv_border_index(-x, width, borderType)];
+            scratch[radius + width - 1 + x] = pBuf[arm_cv_border_index(width - 1 + x, width, borderType)];
+        }
+
+        // Horizontal pass
+        uint8_t *pOut = &dataOut[line * strideOut];
+        for (int x = 0; x < width; x++)
+        {
+            int32_t acc = 0;
+            for (int k = 0; k < kernelSize; k++)
+            {
+                acc += coefs[k] * scratch[x + k];
+            }
+            pOut[x] = (uint8_t)__USAT((acc + (1 << (plan->shift - 1))) >> plan->shift, 8);
+        }
+    }
+}
+#endif
+
+/**
+  @ingroup linearFilter
+ */
+
+/**
+ * @brief          Gaussian filter applying the kernel computed by arm_gaussian_plan_init
+ *
+ * @param[in]      plan        The gaussian plan
+ * @param[in]      imageIn     The input image
+ * @param[out]     imageOut    The output image
+ * @param[in,out]  scratch     Temporary buffer
+ * @param[in]      borderType  Type of border to use, supported are Nearest, Wrap and Reflect
+ *
+ * @par Temporary buffer sizing:
+ *
+ * Size of temporary buffer depends on the intermediate buffer chosen by the plan and is given by
+ * arm_get_scratch_size_gaussian_plan(const arm_cv_gaussian_plan_t *plan, int width)
+ */
+void arm_gaussian_filter_plan(const arm_cv_gaussian_plan_t *plan, const arm_cv_image_gray8_t *imageIn,
+                              arm_cv_image_gray8_t *imageOut, q31_t *scratch, const int8_t borderType)
+{
+    if (plan->bufferType == ARM_CV_GAUSSIAN_PLAN_BUFFER_15)
+    {
+        arm_cv_gaussian_plan_buffer_15(plan, imageIn, imageOut, (q15_t *)scratch, borderType);
+    }
+    else
+    {
+        arm_separable_filter_u8(imageIn, imageOut, scratch, plan->coefs, plan->coefs, plan->kernelSize, plan->shift,
+                                borderType);
+    }
+}
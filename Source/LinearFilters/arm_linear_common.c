@@ -14,7 +14,7 @@
  * @param[in]     width        The width of the image in pixels
  * @return		  Scratch size in bytes
  */
-uint16_t arm_get_linear_scratch_size_buffer_15(const int width)
+uint32_t arm_get_linear_scratch_size_buffer_15(const int width)
 {
     return (width * sizeof(q15_t));
 }
@@ -29,7 +29,7 @@ uint16_t arm_get_linear_scratch_size_buffer_15(const int width)
  * @param[in]     width        The width of the image in pixels
  * @return		  Scratch size in bytes
  */
-uint16_t arm_get_linear_scratch_size_buffer_31(const int width)
+uint32_t arm_get_linear_scratch_size_buffer_31(const int width)
 {
     return (width * sizeof(q31_t));
 }
@@ -44,7 +44,43 @@ uint16_t arm_get_linear_scratch_size_buffer_31(const int width)
  * @param[in]     width        The width of the image in pixels
  * @return		  Scratch size in bytes
  */
-uint16_t arm_get_scratch_size_sobel(const int width)
+uint32_t arm_get_scratch_size_sobel(const int width)
 {
     return (width * sizeof(q15_t));
-}
\ No newline at end of file
+}
+
+/**
+  @ingroup linearFilter
+ */
+
+/**
+ * @brief      Return the scratch size for the separable filter function using a q31 buffer
+ *
+ * @param[in]     width        The width of the image in pixels
+ * @param[in]     kernelSize   The size of the kernel
+ * @return		  Scratch size in bytes
+ *
+ * The line buffer is extended by the kernel radius on each side to store the border pixels
+ */
+uint32_t arm_get_scratch_size_separable_filter(const int width, const uint8_t kernelSize)
+{
+    return ((width + kernelSize - 1) * sizeof(q31_t));
+}
+
+/**
+  @ingroup linearFilter
+ */
+
+/**
+ * @brief      Return the scratch size for the box filter function using a q15 buffer
+ *
+ * @param[in]     width        The width of the image in pixels
+ * @param[in]     radius       The radius of the box
+ * @return		  Scratch size in bytes
+ *
+ * The line buffer contains the column sums and is extended by the radius on each side
+ */
+uint32_t arm_get_scratch_size_box_filter(const int width, const uint8_t radius)
+{
+    return ((width + 2 * radius) * sizeof(q15_t));
+}
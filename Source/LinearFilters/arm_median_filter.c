@@ -0,0 +1,212 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS CV Library
+ * Title:        arm_median_filter.c
+ * Description:  3x3 and 5x5 median filters for CMSIS-CV
+ *
+ *
+ * Target Processor: Cortex-M
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2024 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_linear_filter_common.h"
+#include "cv/linear_filters.h"
+#include "dsp/none.h"
+
+// Compare and exchange, a receive the minimum and b the maximum
+#define MEDIAN_SORT_SCALAR(a, b)                                                                                       \
+    {                                                                                                                  \
+        uint8_t tmp = (a) < (b) ? (a) : (b);                                                                           \
+        (b) = (a) < (b) ? (b) : (a);                                                                                   \
+        (a) = tmp;                                                                                                     \
+    }
+
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+// Compare and exchange on 16 pixels at a time
+#define MEDIAN_SORT_VECTOR(a, b)                                                                                       \
+    {                                                                                                                  \
+        uint8x16_t tmp = vminq((a), (b));                                                                              \
+        (b) = vmaxq((a), (b));                                                                                         \
+        (a) = tmp;                                                                                                     \
+    }
+#endif
+
+// Selection network giving the median of 9 values in p[4]
+// Only the comparisons required for the median are done, the list is not fully sorted
+#define MEDIAN_NETWORK_9(SORT, p)                                                                                      \
+    SORT(p[1], p[2]) SORT(p[4], p[5]) SORT(p[7], p[8]) SORT(p[0], p[1]) SORT(p[3], p[4]) SORT(p[6], p[7])              \
+    SORT(p[1], p[2]) SORT(p[4], p[5]) SORT(p[7], p[8]) SORT(p[0], p[3]) SORT(p[5], p[8]) SORT(p[4], p[7])              \
+    SORT(p[3], p[6]) SORT(p[1], p[4]) SORT(p[2], p[5]) SORT(p[4], p[7]) SORT(p[4], p[2]) SORT(p[6], p[4])              \
+    SORT(p[4], p[2])
+
+// Selection network giving the median of 25 values in p[12]
+#define MEDIAN_NETWORK_25(SORT, p)                                                                                     \
+    SORT(p[0], p[1]) SORT(p[3], p[4]) SORT(p[2], p[4]) SORT(p[2], p[3]) SORT(p[6], p[7]) SORT(p[5], p[7])              \
+    SORT(p[5], p[6]) SORT(p[9], p[10]) SORT(p[8], p[10]) SORT(p[8], p[9]) SORT(p[12], p[13]) SORT(p[11], p[13])        \
+    SORT(p[11], p[12]) SORT(p[15], p[16]) SORT(p[14], p[16]) SORT(p[14], p[15]) SORT(p[18], p[19])                     \
+    SORT(p[17], p[19]) SORT(p[17], p[18]) SORT(p[21], p[22]) SORT(p[20], p[22]) SORT(p[20], p[21])                     \
+    SORT(p[23], p[24]) SORT(p[2], p[5]) SORT(p[3], p[6]) SORT(p[0], p[6]) SORT(p[0], p[3]) SORT(p[4], p[7])            \
+    SORT(p[1], p[7]) SORT(p[1], p[4]) SORT(p[11], p[14]) SORT(p[8], p[14]) SORT(p[8], p[11]) SORT(p[12], p[15])        \
+    SORT(p[9], p[15]) SORT(p[9], p[12]) SORT(p[13], p[16]) SORT(p[10], p[16]) SORT(p[10], p[13])                       \
+    SORT(p[20], p[23]) SORT(p[17], p[23]) SORT(p[17], p[20]) SORT(p[21], p[24]) SORT(p[18], p[24])                     \
+    SORT(p[18], p[21]) SORT(p[19], p[22]) SORT(p[8], p[17]) SORT(p[9], p[18]) SORT(p[0], p[18]) SORT(p[0], p[9])       \
+    SORT(p[10], p[19]) SORT(p[1], p[19]) SORT(p[1], p[10]) SORT(p[11], p[20]) SORT(p[2], p[20]) SORT(p[2], p[11])      \
+    SORT(p[12], p[21]) SORT(p[3], p[21]) SORT(p[3], p[12]) SORT(p[13], p[22]) SORT(p[4], p[22]) SORT(p[4], p[13])      \
+    SORT(p[14], p[23]) SORT(p[5], p[23]) SORT(p[5], p[14]) SORT(p[15], p[24]) SORT(p[6], p[24]) SORT(p[6], p[15])      \
+    SORT(p[7], p[16]) SORT(p[7], p[19]) SORT(p[13], p[21]) SORT(p[15], p[23]) SORT(p[7], p[13]) SORT(p[7], p[15])      \
+    SORT(p[1], p[9]) SORT(p[3], p[11]) SORT(p[5], p[17]) SORT(p[11], p[17]) SORT(p[9], p[17]) SORT(p[4], p[10])        \
+    SORT(p[6], p[12]) SORT(p[7], p[14]) SORT(p[4], p[6]) SORT(p[4], p[7]) SORT(p[12], p[14]) SORT(p[10], p[14])        \
+    SORT(p[6], p[7]) SORT(p[10], p[12]) SORT(p[6], p[10]) SORT(p[6], p[17]) SORT(p[12], p[17]) SORT(p[7], p[17])       \
+    SORT(p[7], p[10]) SORT(p[12], p[18]) SORT(p[7], p[12]) SORT(p[10], p[18]) SORT(p[12], p[20]) SORT(p[10], p[20])    \
+    SORT(p[10], p[12])
+
+// Median of the pixel x of the line, the neighbours are read respecting the border type
+// rows List of the pointers to the input lines involved in the compute
+#define MEDIAN_PIXEL_SCALAR(KERNEL_SIZE, NETWORK, rows, x, width, borderType, dataOut)                                 \
+    {                                                                                                                  \
+        uint8_t p[KERNEL_SIZE * KERNEL_SIZE];                                                                          \
+        for (int j = 0; j < KERNEL_SIZE; j++)                                                                          \
+        {                                                                                                              \
+            int col = arm_cv_border_index(x - (KERNEL_SIZE >> 1) + j, width, borderType);                              \
+            for (int k = 0; k < KERNEL_SIZE; k++)                                                                      \
+            {                                                                                                          \
+                p[k * KERNEL_SIZE + j] = rows[k][col];                                                                 \
+            }                                                                                                          \
+        }                                                                                                              \
+        NETWORK(MEDIAN_SORT_SCALAR, p)                                                                                 \
+        dataOut[x] = p[(KERNEL_SIZE * KERNEL_SIZE) >> 1];                                                              \
+    }
+
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+// Median of the 16 pixels starting at x, all the neighbours must be inside the image
+#define MEDIAN_PIXELS_VECTOR(KERNEL_SIZE, NETWORK, rows, x, dataOut)                                                   \
+    {                                                                                                                  \
+        uint8x16_t p[KERNEL_SIZE * KERNEL_SIZE];                                                                       \
+        for (int k = 0; k < KERNEL_SIZE; k++)                                                                          \
+        {                                                                                                              \
+            for (int j = 0; j < KERNEL_SIZE; j++)                                                                      \
+            {                                                                                                          \
+                p[k * KERNEL_SIZE + j] = vld1q(&rows[k][x - (KERNEL_SIZE >> 1) + j]);                                  \
+            }                                                                                                          \
+        }                                                                                                              \
+        NETWORK(MEDIAN_SORT_VECTOR, p)                                                                                 \
+        vst1q(&dataOut[x], p[(KERNEL_SIZE * KERNEL_SIZE) >> 1]);                                                       \
+    }
+
+// Process a line, the middle is computed 16 pixels at a time. The last block overlaps the previous one
+// instead of using a scalar tail, the result being the same for the pixels computed twice
+#define MEDIAN_LINE(KERNEL_SIZE, NETWORK, rows, width, borderType, dataOut)                                            \
+    {                                                                                                                  \
+        const int radius = KERNEL_SIZE >> 1;                                                                           \
+        int x = 0;                                                                                                     \
+        if (width - 2 * radius >= 16)                                                                                  \
+        {                                                                                                              \
+            for (; x < radius; x++)                                                                                    \
+            {                                                                                                          \
+                MEDIAN_PIXEL_SCALAR(KERNEL_SIZE, NETWORK, rows, x, width, borderType, dataOut)                         \
+            }                                                                                                          \
+            for (; x <= width - radius - 16; x += 16)                                                                  \
+            {                                                                                                          \
+                MEDIAN_PIXELS_VECTOR(KERNEL_SIZE, NETWORK, rows, x, dataOut)                                           \
+            }                                                                                                          \
+            if (x < width - radius)                                                                                    \
+            {                                                                                                          \
+                x = width - radius - 16;                                                                               \
+                MEDIAN_PIXELS_VECTOR(KERNEL_SIZE, NETWORK, rows, x, dataOut)                                           \
+                x = width - radius;                                                                                    \
+            }                                                                                                          \
+        }                                                                                                              \
+        for (; x < width; x++)                                                                                         \
+        {                                                                                                              \
+            MEDIAN_PIXEL_SCALAR(KERNEL_SIZE, NETWORK, rows, x, width, borderType, dataOut)                             \
+        }                                                                                                              \
+    }
+#else
+// Process a line
+#define MEDIAN_LINE(KERNEL_SIZE, NETWORK, rows, width, borderType, dataOut)                                            \
+    {                                                                                                                  \
+        for (int x = 0; x < width; x++)                                                                                \
+        {                                                                                                              \
+            MEDIAN_PIXEL_SCALAR(KERNEL_SIZE, NETWORK, rows, x, width, borderType, dataOut)                             \
+        }                                                                                                              \
+    }
+#endif
+
+// Process the image line by line, the lines involved are selected respecting the border type
+#define MEDIAN_GENERIC(KERNEL_SIZE, NETWORK, imageIn, imageOut, borderType)                                            \
+    const int width = imageOut->width;                                                                                 \
+    const int height = imageOut->height;                                                                               \
+    const int strideIn = ARM_CV_IMAGE_STRIDE(imageIn, 1);                                                              \
+    const int strideOut = ARM_CV_IMAGE_STRIDE(imageOut, 1);                                                            \
+    const uint8_t *dataIn = imageIn->pData;                                                                            \
+    const uint8_t *rows[KERNEL_SIZE];                                                                                  \
+    for (int line = 0; line < height; line++)                                                                          \
+    {                                                                                                                  \
+        uint8_t *dataOut = &imageOut->pData[line * strideOut];                                                         \
+        for (int k = 0; k < KERNEL_SIZE; k++)                                                                          \
+        {                                                                                                              \
+            rows[k] = &dataIn[arm_cv_border_index(line - (KERNEL_SIZE >> 1) + k, height, borderType) * strideIn];      \
+        }                                                                                                              \
+        MEDIAN_LINE(KERNEL_SIZE, NETWORK, rows, width, borderType, dataOut)                                            \
+    }
+
+/**
+  @ingroup linearFilter
+ */
+
+/**
+ * @brief          Median filter on a 3x3 neighbourhood
+ *
+ * @param[in]      imageIn     The input image
+ * @param[out]     imageOut    The output image
+ * @param[in]      borderType  Type of border to use, supported are Nearest, Wrap and Reflect
+ *
+ * @par Algorithm
+ *
+ * The median is selected with a min/max network of 19 compare and exchange.
+ * With Helium, 16 pixels are processed at a time.
+ * No temporary buffer is needed.
+ */
+void arm_median_filter_3x3(const arm_cv_image_gray8_t *imageIn, arm_cv_image_gray8_t *imageOut,
+                           const int8_t borderType)
+{
+    MEDIAN_GENERIC(3, MEDIAN_NETWORK_9, imageIn, imageOut, borderType)
+}
+
+/**
+  @ingroup linearFilter
+ */
+
+/**
+ * @brief          Median filter on a 5x5 neighbourhood
+ *
+ * @param[in]      imageIn     The input image
+ * @param[out]     imageOut    The output image
+ * @param[in]      borderType  Type of border to use, supported are Nearest, Wrap and Reflect
+ *
+ * @par Algorithm
+ *
+ * The median is selected with a min/max network of 99 compare and exchange.
+ * With Helium, 16 pixels are processed at a time.
+ * No temporary buffer is needed.
+ */
+void arm_median_filter_5x5(const arm_cv_image_gray8_t *imageIn, arm_cv_image_gray8_t *imageOut,
+                           const int8_t borderType)
+{
+    MEDIAN_GENERIC(5, MEDIAN_NETWORK_25, imageIn, imageOut, borderType)
+}
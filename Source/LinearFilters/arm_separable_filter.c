@@ -0,0 +1,232 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS CV Library
+ * Title:        arm_separable_filter.c
+ * Description:  Separable filter with a runtime defined kernel for CMSIS-CV
+ *
+ *
+ * Target Processor: Cortex-M
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2024 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "arm_linear_filter_common.h"
+#include "cv/linear_filters.h"
+#include "dsp/none.h"
+#include <assert.h>
+
+// The kernel must have a center and fit in the rows and coefficients arrays
+__STATIC_FORCEINLINE int arm_cv_separable_kernel_size_valid(const uint8_t kernelSize)
+{
+    return ((kernelSize & 1) && (kernelSize >= 3) && (kernelSize <= ARM_CV_SEPARABLE_MAX_KERNEL_SIZE));
+}
+
+// Round, shift and saturate the 64 bits accumulator of the horizontal pass to an uint8
+__STATIC_FORCEINLINE uint8_t arm_cv_separable_to_u8(int64_t acc, const uint8_t shift)
+{
+    if (shift > 0)
+    {
+        acc = (acc + ((int64_t)1 << (shift - 1))) >> shift;
+    }
+    if (acc < 0)
+    {
+        return (0);
+    }
+    if (acc > 255)
+    {
+        return (255);
+    }
+    return ((uint8_t)acc);
+}
+
+// Fill the left and right part of the line buffer with the values required by the border type.
+// The vertical pass has already written the line at &scratch[radius]
+__STATIC_FORCEINLINE void arm_cv_separable_fill_border(q31_t *scratch, const int width, const int radius,
+                                                       const int8_t borderType)
+{
+    for (int x = 1; x <= radius; x++)
+    {
+        scratch[radius - x] = scratch[radius + arm_cv_border_index(-x, width, borderType)];
+        scratch[radius + width - 1 + x] = scratch[radius + arm_cv_border_index(width - 1 + x, width, borderType)];
+    }
+}
+
+/**
+  @ingroup linearFilter
+ */
+
+/**
+ * @brief          Separable filter applying a runtime defined kernel and using q31 as intermediate values
+ *
+ * @param[in]      imageIn     The input image
+ * @param[out]     imageOut    The output image
+ * @param[in,out]  scratch     Temporary buffer
+ * @param[in]      coefsRow    Coefficients applied in the horizontal direction
+ * @param[in]      coefsCol    Coefficients applied in the vertical direction
+ * @param[in]      kernelSize  Size of the kernel, odd number between 3 and 15.
+ *                             Other sizes are a precondition violation: they are
+ *                             asserted in debug builds and the output is not written otherwise
+ * @param[in]      shift       Right shift applied to the result to get back an uint8
+ * @param[in]      borderType  Type of border to use, supported are Nearest, Wrap and Reflect
+ *
+ * @par Kernel format
+ *
+ * The kernel applied is the outer product of coefsCol and coefsRow.
+ * Coefficients are integers stored as q15_t, so q7 kernels can be used directly.
+ * The vertical pass is accumulated in q31 and the horizontal pass in 64 bits.
+ * The result is rounded, shifted right by shift and saturated to [0, 255].
+ *
+ * @par Temporary buffer sizing:
+ *
+ * Size of temporary buffer is given by
+ * arm_get_scratch_size_separable_filter(int width, uint8_t kernelSize)
+ */
+#if defined(ARM_MATH_MVEI) && !defined(ARM_MATH_AUTOVECTORIZE)
+void arm_separable_filter_u8(const arm_cv_image_gray8_t *imageIn, arm_cv_image_gray8_t *imageOut,
+                             q31_t *scratch, const q15_t *coefsRow, const q15_t *coefsCol,
+                             const uint8_t kernelSize, const uint8_t shift, const int8_t borderType)
+{
+    assert(arm_cv_separable_kernel_size_valid(kernelSize));
+    if (!arm_cv_separable_kernel_size_valid(kernelSize))
+    {
+        return;
+    }
+    const int width = imageOut->width;
+    const int height = imageOut->height;
+    const int strideIn = ARM_CV_IMAGE_STRIDE(imageIn, 1);
+    const int strideOut = ARM_CV_IMAGE_STRIDE(imageOut, 1);
+    const int radius = kernelSize >> 1;
+    const uint8_t *dataIn = imageIn->pData;
+    uint8_t *dataOut = imageOut->pData;
+    const uint8_t *rows[ARM_CV_SEPARABLE_MAX_KERNEL_SIZE];
+    int32x4_t coefsRowVec[(ARM_CV_SEPARABLE_MAX_KERNEL_SIZE + 3) >> 2];
+    const int nbCoefsVec = (kernelSize + 3) >> 2;
+    const mve_pred16_t pLast = vctp32q(kernelSize - ((nbCoefsVec - 1) << 2));
+
+    // The horizontal coefficients are widened once, the last vector is zero padded
+    for (int j = 0; j < nbCoefsVec; j++)
+    {
+        coefsRowVec[j] = vldrhq_z_s32(&coefsRow[j << 2], vctp32q(kernelSize - (j << 2)));
+    }
+
+    for (int line = 0; line < height; line++)
+    {
+        for (int k = 0; k < kernelSize; k++)
+        {
+            rows[k] = &dataIn[arm_cv_border_index(line - radius + k, height, borderType) * strideIn];
+        }
+
+        // Vertical pass on the whole line, 8 pixels at a time
+        q31_t *pBuf = &scratch[radius];
+        int x = 0;
+        for (; x < width - 7; x += 8)
+        {
+            int32x4_t acc0 = vdupq_n_s32(0);
+            int32x4_t acc1 = vdupq_n_s32(0);
+            for (int k = 0; k < kernelSize; k++)
+            {
+                int32x4_t vec0 = vreinterpretq_s32_u32(vldrbq_u32(&rows[k][x]));
+                int32x4_t vec1 = vreinterpretq_s32_u32(vldrbq_u32(&rows[k][x + 4]));
+                acc0 = vmlaq_n_s32(acc0, vec0, coefsCol[k]);
+                acc1 = vmlaq_n_s32(acc1, vec1, coefsCol[k]);
+            }
+            vst1q(&pBuf[x], acc0);
+            vst1q(&pBuf[x + 4], acc1);
+        }
+        for (; x < width; x += 4)
+        {
+            mve_pred16_t p0 = vctp32q(width - x);
+            int32x4_t acc0 = vdupq_n_s32(0);
+            for (int k = 0; k < kernelSize; k++)
+            {
+                int32x4_t vec0 = vreinterpretq_s32_u32(vldrbq_z_u32(&rows[k][x], p0));
+                acc0 = vmlaq_n_s32(acc0, vec0, coefsCol[k]);
+            }
+            vstrwq_p(&pBuf[x], acc0, p0);
+        }
+
+        arm_cv_separable_fill_border(scratch, width, radius, borderType);
+
+        // Horizontal pass, scratch[x] is the first pixel involved in the compute of output x
+        uint8_t *pOut = &dataOut[line * strideOut];
+        for (x = 0; x < width; x++)
+        {
+            int64_t acc = 0;
+            int j = 0;
+            for (; j < nbCoefsVec - 1; j++)
+            {
+                acc = vmlaldavaq(acc, vld1q(&scratch[x + (j << 2)]), coefsRowVec[j]);
+            }
+            acc = vmlaldavaq(acc, vldrwq_z_s32(&scratch[x + (j << 2)], pLast), coefsRowVec[j]);
+            pOut[x] = arm_cv_separable_to_u8(acc, shift);
+        }
+    }
+}
+#else
+void arm_separable_filter_u8(const arm_cv_image_gray8_t *imageIn, arm_cv_image_gray8_t *imageOut,
+                             q31_t *scratch, const q15_t *coefsRow, const q15_t *coefsCol,
+                             const uint8_t kernelSize, const uint8_t shift, const int8_t borderType)
+{
+    assert(arm_cv_separable_kernel_size_valid(kernelSize));
+    if (!arm_cv_separable_kernel_size_valid(kernelSize))
+    {
+        return;
+    }
+    const int width = imageOut->width;
+    const int height = imageOut->height;
+    const int strideIn = ARM_CV_IMAGE_STRIDE(imageIn, 1);
+    const int strideOut = ARM_CV_IMAGE_STRIDE(imageOut, 1);
+    const int radius = kernelSize >> 1;
+    const uint8_t *dataIn = imageIn->pData;
+    uint8_t *dataOut = imageOut->pData;
+    const uint8_t *rows[ARM_CV_SEPARABLE_MAX_KERNEL_SIZE];
+
+    for (int line = 0; line < height; line++)
+    {
+        for (int k = 0; k < kernelSize; k++)
+        {
+            rows[k] = &dataIn[arm_cv_border_index(line - radius + k, height, borderType) * strideIn];
+        }
+
+        // Vertical pass on the whole line
+        q31_t *pBuf = &scratch[radius];
+        for (int x = 0; x < width; x++)
+        {
+            q31_t acc = 0;
+            for (int k = 0; k < kernelSize; k++)
+            {
+                acc += (q31_t)coefsCol[k] * rows[k][x];
+            }
+            pBuf[x] = acc;
+        }
+
+        arm_cv_separable_fill_border(scratch, width, radius, borderType);
+
+        // Horizontal pass, scratch[x] is the first pixel involved in the compute of output x
+        uint8_t *pOut = &dataOut[line * strideOut];
+        for (int x = 0; x < width; x++)
+        {
+            int64_t acc = 0;
+            for (int k = 0; k < kernelSize; k++)
+            {
+                acc += (int64_t)coefsRow[k] * scratch[x + k];
+            }
+            pOut[x] = arm_cv_separable_to_u8(acc, shift);
+        }
+    }
+}
+#endif
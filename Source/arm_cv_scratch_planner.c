@@ -0,0 +1,96 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS CV Library
+ * Title:        arm_cv_scratch_planner.c
+ * Description:  Scratch size planning for a pipeline of CMSIS-CV kernels
+ *
+ *
+ * Target Processor: Cortex-M
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2024 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "cv/scratch_planner.h"
+#include "cv/feature_detection.h"
+#include "cv/linear_filters.h"
+#include "cv/image_transforms.h"
+
+/**
+  @ingroup scratchPlanner
+ */
+
+/**
+ * @brief      Return the scratch size of one kernel
+ *
+ * @param[in]     kernel       The kernel and the size of its image
+ * @return		  Scratch size in bytes, 0 when the kernel is unknown
+ */
+uint32_t arm_cv_get_scratch_size_kernel(const arm_cv_scratch_kernel_t *kernel)
+{
+    switch (kernel->kernel)
+    {
+    case ARM_CV_SCRATCH_LINEAR_BUFFER_15:
+        return (arm_get_linear_scratch_size_buffer_15(kernel->width));
+    case ARM_CV_SCRATCH_LINEAR_BUFFER_31:
+        return (arm_get_linear_scratch_size_buffer_31(kernel->width));
+    case ARM_CV_SCRATCH_SOBEL:
+        return (arm_get_scratch_size_sobel(kernel->width));
+    case ARM_CV_SCRATCH_SEPARABLE_FILTER:
+        return (arm_get_scratch_size_separable_filter(kernel->width, kernel->param));
+    case ARM_CV_SCRATCH_GAUSSIAN_PLAN:
+        return (arm_get_scratch_size_gaussian_plan(kernel->plan, kernel->width));
+    case ARM_CV_SCRATCH_BOX_FILTER:
+        return (arm_get_scratch_size_box_filter(kernel->width, kernel->param));
+    case ARM_CV_SCRATCH_CANNY_SOBEL:
+        return (arm_cv_get_scratch_size_canny_sobel(kernel->width));
+    case ARM_CV_SCRATCH_CANNY_GAUSSIAN_SOBEL:
+        return (arm_cv_get_scratch_size_canny_gaussian_sobel(kernel->width));
+    case ARM_CV_SCRATCH_RESIZE_FIXP:
+        return (arm_get_scratch_size_resize_fixp(kernel->width, kernel->param));
+    default:
+        return (0);
+    }
+}
+
+/**
+  @ingroup scratchPlanner
+ */
+
+/**
+ * @brief      Return the scratch size to share between the kernels of a pipeline
+ *
+ * @param[in]     kernels      The kernels of the pipeline
+ * @param[in]     nbKernels    Number of kernels
+ * @return		  Scratch size in bytes
+ *
+ * @par The kernels are executed one after the other so a single buffer with
+ *      the maximum of the scratch sizes can be used by all of them.
+ *      The size is rounded up to a multiple of 16 bytes so that the buffer can be
+ *      placed right after another 16 bytes aligned buffer in the same memory pool
+ */
+uint32_t arm_cv_get_scratch_size_pipeline(const arm_cv_scratch_kernel_t *kernels, const uint32_t nbKernels)
+{
+    uint32_t maxSize = 0;
+    for (uint32_t i = 0; i < nbKernels; i++)
+    {
+        uint32_t size = arm_cv_get_scratch_size_kernel(&kernels[i]);
+        if (size > maxSize)
+        {
+            maxSize = size;
+        }
+    }
+    return ((maxSize + 15) & ~15U);
+}
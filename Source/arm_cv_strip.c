@@ -0,0 +1,68 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS CV Library
+ * Title:        arm_cv_strip.c
+ * Description:  Processing of a frame by horizontal strips
+ *
+ *
+ * Target Processor: Cortex-M
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2024 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include "cv/strip.h"
+
+/**
+  @ingroup stripProcessing
+ */
+
+/**
+ * @brief      Return the first row of the input frame needed by a strip
+ *
+ * @param[in]     strip        The position of the strip in the frame
+ * @param[in]     radius       Number of rows needed around a row, one of ARM_CV_STRIP_RADIUS_*
+ * @return		  Index in the frame of the first row of the input image
+ */
+uint16_t arm_cv_get_strip_first_input_row(const arm_cv_strip_t *strip, const uint16_t radius)
+{
+    if (strip->firstRow < radius)
+    {
+        return (0);
+    }
+    return (strip->firstRow - radius);
+}
+
+/**
+  @ingroup stripProcessing
+ */
+
+/**
+ * @brief      Return the number of rows of the input image of a strip
+ *
+ * @param[in]     strip        The position of the strip in the frame
+ * @param[in]     nbRows       Number of rows of the output strip
+ * @param[in]     radius       Number of rows needed around a row, one of ARM_CV_STRIP_RADIUS_*
+ * @return		  Number of rows of the input image
+ */
+uint16_t arm_cv_get_strip_nb_input_rows(const arm_cv_strip_t *strip, const uint16_t nbRows, const uint16_t radius)
+{
+    uint32_t lastRow = strip->firstRow + nbRows + radius;
+    if (lastRow > strip->frameHeight)
+    {
+        lastRow = strip->frameHeight;
+    }
+    return ((uint16_t)(lastRow - arm_cv_get_strip_first_input_row(strip, radius)));
+}
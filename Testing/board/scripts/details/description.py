@@ -2,6 +2,19 @@ from . import *
 
 # Functions to make it easier to write tests
 
+# The strip tests return the image processed in one call, compared to the reference,
+# and the image processed by strips, which must be identical
+def strip_test(test):
+    test["reference"] = StripReference(test["reference"])
+    test["check"] = StripCheck(test["check"])
+    return test
+
+# The view tests only process the top left width x height part of the input
+def view_test(test,width,height):
+    test["desc"] = test["desc"] + f" view {width}x{height}"
+    test["reference"] = ViewReference(test["reference"],width,height)
+    return test
+
 def yuv420_gray8_test(imgid,imgdim,funcid=0):
     return {"desc":f"YUV420 to GRAY8 {imgdim[0]}x{imgdim[1]}",
             "funcid": funcid,
@@ -10,13 +23,14 @@ def yuv420_gray8_test(imgid,imgdim,funcid=0):
             "check" : SimilarTensorFixp()
            }
 
-def bgr_8U3C_gray8_test(imgid,imgdim,funcid=0):
-    return {"desc":f"BGR 8U3C to GRAY8 {imgdim[0]}x{imgdim[1]}",
+def bgr_8U3C_gray8_test(imgid,imgdim,funcid=0,strip=False):
+    test = {"desc":f"BGR 8U3C to GRAY8 {'strips ' if strip else ''}{imgdim[0]}x{imgdim[1]}",
             "funcid": funcid,
             "useimg": [imgid],
             "reference": BGR8U3CToGray8(),
             "check" : SimilarTensorFixp(1)
            }
+    return strip_test(test) if strip else test
 
 def gray8_to_rgb_test(imgid,imgdim,funcid=0):
     return {"desc":f"GRAY8 to RGB24 {imgdim[0]}x{imgdim[1]}",
@@ -26,21 +40,23 @@ def gray8_to_rgb_test(imgid,imgdim,funcid=0):
             "check" : SimilarTensorFixp()
            }
 
-def bgr_8U3C_to_rgb_test(imgid,imgdim,funcid=0):
-    return {"desc":f"BGR 8U3C to RGB24 {imgdim[0]}x{imgdim[1]}",
+def bgr_8U3C_to_rgb_test(imgid,imgdim,funcid=0,strip=False):
+    test = {"desc":f"BGR 8U3C to RGB24 {'strips ' if strip else ''}{imgdim[0]}x{imgdim[1]}",
             "funcid": funcid,
             "useimg": [imgid],
             "reference": BGR8U3CToRGB(),
             "check" : SimilarTensorFixp()
            }
+    return strip_test(test) if strip else test
 
-def yuv420_to_rgb_test(imgid,imgdim,funcid=0):
-    return {"desc":f"YUV420 to RGB {imgdim[0]}x{imgdim[1]}",
+def yuv420_to_rgb_test(imgid,imgdim,funcid=0,strip=False):
+    test = {"desc":f"YUV420 to RGB {'strips ' if strip else ''}{imgdim[0]}x{imgdim[1]}",
             "funcid": funcid,
             "useimg": [imgid],
             "reference": YUV420ToRGB(),
             "check" : SimilarTensorFixp(1)
            }
+    return strip_test(test) if strip else test
 
 def rgb_to_gray_test(imgid,imgdim,funcid=0):
     return {"desc":f"RGB to Gray {imgdim[0]}x{imgdim[1]}",
@@ -50,37 +66,39 @@ def rgb_to_gray_test(imgid,imgdim,funcid=0):
             "check" : SimilarTensorFixp(1)
            }
 
-def gray8_crop_test(imgdim,funcid,left,top,right,bottom):
-    return {"desc":f"Gray 8 crop test {imgdim[0]}x{imgdim[1]} -> {right-left}x{bottom-top} ",
+def gray8_crop_test(imgdim,funcid,left,top,right,bottom,view=False):
+    return {"desc":f"Gray 8 {'view' if view else 'crop'} test {imgdim[0]}x{imgdim[1]} -> {right-left}x{bottom-top} ",
             "funcid": funcid,
             "useimg": [0],
             "reference": CropGray8((left,right),(top,bottom)),
             "check" : SimilarTensorFixp(0)
            }
 
-def rgb_crop_test(imgdim,funcid,left,top,right,bottom):
-    return {"desc":f"RGB crop test {imgdim[0]}x{imgdim[1]} -> {right-left}x{bottom-top} ",
+def rgb_crop_test(imgdim,funcid,left,top,right,bottom,view=False):
+    return {"desc":f"RGB {'view' if view else 'crop'} test {imgdim[0]}x{imgdim[1]} -> {right-left}x{bottom-top} ",
             "funcid": funcid,
             "useimg": [1],
             "reference": CropRGB((left,right),(top,bottom)),
             "check" : SimilarTensorFixp(0)
            }
 
-def gaussian_test(imgid, imgdim, funcid=2, img_type="gray8", border_type = 'reflect', kernel_size = 3, threshold = 0):
-    return {"desc":f"Gauss {kernel_size}x{kernel_size} {img_type} image {imgdim[0]}x{imgdim[1]}",
+def gaussian_test(imgid, imgdim, funcid=2, img_type="gray8", border_type = 'reflect', kernel_size = 3, threshold = 0, strip=False, stride=False):
+    test = {"desc":f"Gauss {kernel_size}x{kernel_size} {'strips ' if strip else ''}{'strided ' if stride else ''}{img_type} image {imgdim[0]}x{imgdim[1]}",
             "funcid": funcid,
             "useimg": [imgid],
             "reference": GaussianFilter(border_type, kernel_size),
             "check" : SimilarTensorFixp(threshold)
             }
+    return strip_test(test) if strip else test
 
-def sobel_test(imgid, imgdim, funcid=0, img_type="gray8", axis=0, border_type='reflect'):
-    return {"desc":f"Sobel {img_type} image {imgdim[0]}x{imgdim[1]}",
+def sobel_test(imgid, imgdim, funcid=0, img_type="gray8", axis=0, border_type='reflect', strip=False):
+    test = {"desc":f"Sobel {'strips ' if strip else ''}{img_type} image {imgdim[0]}x{imgdim[1]}",
             "funcid": funcid,
             "useimg": [imgid],
             "reference": SobelFilter(border_type,axis),
             "check" : SimilarTensorFixp(0)
             }
+    return strip_test(test) if strip else test
 
 def gray8_resize_test(imgdim,funcid,dst_w,dst_h):
     return {"desc":f"Gray 8 resize test {imgdim[0]}x{imgdim[1]} -> {dst_w}x{dst_h} ",
@@ -106,6 +124,219 @@ def bgr8U3C_resize_to_rgb_test(imgdim,funcid,dst_w,dst_h):
             "check" : SimilarTensorFixp(20)
            }
 
+def gray8_resize_fixp_test(imgdim,funcid,dst_w,dst_h,plan=False):
+    return {"desc":f"Gray 8 fixp resize {'plan ' if plan else ''}test {imgdim[0]}x{imgdim[1]} -> {dst_w}x{dst_h} ",
+            "funcid": funcid,
+            "useimg": [0],
+            "reference": ResizeGray8Fixp(dst_w,dst_h),
+            "check" : SimilarTensorFixp(0)
+           }
+
+def bgr8U3C_resize_fixp_test(imgdim,funcid,dst_w,dst_h,plan=False):
+    return {"desc":f"BGR 8U3C fixp resize {'plan ' if plan else ''}test {imgdim[0]}x{imgdim[1]} -> {dst_w}x{dst_h} ",
+            "funcid": funcid,
+            "useimg": [2],
+            "reference": ResizeBGR_8U3C_Fixp(dst_w,dst_h),
+            "check" : SimilarTensorFixp(0)
+           }
+
+def rgb_resize_fixp_test(imgdim,funcid,dst_w,dst_h,plan=False):
+    return {"desc":f"RGB fixp resize {'plan ' if plan else ''}test {imgdim[0]}x{imgdim[1]} -> {dst_w}x{dst_h} ",
+            "funcid": funcid,
+            "useimg": [1],
+            "reference": ResizeRGB24Fixp(dst_w,dst_h),
+            "check" : SimilarTensorFixp(0)
+           }
+
+def yuv420_resize_to_rgb_fixp_test(imgdim,funcid,dst_w,dst_h):
+    return {"desc":f"YUV420 fixp resize to RGB test {imgdim[0]}x{imgdim[1]} -> {dst_w}x{dst_h} ",
+            "funcid": funcid,
+            "useimg": [3],
+            "reference": ResizeYUV420ToRGB24Fixp(dst_w,dst_h),
+            "check" : SimilarTensorFixp(0)
+           }
+
+# Same values as the tensor_norm_* of the C tests
+# (mean, scale, quantization scale, zero point)
+TENSOR_NORM_IMAGENET = ((123.675,116.28,103.53),
+                        (1.0/np.float32(58.395),1.0/np.float32(57.12),1.0/np.float32(57.375)),
+                        0.0186,
+                        -14)
+TENSOR_NORM_UNIT = ((127.5,127.5,127.5),
+                    (1.0/np.float32(127.5),1.0/np.float32(127.5),1.0/np.float32(127.5)),
+                    1.0/128.0,
+                    128)
+
+def gray8_to_tensor_test(imgdim,funcid,dtype,layout,norm):
+    return {"desc":f"Gray 8 to {np.dtype(dtype).name} {layout} tensor {imgdim[0]}x{imgdim[1]} ",
+            "funcid": funcid,
+            "useimg": [0],
+            "reference": ImageToTensor(norm,dtype,layout),
+            "check" : SimilarTensor() if dtype == np.float32 else SimilarTensorFixp(0)
+           }
+
+def rgb_to_tensor_test(imgdim,funcid,dtype,layout,norm):
+    return {"desc":f"RGB to {np.dtype(dtype).name} {layout} tensor {imgdim[0]}x{imgdim[1]} ",
+            "funcid": funcid,
+            "useimg": [1],
+            "reference": ImageToTensor(norm,dtype,layout),
+            "check" : SimilarTensor() if dtype == np.float32 else SimilarTensorFixp(0)
+           }
+
+def bgr8U3C_to_tensor_test(imgdim,funcid,dtype,layout,norm):
+    return {"desc":f"BGR 8U3C to {np.dtype(dtype).name} {layout} tensor {imgdim[0]}x{imgdim[1]} ",
+            "funcid": funcid,
+            "useimg": [2],
+            "reference": ImageToTensor(norm,dtype,layout,channel_first=True,bgr=True),
+            "check" : SimilarTensor() if dtype == np.float32 else SimilarTensorFixp(0)
+           }
+
+def nv12_gray8_test(imgdim,funcid,fmt):
+    return {"desc":f"{fmt} to GRAY8 {imgdim[0]}x{imgdim[1]}",
+            "funcid": funcid,
+            "useimg": [3],
+            "reference": YUV420ToGray8(),
+            "check" : SimilarTensorFixp()
+           }
+
+def nv12_to_rgb_test(imgdim,funcid,fmt):
+    return {"desc":f"{fmt} to RGB {imgdim[0]}x{imgdim[1]}",
+            "funcid": funcid,
+            "useimg": [3],
+            "reference": YUV420ToRGB(),
+            "check" : SimilarTensorFixp(1)
+           }
+
+def nv12_resize_to_rgb_fixp_test(imgdim,funcid,fmt,dst_w,dst_h):
+    return {"desc":f"{fmt} fixp resize to RGB test {imgdim[0]}x{imgdim[1]} -> {dst_w}x{dst_h} ",
+            "funcid": funcid,
+            "useimg": [3],
+            "reference": ResizeYUV420ToRGB24Fixp(dst_w,dst_h),
+            "check" : SimilarTensorFixp(0)
+           }
+
+def yuv422_gray8_test(imgdim,funcid,fmt):
+    return {"desc":f"{fmt} to GRAY8 {imgdim[0]}x{imgdim[1]}",
+            "funcid": funcid,
+            "useimg": [4],
+            "reference": YUV422ToGray8(),
+            "check" : SimilarTensorFixp(0)
+           }
+
+def yuv422_to_rgb_test(imgdim,funcid,fmt):
+    return {"desc":f"{fmt} to RGB {imgdim[0]}x{imgdim[1]}",
+            "funcid": funcid,
+            "useimg": [4],
+            "reference": YUV422ToRGB(),
+            "check" : SimilarTensorFixp(0)
+           }
+
+def yuv422_to_tensor_test(imgdim,funcid,fmt,dtype,layout,norm):
+    return {"desc":f"{fmt} to {np.dtype(dtype).name} {layout} tensor {imgdim[0]}x{imgdim[1]} ",
+            "funcid": funcid,
+            "useimg": [4],
+            "reference": YUV422ToTensor(norm,dtype,layout),
+            "check" : SimilarTensor() if dtype == np.float32 else SimilarTensorFixp(0)
+           }
+
+def gray8_to_rgb565_test(imgdim,funcid):
+    return {"desc":f"Gray 8 to RGB565 {imgdim[0]}x{imgdim[1]}",
+            "funcid": funcid,
+            "useimg": [0],
+            "reference": ToRGB565(),
+            "check" : SimilarTensorFixp(0)
+           }
+
+def rgb_to_rgb565_test(imgdim,funcid):
+    return {"desc":f"RGB to RGB565 {imgdim[0]}x{imgdim[1]}",
+            "funcid": funcid,
+            "useimg": [1],
+            "reference": ToRGB565(),
+            "check" : SimilarTensorFixp(0)
+           }
+
+def rgb565_to_rgb_test(imgdim,funcid):
+    return {"desc":f"RGB565 to RGB {imgdim[0]}x{imgdim[1]}",
+            "funcid": funcid,
+            "useimg": [1],
+            "reference": RGB565ToRGB(),
+            "check" : SimilarTensorFixp(0)
+           }
+
+def rgb565_to_gray8_test(imgdim,funcid):
+    return {"desc":f"RGB565 to Gray 8 {imgdim[0]}x{imgdim[1]}",
+            "funcid": funcid,
+            "useimg": [1],
+            "reference": RGB565ToGray8(),
+            "check" : SimilarTensorFixp(0)
+           }
+
+def gray8_resize_area_test(imgdim,funcid,dst_w,dst_h):
+    return {"desc":f"Gray 8 area resize test {imgdim[0]}x{imgdim[1]} -> {dst_w}x{dst_h} ",
+            "funcid": funcid,
+            "useimg": [0],
+            "reference": ResizeAreaGray8(dst_w,dst_h),
+            "check" : SimilarTensorFixp(0)
+           }
+
+def bgr8U3C_resize_area_test(imgdim,funcid,dst_w,dst_h):
+    return {"desc":f"BGR 8U3C area resize test {imgdim[0]}x{imgdim[1]} -> {dst_w}x{dst_h} ",
+            "funcid": funcid,
+            "useimg": [2],
+            "reference": ResizeAreaBGR_8U3C(dst_w,dst_h),
+            "check" : SimilarTensorFixp(0)
+           }
+
+def rgb_resize_area_test(imgdim,funcid,dst_w,dst_h):
+    return {"desc":f"RGB area resize test {imgdim[0]}x{imgdim[1]} -> {dst_w}x{dst_h} ",
+            "funcid": funcid,
+            "useimg": [1],
+            "reference": ResizeAreaRGB24(dst_w,dst_h),
+            "check" : SimilarTensorFixp(0)
+           }
+
+def gray8_resize_nearest_test(imgdim,funcid,dst_w,dst_h):
+    return {"desc":f"Gray 8 nearest resize test {imgdim[0]}x{imgdim[1]} -> {dst_w}x{dst_h} ",
+            "funcid": funcid,
+            "useimg": [0],
+            "reference": ResizeNearestGray8(dst_w,dst_h),
+            "check" : SimilarTensorFixp(0)
+           }
+
+def bgr8U3C_resize_nearest_test(imgdim,funcid,dst_w,dst_h):
+    return {"desc":f"BGR 8U3C nearest resize test {imgdim[0]}x{imgdim[1]} -> {dst_w}x{dst_h} ",
+            "funcid": funcid,
+            "useimg": [2],
+            "reference": ResizeNearestBGR_8U3C(dst_w,dst_h),
+            "check" : SimilarTensorFixp(0)
+           }
+
+def rgb_resize_nearest_test(imgdim,funcid,dst_w,dst_h):
+    return {"desc":f"RGB nearest resize test {imgdim[0]}x{imgdim[1]} -> {dst_w}x{dst_h} ",
+            "funcid": funcid,
+            "useimg": [1],
+            "reference": ResizeNearestRGB24(dst_w,dst_h),
+            "check" : SimilarTensorFixp(0)
+           }
+
+def gray8_integral_test(imgdim,funcid,width=None):
+    w = imgdim[0] if width is None else width
+    return {"desc":f"Gray 8 integral test {w}x{imgdim[1]}",
+            "funcid": funcid,
+            "useimg": [0],
+            "reference": IntegralGray8(width),
+            "check" : SimilarTensorFixp(0)
+           }
+
+def gray8_integral_squared_test(imgdim,funcid,width=None):
+    w = imgdim[0] if width is None else width
+    return {"desc":f"Gray 8 integral and squared integral test {w}x{imgdim[1]}",
+            "funcid": funcid,
+            "useimg": [0],
+            "reference": IntegralSquaredGray8(width),
+            "check" : SimilarTensorFixp(0)
+           }
+
 def canny_sobel_test(imgid, imgdim, funcid=2, img_type="gray8"):
     return {"desc":f"Gauss {img_type} image {imgdim[0]}x{imgdim[1]}",
             "funcid": funcid,
@@ -122,10 +353,75 @@ def canny_sobel_test_autoref(imgid, imgdim, funcid=0, img_type="gray8"):
             "check" : SimilarTensorFixp(0)
             }
 
-def gaussian_test_32(imgid, imgdim, funcid=2, img_type="gray8", border_type = 'reflect', kernel_size = 3, threshold = 0):
-    return {"desc":f"Gauss {kernel_size}x{kernel_size} {img_type} image {imgdim[0]}x{imgdim[1]}",
+# The model is exact with the octant direction and the L1 magnitude. Otherwise
+# arm_atan2_q15 and arm_sqrt_q31 are approximated so a few pixels can differ
+def _canny_check(octant, l1):
+    return SimilarImage(0) if octant and l1 else SimilarImage(1)
+
+def canny_gaussian_sobel_test(imgid, imgdim, funcid, border_type='nearest', octant=False, l1=False, hysteresis=False, strip=False):
+    test = {"desc":f"Canny gaussian sobel {'strips ' if strip else ''}{border_type} image {imgdim[0]}x{imgdim[1]}",
+            "funcid": funcid,
+            "useimg": [imgid],
+            "reference": CannyEdgeGaussianSobel(border_type, 33, 78, octant, l1, hysteresis),
+            "check" : _canny_check(octant, l1)
+            }
+    return strip_test(test) if strip else test
+
+def canny_sobel_flags_test(imgid, imgdim, funcid, octant=False, l1=False, hysteresis=False, strip=False):
+    test = {"desc":f"Canny sobel flags {'strips ' if strip else ''}image {imgdim[0]}x{imgdim[1]}",
+            "funcid": funcid,
+            "useimg": [imgid],
+            "reference": CannyEdgeGaussianSobel(None, 33, 78, octant, l1, hysteresis),
+            "check" : _canny_check(octant, l1)
+            }
+    return strip_test(test) if strip else test
+
+def gaussian_test_32(imgid, imgdim, funcid=2, img_type="gray8", border_type = 'reflect', kernel_size = 3, threshold = 0, strip=False):
+    test = {"desc":f"Gauss {kernel_size}x{kernel_size} {'strips ' if strip else ''}{img_type} image {imgdim[0]}x{imgdim[1]}",
             "funcid": funcid,
             "useimg": [imgid],
             "reference": GaussianFilter(border_type, kernel_size),
             "check" : SimilarTensorFixp(threshold)
-            }
\ No newline at end of file
+            }
+    return strip_test(test) if strip else test
+
+def separable_filter_test(imgid, imgdim, funcid, coefs_row, coefs_col, shift, border_type = 'reflect'):
+    return {"desc":f"Separable {len(coefs_row)}x{len(coefs_col)} filter gray8 image {imgdim[0]}x{imgdim[1]}",
+            "funcid": funcid,
+            "useimg": [imgid],
+            "reference": SeparableFilter(border_type, coefs_row, coefs_col, shift),
+            "check" : SimilarTensorFixp(0)
+            }
+
+def gaussian_plan_test(imgid, imgdim, funcid, sigma, kernel_size, border_type = 'reflect', threshold = 0):
+    coefs, shift = gaussian_plan_coefs(sigma, kernel_size)
+    return {"desc":f"Gauss sigma {sigma} gray8 image {imgdim[0]}x{imgdim[1]}",
+            "funcid": funcid,
+            "useimg": [imgid],
+            "reference": SeparableFilter(border_type, coefs, coefs, shift),
+            "check" : SimilarTensorFixp(threshold)
+            }
+
+def scratch_planner_test(imgid, imgdim, funcid):
+    return {"desc":f"Scratch planner width {imgdim[0]}",
+            "funcid": funcid,
+            "useimg": [imgid],
+            "reference": NoReference(),
+            "check" : IdenticalResults()
+            }
+
+def box_filter_test(imgid, imgdim, funcid, radius, border_type = 'reflect'):
+    return {"desc":f"Box radius {radius} gray8 image {imgdim[0]}x{imgdim[1]}",
+            "funcid": funcid,
+            "useimg": [imgid],
+            "reference": BoxFilter(border_type, radius),
+            "check" : SimilarTensorFixp(0)
+            }
+
+def median_filter_test(imgid, imgdim, funcid, kernel_size = 3, border_type = 'reflect'):
+    return {"desc":f"Median {kernel_size}x{kernel_size} gray8 image {imgdim[0]}x{imgdim[1]}",
+            "funcid": funcid,
+            "useimg": [imgid],
+            "reference": MedianFilter(border_type, kernel_size),
+            "check" : SimilarTensorFixp(0)
+            }
@@ -98,6 +98,26 @@ def YUV420toRGB(src):
 
     return(rgb)
 
+# Packed YUYV 4:2:2 with BT.601 limited range.
+# The chroma is averaged over each pair of pixels of a row so,
+# unlike a YUV420 image, each row has its own chroma.
+# The image is a (height, width, 2) tensor : (Y0,U) (Y1,V) ...
+def RGBtoYUYV(src):
+    rgb = src.astype(np.float64)
+    r,g,b = rgb[:,:,0],rgb[:,:,1],rgb[:,:,2]
+    y = 16 + (65.481 * r + 128.553 * g + 24.966 * b) / 255.0
+    u = 128 + (-37.797 * r - 74.203 * g + 112.0 * b) / 255.0
+    v = 128 + (112.0 * r - 93.786 * g - 18.214 * b) / 255.0
+    u = (u[:,0::2] + u[:,1::2]) / 2.0
+    v = (v[:,0::2] + v[:,1::2]) / 2.0
+
+    to_u8 = lambda x : np.clip(np.round(x),0,255).astype(np.uint8)
+    res = np.zeros((src.shape[0],src.shape[1],2),dtype=np.uint8)
+    res[:,:,0] = to_u8(y)
+    res[:,0::2,1] = to_u8(u)
+    res[:,1::2,1] = to_u8(v)
+    return(res)
+
 
 ##
 ## This class describes a format.
@@ -108,6 +128,7 @@ class Format:
     RGB24 = 1 # RGB888 / RGB24 (packed)
     YUV420 = 2 # Planar format 
     BGR8U3C = 3 # Unpacked. 8 bits per channel
+    YUYV = 4 # YUV422 packed. Y0 U Y1 V
 
 class _ImageGenerator:
     def __init__(self,dims,format=Format.GRAY8):
@@ -130,6 +151,8 @@ class _ImageGenerator:
                 nimg = np.asarray(nimg,dtype=np.uint8)
                 # Unpack components
                 nimg = np.transpose(nimg,(2,0,1))
+            elif self._format == Format.YUYV:
+                nimg = RGBtoYUYV(np.asarray(nimg.convert("RGB")))
 
             res.append(AlgoImage(nimg))
 
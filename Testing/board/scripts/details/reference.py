@@ -344,6 +344,503 @@ class HimaxResizeBGR_8U3C_to_RGB24:
     def nb_references(self,srcs):
         return len(srcs)
         
+# Python model of the fixed point resize
+# The C code only uses integers so the model is bit exact
+def _fixp_resize_scale(input_size,output_size):
+    if (output_size <= 1) or (input_size <= 1):
+        return 0
+    return (((input_size - 1) << 16) + (output_size - 1) // 2) // (output_size - 1)
+
+def _fixp_resize_pos(input_size,output_size):
+    s = np.arange(output_size,dtype=np.uint32) * _fixp_resize_scale(input_size,output_size) + 128
+    i = s >> 16
+    f = (s >> 8) & 0xFF
+    return(i,np.minimum(i+1,input_size-1),f)
+
+def _fixp_resize(input,output_w,output_h):
+    input_h,input_w = input.shape
+    src = input.astype(np.uint32)
+    ix,ix1,fx = _fixp_resize_pos(input_w,output_w)
+    iy,iy1,fy = _fixp_resize_pos(input_h,output_h)
+    fy = fy.reshape(-1,1)
+
+    lines = src[:,ix]*(256-fx) + src[:,ix1]*fx
+    result = (lines[iy,:]*(256-fy) + lines[iy1,:]*fy + 32768) >> 16
+
+    return(result.astype(np.uint8))
+
+class ResizeGray8Fixp:
+    def __init__(self,w,h):
+        self._dst_width = w
+        self._dst_height = h
+
+    def __call__(self,args,group_id,test_id,srcs):
+        filtered = []
+        for i in srcs:
+            resized = _fixp_resize(i.tensor,self._dst_width,self._dst_height)
+
+            img = PIL.Image.fromarray(resized).convert('L')
+            filtered.append(AlgoImage(img))
+
+        # Record the filtered images
+        for image_id,img in enumerate(filtered):
+            record_reference_img(args,group_id,test_id,image_id,img)
+
+    def nb_references(self,srcs):
+        return len(srcs)
+
+class ResizeBGR_8U3C_Fixp:
+    def __init__(self,w,h):
+        self._dst_width = w
+        self._dst_height = h
+
+    def __call__(self,args,group_id,test_id,srcs):
+        filtered = []
+        for i in srcs:
+            resized = np.stack([_fixp_resize(i.tensor[c],self._dst_width,self._dst_height)
+                                for c in range(3)])
+
+            filtered.append(AlgoImage(resized))
+
+        # Record the filtered images
+        for image_id,img in enumerate(filtered):
+            record_reference_img(args,group_id,test_id,image_id,img)
+
+    def nb_references(self,srcs):
+        return len(srcs)
+
+class ResizeRGB24Fixp:
+    def __init__(self,w,h):
+        self._dst_width = w
+        self._dst_height = h
+
+    def __call__(self,args,group_id,test_id,srcs):
+        filtered = []
+        for i in srcs:
+            resized = np.stack([_fixp_resize(i.tensor[:,:,c],self._dst_width,self._dst_height)
+                                for c in range(3)],axis=2)
+
+            img = PIL.Image.fromarray(resized).convert('RGB')
+            filtered.append(AlgoImage(img))
+
+        # Record the filtered images
+        for image_id,img in enumerate(filtered):
+            record_reference_img(args,group_id,test_id,image_id,img)
+
+    def nb_references(self,srcs):
+        return len(srcs)
+
+# Same Q17 conversion as arm_yuv420_to_rgb24
+def _yuv_to_rgb_q17(y,u,v):
+    y = y.astype(np.int64) - 16
+    u = u.astype(np.int64) - 128
+    v = v.astype(np.int64) - 128
+    coefs = [(152586,-234,209163),
+             (152586,-51307,-106625),
+             (152586,264481,-163)]
+    rgb = [np.clip(np.maximum(a*y + b*u + c*v,0) >> 17,0,255) for a,b,c in coefs]
+    return(np.stack(rgb,axis=2).astype(np.uint8))
+
+class ResizeYUV420ToRGB24Fixp:
+    def __init__(self,w,h):
+        self._dst_width = w
+        self._dst_height = h
+
+    def __call__(self,args,group_id,test_id,srcs):
+        filtered = []
+        for i in srcs:
+            y,u,v = [_fixp_resize(p,self._dst_width,self._dst_height) for p in i.img.planes]
+
+            img = PIL.Image.fromarray(_yuv_to_rgb_q17(y,u,v)).convert('RGB')
+            filtered.append(AlgoImage(img))
+
+        # Record the filtered images
+        for image_id,img in enumerate(filtered):
+            record_reference_img(args,group_id,test_id,image_id,img)
+
+    def nb_references(self,srcs):
+        return len(srcs)
+
+# Python model of the area resize
+def _area_resize_weights(input_size,output_size):
+    pos = lambda d : (d * 65536 + input_size // 2) // input_size
+    w = np.zeros((input_size,output_size),dtype=np.int64)
+    for r in range(output_size):
+        first = (r * input_size) // output_size
+        last = ((r + 1) * input_size - 1) // output_size
+        for y in range(first,last+1):
+            start = max(y * output_size - r * input_size,0)
+            end = min((y + 1) * output_size - r * input_size,input_size)
+            w[y,r] = pos(end) - pos(start)
+    return(w)
+
+def _area_resize(input,output_w,output_h):
+    input_h,input_w = input.shape
+    if (input_w % output_w == 0) and (input_h % output_h == 0) and \
+       ((input_w // output_w) * (input_h // output_h) <= 65535):
+        # Pixel binning
+        fx = input_w // output_w
+        fy = input_h // output_h
+        s = input.astype(np.uint64).reshape(output_h,fy,output_w,fx).sum(axis=(1,3))
+        recip = ((1 << 24) + (fx * fy) // 2) // (fx * fy)
+        result = (s * recip + (1 << 23)) >> 24
+    else:
+        # q16 weights, the horizontal sums are rounded to q8
+        h = (input.astype(np.int64) @ _area_resize_weights(input_w,output_w) + 128) >> 8
+        result = (_area_resize_weights(input_h,output_h).T @ h + (1 << 23)) >> 24
+    return(result.astype(np.uint8))
+
+class ResizeAreaGray8:
+    def __init__(self,w,h):
+        self._dst_width = w
+        self._dst_height = h
+
+    def __call__(self,args,group_id,test_id,srcs):
+        filtered = []
+        for i in srcs:
+            resized = _area_resize(i.tensor,self._dst_width,self._dst_height)
+
+            img = PIL.Image.fromarray(resized).convert('L')
+            filtered.append(AlgoImage(img))
+
+        # Record the filtered images
+        for image_id,img in enumerate(filtered):
+            record_reference_img(args,group_id,test_id,image_id,img)
+
+    def nb_references(self,srcs):
+        return len(srcs)
+
+class ResizeAreaBGR_8U3C:
+    def __init__(self,w,h):
+        self._dst_width = w
+        self._dst_height = h
+
+    def __call__(self,args,group_id,test_id,srcs):
+        filtered = []
+        for i in srcs:
+            resized = np.stack([_area_resize(i.tensor[c],self._dst_width,self._dst_height)
+                                for c in range(3)])
+
+            filtered.append(AlgoImage(resized))
+
+        # Record the filtered images
+        for image_id,img in enumerate(filtered):
+            record_reference_img(args,group_id,test_id,image_id,img)
+
+    def nb_references(self,srcs):
+        return len(srcs)
+
+class ResizeAreaRGB24:
+    def __init__(self,w,h):
+        self._dst_width = w
+        self._dst_height = h
+
+    def __call__(self,args,group_id,test_id,srcs):
+        filtered = []
+        for i in srcs:
+            resized = np.stack([_area_resize(i.tensor[:,:,c],self._dst_width,self._dst_height)
+                                for c in range(3)],axis=2)
+
+            img = PIL.Image.fromarray(resized).convert('RGB')
+            filtered.append(AlgoImage(img))
+
+        # Record the filtered images
+        for image_id,img in enumerate(filtered):
+            record_reference_img(args,group_id,test_id,image_id,img)
+
+    def nb_references(self,srcs):
+        return len(srcs)
+
+# Index of the input pixels used by the nearest neighbour resize
+def _nearest_resize_index(input_size,output_size):
+    return((np.arange(output_size) * input_size) // output_size)
+
+def _nearest_resize(input,output_w,output_h):
+    input_h,input_w = input.shape[0:2]
+    rows = _nearest_resize_index(input_h,output_h)
+    cols = _nearest_resize_index(input_w,output_w)
+    return(input[rows][:,cols])
+
+class ResizeNearestGray8:
+    def __init__(self,w,h):
+        self._dst_width = w
+        self._dst_height = h
+
+    def __call__(self,args,group_id,test_id,srcs):
+        filtered = []
+        for i in srcs:
+            resized = _nearest_resize(i.tensor,self._dst_width,self._dst_height)
+
+            img = PIL.Image.fromarray(resized).convert('L')
+            filtered.append(AlgoImage(img))
+
+        # Record the filtered images
+        for image_id,img in enumerate(filtered):
+            record_reference_img(args,group_id,test_id,image_id,img)
+
+    def nb_references(self,srcs):
+        return len(srcs)
+
+class ResizeNearestBGR_8U3C:
+    def __init__(self,w,h):
+        self._dst_width = w
+        self._dst_height = h
+
+    def __call__(self,args,group_id,test_id,srcs):
+        filtered = []
+        for i in srcs:
+            resized = np.stack([_nearest_resize(i.tensor[c],self._dst_width,self._dst_height)
+                                for c in range(3)])
+
+            filtered.append(AlgoImage(resized))
+
+        # Record the filtered images
+        for image_id,img in enumerate(filtered):
+            record_reference_img(args,group_id,test_id,image_id,img)
+
+    def nb_references(self,srcs):
+        return len(srcs)
+
+class ResizeNearestRGB24:
+    def __init__(self,w,h):
+        self._dst_width = w
+        self._dst_height = h
+
+    def __call__(self,args,group_id,test_id,srcs):
+        filtered = []
+        for i in srcs:
+            resized = np.ascontiguousarray(_nearest_resize(i.tensor,self._dst_width,self._dst_height))
+
+            img = PIL.Image.fromarray(resized).convert('RGB')
+            filtered.append(AlgoImage(img))
+
+        # Record the filtered images
+        for image_id,img in enumerate(filtered):
+            record_reference_img(args,group_id,test_id,image_id,img)
+
+    def nb_references(self,srcs):
+        return len(srcs)
+
+# Python model of the conversion to a network input tensor.
+# Same float32 operations as the lookup tables of the C plan
+def _tensor_lut(norm,k,dtype):
+    mean,scale,q_scale,zero_point = norm
+    p = np.arange(256,dtype=np.float32)
+    v = (p - np.float32(mean[k])) * np.float32(scale[k])
+    if dtype == np.float32:
+        return(v)
+    v = v / np.float32(q_scale)
+    q = np.where(v >= 0, np.floor(v + np.float32(0.5)), -np.floor(np.float32(0.5) - v))
+    info = np.iinfo(dtype)
+    q = np.clip(q.astype(np.int64) + zero_point,info.min,info.max)
+    return(q.astype(dtype))
+
+class ImageToTensor:
+    # channel_first is True when the input tensor is planar (BGR 8U3C)
+    def __init__(self,norm,dtype,layout,channel_first=False,bgr=False):
+        self._norm = norm
+        self._dtype = dtype
+        self._layout = layout
+        self._channel_first = channel_first
+        self._bgr = bgr
+
+    def __call__(self,args,group_id,test_id,srcs):
+        filtered = []
+        for i in srcs:
+            t = i.tensor
+            if len(t.shape) == 2:
+                t = t.reshape(1,t.shape[0],t.shape[1])
+            elif not self._channel_first:
+                t = np.transpose(t,(2,0,1))
+            if self._bgr:
+                t = t[::-1]
+            res = np.stack([_tensor_lut(self._norm,k,self._dtype)[t[k]]
+                            for k in range(t.shape[0])])
+            if self._layout == "NHWC":
+                res = np.transpose(res,(1,2,0))
+            filtered.append(AlgoImage(np.ascontiguousarray(res)))
+
+        # Record the filtered images
+        for image_id,img in enumerate(filtered):
+            record_reference_img(args,group_id,test_id,image_id,img)
+
+    def nb_references(self,srcs):
+        return len(srcs)
+
+# Y, U and V planes of a packed YUYV image with the chroma
+# repeated on the two pixels sharing it
+def _yuyv_planes(t):
+    y = t[:,:,0]
+    u = np.repeat(t[:,0::2,1],2,axis=1)
+    v = np.repeat(t[:,1::2,1],2,axis=1)
+    return(y,u,v)
+
+# The UYVY input of the C test is built from the YUYV image
+class YUV422ToGray8:
+    def __call__(self,args,group_id,test_id,srcs):
+        filtered = []
+        for i in srcs:
+            gray = np.ascontiguousarray(i.tensor[:,:,0])
+            dims = gray.shape
+            img = PIL.Image.frombytes('L',(dims[1],dims[0]),gray)
+            filtered.append(AlgoImage(img))
+
+        # Record the filtered images
+        for image_id,img in enumerate(filtered):
+            record_reference_img(args,group_id,test_id,image_id,img)
+
+    def nb_references(self,srcs):
+        return len(srcs)
+
+class YUV422ToRGB:
+    def __call__(self,args,group_id,test_id,srcs):
+        filtered = []
+        for i in srcs:
+            y,u,v = _yuyv_planes(i.tensor)
+            img = PIL.Image.fromarray(_yuv_to_rgb_q17(y,u,v)).convert('RGB')
+            filtered.append(AlgoImage(img))
+
+        # Record the filtered images
+        for image_id,img in enumerate(filtered):
+            record_reference_img(args,group_id,test_id,image_id,img)
+
+    def nb_references(self,srcs):
+        return len(srcs)
+
+class YUV422ToTensor:
+    def __init__(self,norm,dtype,layout):
+        self._norm = norm
+        self._dtype = dtype
+        self._layout = layout
+
+    def __call__(self,args,group_id,test_id,srcs):
+        filtered = []
+        for i in srcs:
+            y,u,v = _yuyv_planes(i.tensor)
+            t = np.transpose(_yuv_to_rgb_q17(y,u,v),(2,0,1))
+            res = np.stack([_tensor_lut(self._norm,k,self._dtype)[t[k]]
+                            for k in range(3)])
+            if self._layout == "NHWC":
+                res = np.transpose(res,(1,2,0))
+            filtered.append(AlgoImage(np.ascontiguousarray(res)))
+
+        # Record the filtered images
+        for image_id,img in enumerate(filtered):
+            record_reference_img(args,group_id,test_id,image_id,img)
+
+    def nb_references(self,srcs):
+        return len(srcs)
+
+# Python model of the RGB565 conversions
+def _to_rgb565(r,g,b):
+    r = r.astype(np.uint16) >> 3
+    g = g.astype(np.uint16) >> 2
+    b = b.astype(np.uint16) >> 3
+    return((r << 11) | (g << 5) | b)
+
+def _from_rgb565(p):
+    r = (p >> 11) & 0x1F
+    g = (p >> 5) & 0x3F
+    b = p & 0x1F
+    rgb = [(r << 3) | (r >> 2), (g << 2) | (g >> 4), (b << 3) | (b >> 2)]
+    return(np.stack(rgb,axis=2).astype(np.uint8))
+
+class ToRGB565:
+    def __call__(self,args,group_id,test_id,srcs):
+        filtered = []
+        for i in srcs:
+            t = i.tensor
+            if len(t.shape) == 2:
+                res = _to_rgb565(t,t,t)
+            else:
+                res = _to_rgb565(t[:,:,0],t[:,:,1],t[:,:,2])
+            # Not an image format so it is recorded as .npy
+            filtered.append(AlgoImage(np.ascontiguousarray(res)))
+
+        # Record the filtered images
+        for image_id,img in enumerate(filtered):
+            record_reference_img(args,group_id,test_id,image_id,img)
+
+    def nb_references(self,srcs):
+        return len(srcs)
+
+# The RGB565 input of the C test is built from the RGB24 image
+class RGB565ToRGB:
+    def __call__(self,args,group_id,test_id,srcs):
+        filtered = []
+        for i in srcs:
+            t = i.tensor
+            rgb = _from_rgb565(_to_rgb565(t[:,:,0],t[:,:,1],t[:,:,2]))
+            img = PIL.Image.fromarray(rgb).convert('RGB')
+            filtered.append(AlgoImage(img))
+
+        # Record the filtered images
+        for image_id,img in enumerate(filtered):
+            record_reference_img(args,group_id,test_id,image_id,img)
+
+    def nb_references(self,srcs):
+        return len(srcs)
+
+# Same Q7 weights as arm_rgb24_to_gray8
+class RGB565ToGray8:
+    def __call__(self,args,group_id,test_id,srcs):
+        filtered = []
+        for i in srcs:
+            t = i.tensor
+            rgb = _from_rgb565(_to_rgb565(t[:,:,0],t[:,:,1],t[:,:,2])).astype(np.uint32)
+            gray = (38 * rgb[:,:,0] + 75 * rgb[:,:,1] + 15 * rgb[:,:,2] + 0x7F) >> 7
+            gray = np.clip(gray,0,255).astype(np.uint8)
+            dims = gray.shape
+            img = PIL.Image.frombytes('L',(dims[1],dims[0]),gray)
+            filtered.append(AlgoImage(img))
+
+        # Record the filtered images
+        for image_id,img in enumerate(filtered):
+            record_reference_img(args,group_id,test_id,image_id,img)
+
+    def nb_references(self,srcs):
+        return len(srcs)
+
+def _integral(tensor):
+    # Same convention as OpenCV, first row and column are 0
+    integral = np.zeros((tensor.shape[0]+1,tensor.shape[1]+1),dtype=np.uint32)
+    integral[1:,1:] = np.cumsum(np.cumsum(tensor.astype(np.uint32),axis=0),axis=1)
+    return integral
+
+class IntegralGray8:
+    # Integral of the first width columns of the input
+    def __init__(self,width=None):
+        self._width = width
+
+    def __call__(self,args,group_id,test_id,srcs):
+        filtered = []
+        for i in srcs:
+            integral = _integral(i.tensor[:,:self._width])
+            # Not an image format so it is recorded as .npy
+            filtered.append(AlgoImage(integral))
+
+        # Record the filtered images
+        for image_id,img in enumerate(filtered):
+            record_reference_img(args,group_id,test_id,image_id,img)
+
+    def nb_references(self,srcs):
+        return len(srcs)
+        
+class IntegralSquaredGray8:
+    # Integral and squared integral of the first width columns
+    # of the input. The board narrows the squared integral
+    # to 32 bits
+    def __init__(self,width=None):
+        self._width = width
+
+    def __call__(self,args,group_id,test_id,srcs):
+        t = srcs[0].tensor[:,:self._width].astype(np.uint32)
+        record_reference_img(args,group_id,test_id,0,AlgoImage(_integral(t)))
+        record_reference_img(args,group_id,test_id,1,AlgoImage(_integral(t*t)))
+
+    def nb_references(self,srcs):
+        return 2
+
 def custom_filter(image):
     return((image[0]+(image[1])*2+image[2]+(image[3])*2+(image[4])*4+(image[5])*2+image[6]+(image[7])*2+image[8])/16)    
 
@@ -416,6 +913,217 @@ class SobelFilter:
     def nb_references(self,srcs):
         return len(srcs)
     
+class SeparableFilter:
+    def __init__(self, mode_select, coefs_row, coefs_col, shift):
+        self._mode = mode_select
+        self._coefs_row = np.array(coefs_row, dtype=np.int64)
+        self._coefs_col = np.array(coefs_col, dtype=np.int64)
+        self._shift = shift
+
+    def __call__(self,args,group_id,test_id,srcs):
+        filtered = []
+        for i in srcs:
+            # Integer computation to be bit exact with the fixed point implementation
+            # The vertical pass is done first like in the C code
+            tmp = scipy.ndimage.correlate1d(i.tensor.astype(np.int64), self._coefs_col, axis=0, mode=self._mode)
+            tmp = scipy.ndimage.correlate1d(tmp, self._coefs_row, axis=1, mode=self._mode)
+            if self._shift > 0:
+                tmp = (tmp + (1 << (self._shift - 1))) >> self._shift
+            res = np.clip(tmp, 0, 255).astype(np.uint8)
+            pil = PIL.Image.fromarray(res)
+            filtered.append(AlgoImage(pil))
+
+        # Record the filtered images
+        for image_id,img in enumerate(filtered):
+            record_reference_img(args,group_id,test_id,image_id,img)
+
+    def nb_references(self,srcs):
+        return len(srcs)
+
+def gaussian_plan_coefs(sigma, kernel_size):
+    # Same computation as arm_gaussian_plan_init
+    if kernel_size == 0:
+        kernel_size = int(sigma * 6.0 + 1.5) | 1
+    kernel_size = min(max(kernel_size | 1, 3), 15)
+    if sigma <= 0:
+        sigma = 0.3 * ((kernel_size - 1) * 0.5 - 1.0) + 0.8
+    x = np.arange(kernel_size, dtype=np.float32) - (kernel_size >> 1)
+    kernel = np.exp(-(x * x) / np.float32(2.0 * sigma * sigma)).astype(np.float32)
+    kernel = kernel / np.sum(kernel)
+
+    def quantize(bits):
+        coefs = (kernel * (1 << bits) + 0.5).astype(np.int64)
+        coefs[kernel_size >> 1] += (1 << bits) - np.sum(coefs)
+        return coefs
+
+    coefs = quantize(7)
+    exact = kernel * (1 << 7)
+    if np.all(np.abs(coefs - exact) <= exact / 32.0):
+        return (list(coefs), 14)
+    return (list(quantize(14)), 28)
+
+class BoxFilter:
+    def __init__(self, mode_select, radius):
+        self._mode = mode_select
+        self._radius = radius
+
+    def __call__(self,args,group_id,test_id,srcs):
+        filtered = []
+        kernel_size = 2 * self._radius + 1
+        area = kernel_size * kernel_size
+        for i in srcs:
+            ones = np.ones(kernel_size, dtype=np.int64)
+            tmp = scipy.ndimage.correlate1d(i.tensor.astype(np.int64), ones, axis=0, mode=self._mode)
+            tmp = scipy.ndimage.correlate1d(tmp, ones, axis=1, mode=self._mode)
+            # Mean rounded to the nearest integer
+            res = ((tmp + (area >> 1)) // area).astype(np.uint8)
+            pil = PIL.Image.fromarray(res)
+            filtered.append(AlgoImage(pil))
+
+        # Record the filtered images
+        for image_id,img in enumerate(filtered):
+            record_reference_img(args,group_id,test_id,image_id,img)
+
+    def nb_references(self,srcs):
+        return len(srcs)
+
+class MedianFilter:
+    def __init__(self, mode_select, kernel_size):
+        self._mode = mode_select
+        self._kernel_size = kernel_size
+
+    def __call__(self,args,group_id,test_id,srcs):
+        filtered = []
+        for i in srcs:
+            median = scipy.ndimage.median_filter(i.tensor, size=self._kernel_size, mode=self._mode)
+            pil = PIL.Image.fromarray(median)
+            filtered.append(AlgoImage(pil))
+
+        # Record the filtered images
+        for image_id,img in enumerate(filtered):
+            record_reference_img(args,group_id,test_id,image_id,img)
+
+    def nb_references(self,srcs):
+        return len(srcs)
+
+# Pixels (line, column) compared with the magnitude along the gradient and
+# neighbors used by the hysteresis, for each direction of the gradient.
+# Same as the DECISION macros of arm_cannysobel.c
+_CANNY_VERTICAL = ([(0,-1),(0,1)], [(-1,-1),(-1,0),(-1,1),(1,-1),(1,0),(1,1)])
+_CANNY_DIAGONAL_45 = ([(1,-1),(-1,1)], [(-1,-1),(-1,0),(0,1),(0,-1),(1,0),(1,1)])
+_CANNY_HORIZONTAL = ([(-1,0),(1,0)], [(-1,-1),(-1,-1),(0,1),(0,-1),(1,1),(1,1)])
+_CANNY_DIAGONAL_135 = ([(-1,-1),(1,1)], [(-1,-1),(-1,0),(0,1),(0,-1),(1,0),(1,1)])
+
+_TAN_22_5_Q15 = 13573
+
+def _deg_to_rad_q2_13(angle):
+    return(int(round(angle * np.pi / 180.0 * 2**13)))
+
+def canny_edge_model(img, low_threshold, high_threshold, octant=False, l1=False, hysteresis=False):
+    # Fixed point model of the canny edge of the library (after the gaussian).
+    # Gradients and magnitudes are in Q2.13 and the borders of the output are 0.
+    # The angle is computed in float so a pixel may be different when
+    # the angle is very close to one of the limits.
+    # With octant, the direction is found like with ARM_CV_CANNY_OCTANT_DIRECTION
+    # and with l1 the magnitude is computed like with ARM_CV_CANNY_L1_GRADIENT.
+    # With hysteresis, the weak pixels connected to a strong pixel are kept
+    # like with ARM_CV_CANNY_FULL_HYSTERESIS
+    height, width = img.shape
+    res = np.zeros((height, width), dtype=np.uint8)
+    if height < 3 or width < 3:
+        return res
+    s = img.astype(np.int64)
+    top, mid, bot = s[:-2,:], s[1:-1,:], s[2:,:]
+    horizontal = lambda l: (l[:,:-2] + 2 * l[:,1:-1] + l[:,2:]) << 5
+    vertical = (top + 2 * mid + bot) << 5
+    gradx = horizontal(top) - horizontal(bot)
+    grady = vertical[:,:-2] - vertical[:,2:]
+
+    mag = np.zeros((height, width), dtype=np.int64)
+    if l1:
+        mag[1:-1,1:-1] = np.minimum(np.abs(gradx) + np.abs(grady), 32767)
+    else:
+        mag[1:-1,1:-1] = np.floor(np.sqrt(2.0 * ((gradx * gradx + grady * grady) >> 1)))
+    angle = np.abs(np.round(np.arctan2(gradx, grady) * 2**13))
+
+    low = low_threshold << 5
+    high = high_threshold << 5
+    weak = np.zeros((height, width), dtype=bool)
+    for r in range(1, height - 1):
+        for c in range(1, width - 1):
+            m = mag[r,c]
+            if m < low:
+                continue
+            gx = gradx[r-1,c-1]
+            gy = grady[r-1,c-1]
+            a = angle[r-1,c-1]
+            if octant:
+                if abs(gx) <= ((abs(gy) * _TAN_22_5_Q15) >> 15):
+                    case = _CANNY_VERTICAL
+                elif abs(gy) <= ((abs(gx) * _TAN_22_5_Q15) >> 15):
+                    case = _CANNY_HORIZONTAL
+                elif (gx ^ gy) >= 0:
+                    case = _CANNY_DIAGONAL_135
+                else:
+                    case = _CANNY_DIAGONAL_45
+            elif a < _deg_to_rad_q2_13(22):
+                case = _CANNY_VERTICAL
+            elif a < _deg_to_rad_q2_13(67):
+                case = _CANNY_DIAGONAL_45
+            elif a < _deg_to_rad_q2_13(112):
+                case = _CANNY_HORIZONTAL
+            elif a < _deg_to_rad_q2_13(160):
+                case = _CANNY_DIAGONAL_135
+            else:
+                case = _CANNY_VERTICAL
+            if any(m <= mag[r+dr,c+dc] for dr,dc in case[0]):
+                continue
+            if hysteresis:
+                weak[r,c] = True
+                if m >= high:
+                    res[r,c] = 255
+            elif m >= high or any(mag[r+dr,c+dc] >= high for dr,dc in case[1]):
+                res[r,c] = 255
+    if hysteresis:
+        # Connected components of the pixels above the low threshold
+        # containing at least one strong pixel
+        labels, _ = scipy.ndimage.label(weak, structure=np.ones((3,3)))
+        strong = np.unique(labels[res == 255])
+        res[np.isin(labels, strong[strong > 0])] = 255
+    return res
+
+class CannyEdgeGaussianSobel:
+    # No gaussian is applied when mode_select is None
+    def __init__(self, mode_select, low_threshold, high_threshold, octant=False, l1=False, hysteresis=False):
+        self._mode = mode_select
+        self._low = low_threshold
+        self._high = high_threshold
+        self._octant = octant
+        self._l1 = l1
+        self._hysteresis = hysteresis
+
+    def __call__(self,args,group_id,test_id,srcs):
+        procesed = []
+        kernel = np.array([1,2,1], dtype=np.int64)
+        for i in srcs:
+            if self._mode is None:
+                blur = i.tensor
+            else:
+                # Same rounding as arm_gaussian_filter_3x3_fixp
+                tmp = scipy.ndimage.correlate1d(i.tensor.astype(np.int64), kernel, axis=0, mode=self._mode)
+                tmp = scipy.ndimage.correlate1d(tmp, kernel, axis=1, mode=self._mode)
+                blur = tmp >> 4
+            canny = canny_edge_model(blur, self._low, self._high, self._octant, self._l1, self._hysteresis)
+            pil = PIL.Image.fromarray(canny)
+            procesed.append(AlgoImage(pil))
+
+        # Record the filtered images
+        for image_id,img in enumerate(procesed):
+            record_reference_img(args,group_id,test_id,image_id,img)
+
+    def nb_references(self,srcs):
+        return len(srcs)
+
 class CannyEdge:
     def __call__(self,args,group_id,test_id,srcs):
         procesed = []
@@ -447,4 +1155,52 @@ class CannyEdgeAutoRef:
             record_reference_img(args,group_id,test_id,image_id,img)
 
     def nb_references(self,srcs):
-        return len(srcs)
\ No newline at end of file
+        return len(srcs)
+
+# Reference of the tests of the strip functions.
+# The board returns the image processed in one call and the image
+# processed by strips. The reference of the first one is generated
+# by the wrapped reference and it is also used for the second one
+class StripReference:
+    def __init__(self, reference):
+        self._reference = reference
+
+    def __call__(self,args,group_id,test_id,srcs):
+        self._reference(args,group_id,test_id,srcs)
+        img = get_reference_img(args,group_id,test_id,0)
+        record_reference_img(args,group_id,test_id,1,img)
+
+    def nb_references(self,srcs):
+        return 2
+
+# Top left width x height part of an input image
+def _top_left_view(src,width,height):
+    if src.is_yuv420:
+        y,u,v = src.img.planes
+        return AlgoImage(YUV420(y[:height,:width],
+                                u[:height//2,:width//2],
+                                v[:height//2,:width//2]))
+    return AlgoImage(np.ascontiguousarray(src.tensor[:height,:width]))
+
+# For the tests processing only the top left part of the inputs
+class ViewReference:
+    def __init__(self, reference, width, height):
+        self._reference = reference
+        self._width = width
+        self._height = height
+
+    def __call__(self,args,group_id,test_id,srcs):
+        views = [_top_left_view(i,self._width,self._height) for i in srcs]
+        self._reference(args,group_id,test_id,views)
+
+    def nb_references(self,srcs):
+        return self._reference.nb_references(srcs)
+
+# For the tests checking the consistency of the results
+# returned by the board. There is no reference to generate
+class NoReference:
+    def __call__(self,args,group_id,test_id,srcs):
+        pass
+
+    def nb_references(self,srcs):
+        return 0
@@ -100,7 +100,7 @@ class SimilarTensorFixp(Comparison):
             dt = d.tensor
             # Cast to signed so that the difference below is giving
             # the right value
-            if st.dtype == np.uint8:
+            if st.dtype == np.uint8 or st.dtype == np.int8:
                 st = st.astype(dtype=np.int16)
                 dt = dt.astype(dtype=np.int16)
             if st.dtype == np.uint16:
@@ -141,3 +141,59 @@ class SimilarTensorFixp(Comparison):
                return False 
         return(True)
 
+# Images are considered similar when at most t percent of the pixels
+# are different. Used for edge images where a small number of pixels
+# may be different with a float reference
+class SimilarImage(Comparison):
+    def __init__(self,t=0):
+        super().__init__()
+
+        self._t = t
+
+    def __call__(self,ref,result):
+        for s,d in zip(ref,result):
+            st = s.tensor
+            dt = d.tensor
+            if st.shape != dt.shape:
+                self.add_error("Different image dimensions")
+                return False
+            nb_errors = np.count_nonzero(st != dt)
+            if nb_errors * 100 > self._t * st.size:
+                self.add_error(f"Different images. Number of different pixels = {nb_errors}")
+                return False
+        return(True)
+
+# Check of the tests of the strip functions.
+# The image processed in one call is compared to the reference with
+# the wrapped check. The image processed by strips must be identical
+# to the image processed in one call
+class StripCheck(Comparison):
+    def __init__(self,check):
+        super().__init__()
+
+        self._check = check
+
+    def __call__(self,ref,result):
+        if len(result) != 2:
+            self.add_error("Missing strip result")
+            return False
+        if not self._check(ref[:1],result[:1]):
+            self.add_error(self._check.errors)
+            return False
+        if not np.array_equal(result[0].tensor,result[1].tensor):
+            nb_errors = np.count_nonzero(result[0].tensor != result[1].tensor)
+            self.add_error(f"Strips different from the full image. Number of different values = {nb_errors}")
+            return False
+        return(True)
+
+# The board returns two tensors which must be identical.
+# Used with NoReference
+class IdenticalResults(Comparison):
+    def __call__(self,ref,result):
+        if len(result) != 2:
+            self.add_error("Wrong number of results")
+            return False
+        if not np.array_equal(result[0].tensor,result[1].tensor):
+            self.add_error(f"Different results {result[0].tensor} and {result[1].tensor}")
+            return False
+        return(True)
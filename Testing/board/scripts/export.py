@@ -58,7 +58,7 @@ def _serialize_f64(file, tensor):
 
 def _serialize_f32(file, tensor):
     """ writes one f32 tensor to file that is open in wb mode """
-    tensor = tensor.astype(float).flatten()
+    tensor = tensor.astype(np.float32).flatten()
     b = struct.pack(f'<{len(tensor)}f', *tensor)
     file.write(b)
     return(len(b))
@@ -262,7 +262,7 @@ class AlgoImage:
                 return AlgoImage.IMG_NUMPY_TYPE_SINT32
             if self._img.dtype == np.float16:
                 return AlgoImage.IMG_NUMPY_TYPE_F16
-            if self._img.dtype == float:
+            if self._img.dtype == np.float32:
                 return AlgoImage.IMG_NUMPY_TYPE_F32
             if self._img.dtype == np.double:
                 return AlgoImage.IMG_NUMPY_TYPE_F64
@@ -316,7 +316,7 @@ class AlgoImage:
 
         if t.dtype == np.float16:
            return _serialize_f16(file,t)
-        if t.dtype == float:
+        if t.dtype == np.float32:
            return _serialize_f32(file,t)
         if t.dtype == np.double:
            return _serialize_f64(file,t)
@@ -341,7 +341,7 @@ def unserialize(file,dt,nbbytes,dims):
     elif dt == AlgoImage.IMG_NUMPY_TYPE_F16:
        res = np.frombuffer(a,dtype=np.float16).reshape(dims)
     elif dt == AlgoImage.IMG_NUMPY_TYPE_F32:
-       res = np.frombuffer(a,dtype=float).reshape(dims)
+       res = np.frombuffer(a,dtype=np.float32).reshape(dims)
     elif dt == AlgoImage.IMG_NUMPY_TYPE_F64:
        res = np.frombuffer(a,dtype=np.double).reshape(dims)
     elif dt == AlgoImage.IMG_RGB_TYPE:
@@ -101,6 +101,65 @@ void aligned_free(void* ptr)
     }
 };
 
+#define CANARY_SIZE 16
+#define CANARY_VALUE 0x5A
+
+/**
+ * @brief      Allocate a buffer followed by canary bytes
+ *
+ * @param[in]  size  The size of the buffer in bytes, without the canary bytes
+ *
+ * @return     The buffer
+ */
+unsigned char* canary_malloc(size_t size)
+{
+    unsigned char *ptr = (unsigned char*)aligned_malloc(size + CANARY_SIZE,BUFFER_ALIGNMENT);
+    memset(ptr + size,CANARY_VALUE,CANARY_SIZE);
+    return(ptr);
+}
+
+/**
+ * @brief      Copy a buffer allocated with canary_malloc and free it
+ *
+ * When a canary byte was overwritten, ~ref is copied instead of
+ * the buffer so that the comparison of dst and ref fails.
+ *
+ * @param      dst   The destination
+ * @param[in]  ref   The expected content of the buffer
+ * @param      ptr   The buffer allocated with canary_malloc
+ * @param[in]  size  The size of the buffer in bytes, without the canary bytes
+ *
+ * @return     1 when the canary bytes are intact
+ */
+int canary_copy_and_free(unsigned char *dst,
+                         const unsigned char *ref,
+                         unsigned char *ptr,
+                         size_t size)
+{
+    int valid = 1;
+    for(size_t i=0;i<CANARY_SIZE;i++)
+    {
+        if (ptr[size + i] != CANARY_VALUE)
+        {
+            valid = 0;
+        }
+    }
+
+    if (valid)
+    {
+        memcpy(dst,ptr,size);
+    }
+    else
+    {
+        for(size_t i=0;i<size;i++)
+        {
+            dst[i] = ~ref[i];
+        }
+    }
+    aligned_free(ptr);
+    return(valid);
+}
+
 
 
 #define SAFE_FREE(x)\
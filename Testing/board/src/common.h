@@ -74,6 +74,15 @@ extern void* aligned_malloc(size_t size,
                             size_t alignment);
 extern void  aligned_free(void* ptr);
 
+// Buffers used to check that a function processing a strip
+// of an image is not writing after the rows of the strip
+extern unsigned char* canary_malloc(size_t size);
+
+extern int canary_copy_and_free(unsigned char *dst,
+                                const unsigned char *ref,
+                                unsigned char *ptr,
+                                size_t size);
+
 
 #ifdef   __cplusplus
 }
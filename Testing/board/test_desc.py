@@ -14,6 +14,17 @@ STANDART_GRAY_SIZES = [(15, 8), (15, 11), (16, 8), (16, 11), (32, 8), (32, 11),
 
 VERTICAL = 0
 HORIZONTAL = 1
+
+# Kernels used to test the separable filter
+# They must be coherent with the ones defined in tests/test_group0.cpp
+SEPARABLE_ROW = [1, 8, 28, 56, 70, 56, 28, 8, 1]
+SEPARABLE_COL = [-1, -2, 4, 12, 18, 12, 4, -2, -1]
+SEPARABLE_SHIFT = 12
+
+# Largest kernel size supported by the separable filter
+SEPARABLE_ROW_15 = [1, 2, 3, 4, 5, 6, 7, 8, 7, 6, 5, 4, 3, 2, 1]
+SEPARABLE_COL_15 = [-1, -1, 0, 1, 2, 3, 4, 5, 4, 3, 2, 1, 0, -1, -1]
+SEPARABLE_SHIFT_15 = 11
 #print(len(STANDARD_IMG_SIZES))
 #print(len(STANDARD_YUV_IMG_SIZES))
 #print(len(STANDARD_GRAY_IMG_SIZES))
@@ -51,7 +62,30 @@ allSuites = [
            [gaussian_test(imgid, imgdim, funcid=14, border_type='wrap', kernel_size = 7, threshold = 1) for imgid,imgdim in enumerate(STANDART_GRAY_SIZES)]+
            [gaussian_test_32(imgid, imgdim, funcid=15 , border_type='nearest', kernel_size = 7, threshold = 0) for imgid,imgdim in enumerate(STANDART_GRAY_SIZES)] +
            [gaussian_test_32(imgid, imgdim, funcid=16, border_type='mirror', kernel_size = 7, threshold = 0) for imgid,imgdim in enumerate(STANDART_GRAY_SIZES)] +
-           [gaussian_test_32(imgid, imgdim, funcid=17, border_type='wrap', kernel_size = 7, threshold = 0) for imgid,imgdim in enumerate(STANDART_GRAY_SIZES)]
+           [gaussian_test_32(imgid, imgdim, funcid=17, border_type='wrap', kernel_size = 7, threshold = 0) for imgid,imgdim in enumerate(STANDART_GRAY_SIZES)]+
+           [separable_filter_test(imgid, imgdim, funcid=18, coefs_row=SEPARABLE_ROW, coefs_col=SEPARABLE_COL, shift=SEPARABLE_SHIFT, border_type='nearest') for imgid,imgdim in enumerate(STANDART_GRAY_SIZES)] +
+           [separable_filter_test(imgid, imgdim, funcid=19, coefs_row=SEPARABLE_ROW, coefs_col=SEPARABLE_COL, shift=SEPARABLE_SHIFT, border_type='mirror') for imgid,imgdim in enumerate(STANDART_GRAY_SIZES)] +
+           [separable_filter_test(imgid, imgdim, funcid=20, coefs_row=SEPARABLE_ROW, coefs_col=SEPARABLE_COL, shift=SEPARABLE_SHIFT, border_type='wrap') for imgid,imgdim in enumerate(STANDART_GRAY_SIZES)] +
+           [gaussian_plan_test(imgid, imgdim, funcid=21, sigma=1.0, kernel_size=5, border_type='mirror') for imgid,imgdim in enumerate(STANDART_GRAY_SIZES)] +
+           [gaussian_plan_test(imgid, imgdim, funcid=22, sigma=2.0, kernel_size=0, border_type='mirror') for imgid,imgdim in enumerate(STANDART_GRAY_SIZES)] +
+           [box_filter_test(imgid, imgdim, funcid=23, radius=1, border_type='nearest') for imgid,imgdim in enumerate(STANDART_GRAY_SIZES)] +
+           [box_filter_test(imgid, imgdim, funcid=24, radius=7, border_type='mirror') for imgid,imgdim in enumerate(STANDART_GRAY_SIZES)] +
+           [box_filter_test(imgid, imgdim, funcid=25, radius=15, border_type='wrap') for imgid,imgdim in enumerate(STANDART_GRAY_SIZES)] +
+           [median_filter_test(imgid, imgdim, funcid=26, kernel_size=3, border_type='nearest') for imgid,imgdim in enumerate(STANDART_GRAY_SIZES)] +
+           [median_filter_test(imgid, imgdim, funcid=27, kernel_size=3, border_type='mirror') for imgid,imgdim in enumerate(STANDART_GRAY_SIZES)] +
+           [median_filter_test(imgid, imgdim, funcid=28, kernel_size=3, border_type='wrap') for imgid,imgdim in enumerate(STANDART_GRAY_SIZES)] +
+           [median_filter_test(imgid, imgdim, funcid=29, kernel_size=5, border_type='nearest') for imgid,imgdim in enumerate(STANDART_GRAY_SIZES)] +
+           [median_filter_test(imgid, imgdim, funcid=30, kernel_size=5, border_type='mirror') for imgid,imgdim in enumerate(STANDART_GRAY_SIZES)] +
+           [median_filter_test(imgid, imgdim, funcid=31, kernel_size=5, border_type='wrap') for imgid,imgdim in enumerate(STANDART_GRAY_SIZES)] +
+           [gaussian_test(imgid, imgdim, funcid=32, border_type='nearest', strip=True) for imgid,imgdim in enumerate(STANDART_GRAY_SIZES)] +
+           [gaussian_test(imgid, imgdim, funcid=33, border_type='mirror', kernel_size = 7, threshold = 1, strip=True) for imgid,imgdim in enumerate(STANDART_GRAY_SIZES)] +
+           [gaussian_test(imgid, imgdim, funcid=34, border_type='mirror', stride=True) for imgid,imgdim in enumerate(STANDART_GRAY_SIZES)] +
+           [gaussian_test(imgid, imgdim, funcid=35, border_type='nearest', kernel_size = 5, strip=True) for imgid,imgdim in enumerate(STANDART_GRAY_SIZES)] +
+           [gaussian_test_32(imgid, imgdim, funcid=36, border_type='mirror', kernel_size = 7, threshold = 0, strip=True) for imgid,imgdim in enumerate(STANDART_GRAY_SIZES)] +
+           [sobel_test(imgid, imgdim, funcid=37, axis=VERTICAL, border_type='mirror', strip=True) for imgid,imgdim in enumerate(STANDART_GRAY_SIZES)] +
+           [sobel_test(imgid, imgdim, funcid=38, axis=HORIZONTAL, border_type='nearest', strip=True) for imgid,imgdim in enumerate(STANDART_GRAY_SIZES)] +
+           [scratch_planner_test(imgid, imgdim, funcid=39) for imgid,imgdim in enumerate(STANDART_GRAY_SIZES)] +
+           [separable_filter_test(imgid, imgdim, funcid=40, coefs_row=SEPARABLE_ROW_15, coefs_col=SEPARABLE_COL_15, shift=SEPARABLE_SHIFT_15, border_type='mirror') for imgid,imgdim in enumerate(STANDART_GRAY_SIZES)]
     },
     {
         "name" : "Color conversions",
@@ -75,7 +109,10 @@ allSuites = [
            [gray8_to_rgb_test(imgid+len(STANDARD_YUV_IMG_SIZES)+len(STANDARD_RGB_IMG_SIZES),imgdim,funcid=2) for imgid,imgdim in enumerate(STANDARD_GRAY_IMG_SIZES)] +
            [bgr_8U3C_to_rgb_test(imgid+len(STANDARD_YUV_IMG_SIZES),imgdim,funcid=3) for imgid,imgdim in enumerate(STANDARD_RGB_IMG_SIZES)]+
            [yuv420_to_rgb_test(imgid,imgdim,funcid=4) for imgid,imgdim in enumerate(STANDARD_YUV_IMG_SIZES)] +
-           [rgb_to_gray_test(imgid+len(STANDARD_YUV_IMG_SIZES)+len(STANDARD_RGB_IMG_SIZES)+len(STANDARD_GRAY_IMG_SIZES),imgdim,funcid=5) for imgid,imgdim in enumerate(STANDARD_RGB_IMG_SIZES)]
+           [rgb_to_gray_test(imgid+len(STANDARD_YUV_IMG_SIZES)+len(STANDARD_RGB_IMG_SIZES)+len(STANDARD_GRAY_IMG_SIZES),imgdim,funcid=5) for imgid,imgdim in enumerate(STANDARD_RGB_IMG_SIZES)]+
+           [bgr_8U3C_gray8_test(imgid+len(STANDARD_YUV_IMG_SIZES),imgdim,funcid=6,strip=True) for imgid,imgdim in enumerate(STANDARD_RGB_IMG_SIZES)]+
+           [bgr_8U3C_to_rgb_test(imgid+len(STANDARD_YUV_IMG_SIZES),imgdim,funcid=7,strip=True) for imgid,imgdim in enumerate(STANDARD_RGB_IMG_SIZES)]+
+           [yuv420_to_rgb_test(imgid,imgdim,funcid=8,strip=True) for imgid,imgdim in enumerate(STANDARD_YUV_IMG_SIZES)]
            )
            
     },
@@ -90,6 +127,12 @@ allSuites = [
                    path="Patterns/JellyBeans.tiff"),
                    ImageGen([(128,128)],
                    format=Format.BGR8U3C,
+                   path="Patterns/JellyBeans.tiff"),
+                   ImageGen([(128,128)],
+                   format=Format.YUV420,
+                   path="Patterns/JellyBeans.tiff"),
+                   ImageGen([(128,128)],
+                   format=Format.YUYV,
                    path="Patterns/JellyBeans.tiff")
         ],
         "tests":
@@ -123,6 +166,72 @@ allSuites = [
            bgr8U3C_resize_to_rgb_test((128,128),27,47,17),
            bgr8U3C_resize_to_rgb_test((128,128),28,150,150),
            bgr8U3C_resize_to_rgb_test((128,128),29,256,256),
+           gray8_integral_test((128,128),30),
+           gray8_crop_test((128,128),31,16,60,112,68,view=True),
+           rgb_crop_test  ((128,128),32,15,15,113,113,view=True),
+           gray8_resize_fixp_test((128,128),33,64,64),
+           gray8_resize_fixp_test((128,128),34,47,17),
+           gray8_resize_fixp_test((128,128),35,150,150),
+           bgr8U3C_resize_fixp_test((128,128),36,64,64),
+           bgr8U3C_resize_fixp_test((128,128),37,47,17),
+           bgr8U3C_resize_fixp_test((128,128),38,150,150),
+           rgb_resize_fixp_test((128,128),39,64,64),
+           rgb_resize_fixp_test((128,128),40,47,17),
+           rgb_resize_fixp_test((128,128),41,150,150),
+           gray8_resize_fixp_test((128,128),42,47,17,plan=True),
+           bgr8U3C_resize_fixp_test((128,128),43,47,17,plan=True),
+           rgb_resize_fixp_test((128,128),44,47,17,plan=True),
+           gray8_resize_area_test((128,128),45,64,64),
+           gray8_resize_area_test((128,128),46,32,16),
+           gray8_resize_area_test((128,128),47,47,17),
+           bgr8U3C_resize_area_test((128,128),48,64,64),
+           bgr8U3C_resize_area_test((128,128),49,47,17),
+           rgb_resize_area_test((128,128),50,32,32),
+           rgb_resize_area_test((128,128),51,47,17),
+           gray8_resize_nearest_test((128,128),52,47,17),
+           gray8_resize_nearest_test((128,128),53,150,150),
+           bgr8U3C_resize_nearest_test((128,128),54,47,17),
+           bgr8U3C_resize_nearest_test((128,128),55,150,150),
+           rgb_resize_nearest_test((128,128),56,47,17),
+           rgb_resize_nearest_test((128,128),57,150,150),
+           yuv420_resize_to_rgb_fixp_test((128,128),58,64,64),
+           yuv420_resize_to_rgb_fixp_test((128,128),59,47,17),
+           yuv420_resize_to_rgb_fixp_test((128,128),60,150,150),
+           rgb_to_tensor_test((128,128),61,np.int8,"NHWC",TENSOR_NORM_IMAGENET),
+           bgr8U3C_to_tensor_test((128,128),62,np.int8,"NCHW",TENSOR_NORM_IMAGENET),
+           gray8_to_tensor_test((128,128),63,np.uint8,"NHWC",TENSOR_NORM_UNIT),
+           rgb_to_tensor_test((128,128),64,np.float32,"NCHW",TENSOR_NORM_IMAGENET),
+           bgr8U3C_to_tensor_test((128,128),65,np.uint8,"NHWC",TENSOR_NORM_UNIT),
+           nv12_gray8_test((128,128),66,"NV12"),
+           nv12_to_rgb_test((128,128),67,"NV12"),
+           nv12_to_rgb_test((128,128),68,"NV21"),
+           nv12_resize_to_rgb_fixp_test((128,128),69,"NV12",47,17),
+           nv12_resize_to_rgb_fixp_test((128,128),70,"NV21",150,150),
+           yuv422_gray8_test((128,128),71,"YUYV"),
+           yuv422_gray8_test((128,128),72,"UYVY"),
+           yuv422_to_rgb_test((128,128),73,"YUYV"),
+           yuv422_to_rgb_test((128,128),74,"UYVY"),
+           yuv422_to_tensor_test((128,128),75,"YUYV",np.int8,"NHWC",TENSOR_NORM_IMAGENET),
+           yuv422_to_tensor_test((128,128),76,"UYVY",np.float32,"NCHW",TENSOR_NORM_IMAGENET),
+           gray8_to_rgb565_test((128,128),77),
+           rgb_to_rgb565_test((128,128),78),
+           rgb565_to_rgb_test((128,128),79),
+           rgb565_to_gray8_test((128,128),80),
+           gray8_resize_area_test((128,128),81,3,5),
+           rgb_resize_area_test((128,128),82,5,3),
+           gray8_integral_test((128,128),83,width=127),
+           gray8_integral_squared_test((128,128),84),
+           gray8_integral_squared_test((128,128),85,width=127),
+           view_test(yuv422_gray8_test((128,128),86,"YUYV"),94,30),
+           view_test(yuv422_gray8_test((128,128),87,"UYVY"),94,30),
+           view_test(yuv422_to_rgb_test((128,128),88,"YUYV"),94,30),
+           view_test(yuv422_to_rgb_test((128,128),89,"UYVY"),94,30),
+           view_test(yuv422_to_tensor_test((128,128),90,"YUYV",np.int8,"NHWC",TENSOR_NORM_IMAGENET),94,30),
+           view_test(yuv422_to_tensor_test((128,128),91,"UYVY",np.float32,"NCHW",TENSOR_NORM_IMAGENET),94,30),
+           view_test(gray8_to_rgb565_test((128,128),92),94,30),
+           view_test(rgb_to_rgb565_test((128,128),93),94,30),
+           view_test(rgb565_to_rgb_test((128,128),94),94,30),
+           view_test(rgb565_to_gray8_test((128,128),95),94,30),
           ]
         
     },
@@ -194,7 +303,19 @@ allSuites = [
            [canny_sobel_test_autoref(imgid+5+7*len(STANDARD_IMG_SIZES), imgdim) for imgid,imgdim in enumerate(STANDARD_IMG_SIZES)]+
            [canny_sobel_test_autoref(imgid+5+8*len(STANDARD_IMG_SIZES), imgdim) for imgid,imgdim in enumerate(STANDARD_IMG_SIZES)]+
            [canny_sobel_test_autoref(imgid+5+9*len(STANDARD_IMG_SIZES), imgdim) for imgid,imgdim in enumerate(STANDARD_IMG_SIZES)]+
-           [canny_sobel_test_autoref(imgid+5+10*len(STANDARD_IMG_SIZES), imgdim) for imgid,imgdim in enumerate(STANDARD_IMG_SIZES)]
+           [canny_sobel_test_autoref(imgid+5+10*len(STANDARD_IMG_SIZES), imgdim) for imgid,imgdim in enumerate(STANDARD_IMG_SIZES)]+
+           [canny_gaussian_sobel_test(imgid, imgdim, funcid=2, border_type='nearest') for imgid,imgdim in enumerate(STANDARD_IMG_SIZES)]+
+           [canny_gaussian_sobel_test(imgid, imgdim, funcid=3, border_type='mirror') for imgid,imgdim in enumerate(STANDARD_IMG_SIZES)]+
+           [canny_gaussian_sobel_test(imgid, imgdim, funcid=4, border_type='wrap') for imgid,imgdim in enumerate(STANDARD_IMG_SIZES)]+
+           [canny_gaussian_sobel_test(imgid, imgdim, funcid=5, border_type='wrap', octant=True, l1=True) for imgid,imgdim in enumerate(STANDARD_IMG_SIZES)]+
+           [canny_sobel_flags_test(imgid, imgdim, funcid=6, octant=True, l1=True) for imgid,imgdim in enumerate(STANDARD_IMG_SIZES)]+
+           [canny_gaussian_sobel_test(imgid, imgdim, funcid=7, border_type='nearest', octant=True, l1=True) for imgid,imgdim in enumerate(STANDARD_IMG_SIZES)]+
+           [canny_gaussian_sobel_test(imgid, imgdim, funcid=8, border_type='mirror', octant=True, l1=True) for imgid,imgdim in enumerate(STANDARD_IMG_SIZES)]+
+           [canny_gaussian_sobel_test(imgid, imgdim, funcid=9, border_type='nearest', octant=True, l1=True, hysteresis=True) for imgid,imgdim in enumerate(STANDARD_IMG_SIZES)]+
+           [canny_sobel_flags_test(imgid, imgdim, funcid=10, octant=True, l1=True, hysteresis=True) for imgid,imgdim in enumerate(STANDARD_IMG_SIZES)]+
+           [canny_gaussian_sobel_test(imgid, imgdim, funcid=11, border_type='nearest', octant=True, l1=True, hysteresis=True) for imgid,imgdim in enumerate(STANDARD_IMG_SIZES)]+
+           [canny_gaussian_sobel_test(imgid, imgdim, funcid=12, border_type='mirror', octant=True, l1=True, strip=True) for imgid,imgdim in enumerate(STANDARD_IMG_SIZES)]+
+           [canny_sobel_flags_test(imgid, imgdim, funcid=13, octant=True, l1=True, strip=True) for imgid,imgdim in enumerate(STANDARD_IMG_SIZES)]
     },
 ]
 
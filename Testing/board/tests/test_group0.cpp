@@ -2,10 +2,15 @@
 #include "load.hpp"
 #include "test_config.h"
 #include <vector>
+#include <string.h>
 
 extern "C"
 {
 #include "cv/linear_filters.h"
+#include "cv/scratch_planner.h"
+#include "cv/strip.h"
+#include "cv/feature_detection.h"
+#include "cv/image_transforms.h"
 }
 
 #if defined(TESTGROUP0)
@@ -24,8 +29,8 @@ void test_gauss(const unsigned char *inputs, unsigned char *&outputs, uint32_t &
     const uint8_t *src = Buffer<uint8_t>::read(inputs, bufid);
     uint8_t *dst = Buffer<uint8_t>::write(outputs, 0);
 
-    const arm_cv_image_gray8_t input = {(uint16_t)width, (uint16_t)height, (uint8_t *)src};
-    arm_cv_image_gray8_t output = {(uint16_t)width, (uint16_t)height, (uint8_t *)dst};
+    const arm_cv_image_gray8_t input = ARM_CV_IMAGE_INIT(width, height, (uint8_t *)src);
+    arm_cv_image_gray8_t output = ARM_CV_IMAGE_INIT(width, height, (uint8_t *)dst);
 
     // The test to run is executed with some timing code.
     start = time_in_cycles();
@@ -49,8 +54,8 @@ void test_gauss_5(const unsigned char *inputs, unsigned char *&outputs, uint32_t
     const uint8_t *src = Buffer<uint8_t>::read(inputs, bufid);
     uint8_t *dst = Buffer<uint8_t>::write(outputs, 0);
 
-    const arm_cv_image_gray8_t input = {(uint16_t)width, (uint16_t)height, (uint8_t *)src};
-    arm_cv_image_gray8_t output = {(uint16_t)width, (uint16_t)height, (uint8_t *)dst};
+    const arm_cv_image_gray8_t input = ARM_CV_IMAGE_INIT(width, height, (uint8_t *)src);
+    arm_cv_image_gray8_t output = ARM_CV_IMAGE_INIT(width, height, (uint8_t *)dst);
 
     // The test to run is executed with some timing code.
     start = time_in_cycles();
@@ -74,8 +79,8 @@ void test_gauss_7(const unsigned char *inputs, unsigned char *&outputs, uint32_t
     const uint8_t *src = Buffer<uint8_t>::read(inputs, bufid);
     uint8_t *dst = Buffer<uint8_t>::write(outputs, 0);
 
-    const arm_cv_image_gray8_t input = {(uint16_t)width, (uint16_t)height, (uint8_t *)src};
-    arm_cv_image_gray8_t output = {(uint16_t)width, (uint16_t)height, (uint8_t *)dst};
+    const arm_cv_image_gray8_t input = ARM_CV_IMAGE_INIT(width, height, (uint8_t *)src);
+    arm_cv_image_gray8_t output = ARM_CV_IMAGE_INIT(width, height, (uint8_t *)dst);
 
     // The test to run is executed with some timing code.
     start = time_in_cycles();
@@ -99,8 +104,8 @@ void test_gauss_7_31(const unsigned char *inputs, unsigned char *&outputs, uint3
     const uint8_t *src = Buffer<uint8_t>::read(inputs, bufid);
     uint8_t *dst = Buffer<uint8_t>::write(outputs, 0);
 
-    const arm_cv_image_gray8_t input = {(uint16_t)width, (uint16_t)height, (uint8_t *)src};
-    arm_cv_image_gray8_t output = {(uint16_t)width, (uint16_t)height, (uint8_t *)dst};
+    const arm_cv_image_gray8_t input = ARM_CV_IMAGE_INIT(width, height, (uint8_t *)src);
+    arm_cv_image_gray8_t output = ARM_CV_IMAGE_INIT(width, height, (uint8_t *)dst);
 
     // The test to run is executed with some timing code.
     start = time_in_cycles();
@@ -126,11 +131,8 @@ void test_sobel(const unsigned char *inputs, unsigned char *&outputs, uint32_t &
     const uint8_t *src = Buffer<uint8_t>::read(inputs, bufid);
     int16_t *dst = Buffer<int16_t>::write(outputs, 0);
 
-    const arm_cv_image_gray8_t input = {(uint16_t)width, (uint16_t)height, (uint8_t *)src};
-    arm_cv_image_q15_t output;
-    output.width = width;
-    output.height = height;
-    output.pData = dst;
+    const arm_cv_image_gray8_t input = ARM_CV_IMAGE_INIT(width, height, (uint8_t *)src);
+    arm_cv_image_q15_t output = ARM_CV_IMAGE_INIT(width, height, dst);
 
     // The test to run is executed with some timing code.
     start = time_in_cycles();
@@ -147,6 +149,387 @@ void test_sobel(const unsigned char *inputs, unsigned char *&outputs, uint32_t &
     free(Buffer_tmp);
 }
 
+// Kernels used to test the separable filter
+// They must be coherent with the ones defined in test_desc.py
+static const q15_t separable_row[9] = {1, 8, 28, 56, 70, 56, 28, 8, 1};
+static const q15_t separable_col[9] = {-1, -2, 4, 12, 18, 12, 4, -2, -1};
+#define SEPARABLE_SHIFT 12
+
+// Largest kernel size supported by the separable filter
+static const q15_t separable_row_15[15] = {1, 2, 3, 4, 5, 6, 7, 8, 7, 6, 5, 4, 3, 2, 1};
+static const q15_t separable_col_15[15] = {-1, -1, 0, 1, 2, 3, 4, 5, 4, 3, 2, 1, 0, -1, -1};
+#define SEPARABLE_SHIFT_15 11
+
+void test_separable(const unsigned char *inputs, unsigned char *&outputs, uint32_t &total_bytes, uint32_t test_id,
+                    long &cycles, const q15_t *coefs_row, const q15_t *coefs_col, uint8_t kernel_size,
+                    uint8_t shift, int8_t border_type, int8_t funcid)
+{
+    long start, end;
+    uint32_t width, height;
+    int bufid = TENSOR_START + test_id - funcid * (STANDART_NB_GRAY_SIZES);
+    get_img_dims(inputs, bufid, &width, &height);
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(height, width), kIMG_GRAY8_TYPE)};
+
+    outputs = create_write_buffer(desc, total_bytes);
+    q31_t *Buffer_tmp = (q31_t *)malloc(arm_get_scratch_size_separable_filter(width, kernel_size));
+    const uint8_t *src = Buffer<uint8_t>::read(inputs, bufid);
+    uint8_t *dst = Buffer<uint8_t>::write(outputs, 0);
+
+    const arm_cv_image_gray8_t input = ARM_CV_IMAGE_INIT(width, height, (uint8_t *)src);
+    arm_cv_image_gray8_t output = ARM_CV_IMAGE_INIT(width, height, (uint8_t *)dst);
+
+    // The test to run is executed with some timing code.
+    start = time_in_cycles();
+    arm_separable_filter_u8(&input, &output, Buffer_tmp, coefs_row, coefs_col, kernel_size, shift, border_type);
+    end = time_in_cycles();
+    cycles = end - start;
+    free(Buffer_tmp);
+}
+
+void test_gauss_plan(const unsigned char *inputs, unsigned char *&outputs, uint32_t &total_bytes, uint32_t test_id,
+                     long &cycles, float32_t sigma, uint8_t kernel_size, int8_t border_type, int8_t funcid)
+{
+    long start, end;
+    uint32_t width, height;
+    int bufid = TENSOR_START + test_id - funcid * (STANDART_NB_GRAY_SIZES);
+    get_img_dims(inputs, bufid, &width, &height);
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(height, width), kIMG_GRAY8_TYPE)};
+
+    outputs = create_write_buffer(desc, total_bytes);
+    arm_cv_gaussian_plan_t plan;
+    arm_gaussian_plan_init(&plan, sigma, kernel_size);
+    q31_t *Buffer_tmp = (q31_t *)malloc(arm_get_scratch_size_gaussian_plan(&plan, width));
+    const uint8_t *src = Buffer<uint8_t>::read(inputs, bufid);
+    uint8_t *dst = Buffer<uint8_t>::write(outputs, 0);
+
+    const arm_cv_image_gray8_t input = ARM_CV_IMAGE_INIT(width, height, (uint8_t *)src);
+    arm_cv_image_gray8_t output = ARM_CV_IMAGE_INIT(width, height, (uint8_t *)dst);
+
+    // The plan is computed once and is not part of the timing
+    start = time_in_cycles();
+    arm_gaussian_filter_plan(&plan, &input, &output, Buffer_tmp, border_type);
+    end = time_in_cycles();
+    cycles = end - start;
+    free(Buffer_tmp);
+}
+
+void test_box(const unsigned char *inputs, unsigned char *&outputs, uint32_t &total_bytes, uint32_t test_id,
+              long &cycles, uint8_t radius, int8_t border_type, int8_t funcid)
+{
+    long start, end;
+    uint32_t width, height;
+    int bufid = TENSOR_START + test_id - funcid * (STANDART_NB_GRAY_SIZES);
+    get_img_dims(inputs, bufid, &width, &height);
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(height, width), kIMG_GRAY8_TYPE)};
+
+    outputs = create_write_buffer(desc, total_bytes);
+    q15_t *Buffer_tmp = (q15_t *)malloc(arm_get_scratch_size_box_filter(width, radius));
+    const uint8_t *src = Buffer<uint8_t>::read(inputs, bufid);
+    uint8_t *dst = Buffer<uint8_t>::write(outputs, 0);
+
+    const arm_cv_image_gray8_t input = ARM_CV_IMAGE_INIT(width, height, (uint8_t *)src);
+    arm_cv_image_gray8_t output = ARM_CV_IMAGE_INIT(width, height, (uint8_t *)dst);
+
+    // The test to run is executed with some timing code.
+    start = time_in_cycles();
+    arm_box_filter_u8(&input, &output, Buffer_tmp, radius, border_type);
+    end = time_in_cycles();
+    cycles = end - start;
+    free(Buffer_tmp);
+}
+
+// The image is processed by strips of 16 rows. The first output is the image processed
+// in one call and the second one the image processed by strips. Each strip is written
+// in its own buffer followed by canary bytes to detect the writes after the strip
+// With a kernel size of 7, buffer_31 selects arm_gaussian_filter_7x7_buffer_31_fixp
+void test_gauss_strip(const unsigned char *inputs, unsigned char *&outputs, uint32_t &total_bytes, uint32_t test_id,
+                      long &cycles, int8_t kernel_size, bool buffer_31, int8_t border_type, int8_t funcid)
+{
+    long start, end;
+    uint32_t width, height;
+    const uint16_t strip_height = 16;
+    const uint16_t radius = kernel_size >> 1;
+    int bufid = TENSOR_START + test_id - funcid * (STANDART_NB_GRAY_SIZES);
+    get_img_dims(inputs, bufid, &width, &height);
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(height, width), kIMG_GRAY8_TYPE),
+                                           BufferDescription(Shape(height, width), kIMG_GRAY8_TYPE)};
+
+    outputs = create_write_buffer(desc, total_bytes);
+    void *Buffer_tmp;
+    if (buffer_31)
+    {
+        Buffer_tmp = malloc(arm_get_linear_scratch_size_buffer_31(width));
+    }
+    else
+    {
+        Buffer_tmp = malloc(arm_get_linear_scratch_size_buffer_15(width));
+    }
+    const uint8_t *src = Buffer<uint8_t>::read(inputs, bufid);
+    uint8_t *dst = Buffer<uint8_t>::write(outputs, 0);
+    uint8_t *dst_strip = Buffer<uint8_t>::write(outputs, 1);
+
+    const arm_cv_image_gray8_t input = ARM_CV_IMAGE_INIT(width, height, (uint8_t *)src);
+    arm_cv_image_gray8_t output = ARM_CV_IMAGE_INIT(width, height, (uint8_t *)dst);
+    if (kernel_size == 3)
+    {
+        arm_gaussian_filter_3x3_fixp(&input, &output, (q15_t *)Buffer_tmp, border_type);
+    }
+    else if (kernel_size == 5)
+    {
+        arm_gaussian_filter_5x5_fixp(&input, &output, (q15_t *)Buffer_tmp, border_type);
+    }
+    else if (buffer_31)
+    {
+        arm_gaussian_filter_7x7_buffer_31_fixp(&input, &output, (q31_t *)Buffer_tmp, border_type);
+    }
+    else
+    {
+        arm_gaussian_filter_7x7_buffer_15_fixp(&input, &output, (q15_t *)Buffer_tmp, border_type);
+    }
+
+    // Only the processing of the strips is timed
+    cycles = 0;
+    for (uint32_t row = 0; row < height; row += strip_height)
+    {
+        arm_cv_strip_t strip = {(uint16_t)height, (uint16_t)row};
+        uint16_t nb_rows = (row + strip_height > height) ? height - row : strip_height;
+        uint16_t first_input_row = arm_cv_get_strip_first_input_row(&strip, radius);
+        uint16_t nb_input_rows = arm_cv_get_strip_nb_input_rows(&strip, nb_rows, radius);
+        uint8_t *buf = canary_malloc(nb_rows * width);
+
+        const arm_cv_image_gray8_t strip_input = ARM_CV_IMAGE_INIT(width, nb_input_rows,
+                                                                   (uint8_t *)&src[first_input_row * width]);
+        arm_cv_image_gray8_t strip_output = ARM_CV_IMAGE_INIT(width, nb_rows, buf);
+
+        start = time_in_cycles();
+        if (kernel_size == 3)
+        {
+            arm_gaussian_filter_3x3_fixp_strip(&strip_input, &strip_output, &strip, (q15_t *)Buffer_tmp, border_type);
+        }
+        else if (kernel_size == 5)
+        {
+            arm_gaussian_filter_5x5_fixp_strip(&strip_input, &strip_output, &strip, (q15_t *)Buffer_tmp, border_type);
+        }
+        else if (buffer_31)
+        {
+            arm_gaussian_filter_7x7_buffer_31_fixp_strip(&strip_input, &strip_output, &strip, (q31_t *)Buffer_tmp,
+                                                         border_type);
+        }
+        else
+        {
+            arm_gaussian_filter_7x7_buffer_15_fixp_strip(&strip_input, &strip_output, &strip, (q15_t *)Buffer_tmp,
+                                                         border_type);
+        }
+        end = time_in_cycles();
+        cycles += end - start;
+
+        canary_copy_and_free(&dst_strip[row * width], &dst[row * width], buf, nb_rows * width);
+    }
+    free(Buffer_tmp);
+}
+
+// Same as test_gauss_strip for the sobel filters, the output rows are q15
+void test_sobel_strip(const unsigned char *inputs, unsigned char *&outputs, uint32_t &total_bytes, uint32_t test_id,
+                      long &cycles, int8_t border_type, int8_t axis, int funcid)
+{
+    long start, end;
+    uint32_t width, height;
+    const uint16_t strip_height = 16;
+    int bufid = TENSOR_START + test_id - funcid * (STANDART_NB_GRAY_SIZES);
+    get_img_dims(inputs, bufid, &width, &height);
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(height, width), kIMG_NUMPY_TYPE_SINT16),
+                                           BufferDescription(Shape(height, width), kIMG_NUMPY_TYPE_SINT16)};
+
+    outputs = create_write_buffer(desc, total_bytes);
+    q15_t *Buffer_tmp = (q15_t *)malloc(arm_get_scratch_size_sobel(width));
+    const uint8_t *src = Buffer<uint8_t>::read(inputs, bufid);
+    int16_t *dst = Buffer<int16_t>::write(outputs, 0);
+    int16_t *dst_strip = Buffer<int16_t>::write(outputs, 1);
+
+    const arm_cv_image_gray8_t input = ARM_CV_IMAGE_INIT(width, height, (uint8_t *)src);
+    arm_cv_image_q15_t output = ARM_CV_IMAGE_INIT(width, height, dst);
+    if (axis == 0)
+    {
+        arm_sobel_vertical(&input, &output, Buffer_tmp, border_type);
+    }
+    else
+    {
+        arm_sobel_horizontal(&input, &output, Buffer_tmp, border_type);
+    }
+
+    // Only the processing of the strips is timed
+    cycles = 0;
+    for (uint32_t row = 0; row < height; row += strip_height)
+    {
+        arm_cv_strip_t strip = {(uint16_t)height, (uint16_t)row};
+        uint16_t nb_rows = (row + strip_height > height) ? height - row : strip_height;
+        uint16_t first_input_row = arm_cv_get_strip_first_input_row(&strip, ARM_CV_STRIP_RADIUS_3x3);
+        uint32_t strip_bytes = nb_rows * width * sizeof(int16_t);
+        uint16_t nb_input_rows = arm_cv_get_strip_nb_input_rows(&strip, nb_rows, ARM_CV_STRIP_RADIUS_3x3);
+        uint8_t *buf = canary_malloc(strip_bytes);
+
+        const arm_cv_image_gray8_t strip_input = ARM_CV_IMAGE_INIT(width, nb_input_rows,
+                                                                   (uint8_t *)&src[first_input_row * width]);
+        arm_cv_image_q15_t strip_output = ARM_CV_IMAGE_INIT(width, nb_rows, (q15_t *)buf);
+
+        start = time_in_cycles();
+        if (axis == 0)
+        {
+            arm_sobel_vertical_strip(&strip_input, &strip_output, &strip, Buffer_tmp, border_type);
+        }
+        else
+        {
+            arm_sobel_horizontal_strip(&strip_input, &strip_output, &strip, Buffer_tmp, border_type);
+        }
+        end = time_in_cycles();
+        cycles += end - start;
+
+        canary_copy_and_free((uint8_t *)&dst_strip[row * width], (const uint8_t *)&dst[row * width], buf,
+                             strip_bytes);
+    }
+    free(Buffer_tmp);
+}
+
+// The input and output images are views in larger buffers with padding at the end of the rows
+void test_gauss_stride(const unsigned char *inputs, unsigned char *&outputs, uint32_t &total_bytes, uint32_t test_id,
+                       long &cycles, int8_t border_type, int8_t funcid)
+{
+    long start, end;
+    uint32_t width, height;
+    const uint32_t padding = 7;
+    int bufid = TENSOR_START + test_id - funcid * (STANDART_NB_GRAY_SIZES);
+    get_img_dims(inputs, bufid, &width, &height);
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(height, width), kIMG_GRAY8_TYPE)};
+
+    outputs = create_write_buffer(desc, total_bytes);
+    q15_t *Buffer_tmp = (q15_t *)malloc(arm_get_linear_scratch_size_buffer_15(width));
+    const uint8_t *src = Buffer<uint8_t>::read(inputs, bufid);
+    uint8_t *dst = Buffer<uint8_t>::write(outputs, 0);
+    const uint32_t stride = width + padding;
+    uint8_t *src_strided = (uint8_t *)malloc(stride * height);
+    uint8_t *dst_strided = (uint8_t *)malloc(stride * height);
+    for (uint32_t row = 0; row < height; row++)
+    {
+        memcpy(&src_strided[row * stride], &src[row * width], width);
+    }
+
+    const arm_cv_image_gray8_t input = {(uint16_t)width, (uint16_t)height, src_strided, stride};
+    arm_cv_image_gray8_t output = {(uint16_t)width, (uint16_t)height, dst_strided, stride};
+
+    // The test to run is executed with some timing code.
+    start = time_in_cycles();
+    arm_gaussian_filter_3x3_fixp(&input, &output, Buffer_tmp, border_type);
+    end = time_in_cycles();
+    cycles = end - start;
+    for (uint32_t row = 0; row < height; row++)
+    {
+        memcpy(&dst[row * width], &dst_strided[row * stride], width);
+    }
+    free(src_strided);
+    free(dst_strided);
+    free(Buffer_tmp);
+}
+
+void test_median(const unsigned char *inputs, unsigned char *&outputs, uint32_t &total_bytes, uint32_t test_id,
+                 long &cycles, uint8_t kernel_size, int8_t border_type, int8_t funcid)
+{
+    long start, end;
+    uint32_t width, height;
+    int bufid = TENSOR_START + test_id - funcid * (STANDART_NB_GRAY_SIZES);
+    get_img_dims(inputs, bufid, &width, &height);
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(height, width), kIMG_GRAY8_TYPE)};
+
+    outputs = create_write_buffer(desc, total_bytes);
+    const uint8_t *src = Buffer<uint8_t>::read(inputs, bufid);
+    uint8_t *dst = Buffer<uint8_t>::write(outputs, 0);
+
+    const arm_cv_image_gray8_t input = ARM_CV_IMAGE_INIT(width, height, (uint8_t *)src);
+    arm_cv_image_gray8_t output = ARM_CV_IMAGE_INIT(width, height, (uint8_t *)dst);
+
+    // The test to run is executed with some timing code.
+    start = time_in_cycles();
+    if (kernel_size == 3)
+    {
+        arm_median_filter_3x3(&input, &output, border_type);
+    }
+    else
+    {
+        arm_median_filter_5x5(&input, &output, border_type);
+    }
+    end = time_in_cycles();
+    cycles = end - start;
+}
+
+// Number of sizes checked by test_scratch_planner
+#define SCRATCH_PLANNER_NB_SIZES 12
+
+// The first output contains the scratch sizes returned by the scratch planner for the width of the image
+// and the second one the sizes returned by the scratch size functions of the kernels.
+// The two last sizes are the ones of known pipelines and are checked against hard-coded values
+void test_scratch_planner(const unsigned char *inputs, unsigned char *&outputs, uint32_t &total_bytes,
+                          uint32_t test_id, long &cycles, int8_t funcid)
+{
+    long start, end;
+    uint32_t width, height;
+    int bufid = TENSOR_START + test_id - funcid * (STANDART_NB_GRAY_SIZES);
+    get_img_dims(inputs, bufid, &width, &height);
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(SCRATCH_PLANNER_NB_SIZES), kIMG_NUMPY_TYPE_UINT32),
+                                           BufferDescription(Shape(SCRATCH_PLANNER_NB_SIZES), kIMG_NUMPY_TYPE_UINT32)};
+
+    outputs = create_write_buffer(desc, total_bytes);
+    uint32_t *dst = Buffer<uint32_t>::write(outputs, 0);
+    uint32_t *ref = Buffer<uint32_t>::write(outputs, 1);
+
+    arm_cv_gaussian_plan_t plan;
+    arm_gaussian_plan_init(&plan, 2.0f, 0);
+    const arm_cv_scratch_kernel_t kernels[] = {
+        {ARM_CV_SCRATCH_LINEAR_BUFFER_15, 0, (uint16_t)width, NULL},
+        {ARM_CV_SCRATCH_LINEAR_BUFFER_31, 0, (uint16_t)width, NULL},
+        {ARM_CV_SCRATCH_SOBEL, 0, (uint16_t)width, NULL},
+        {ARM_CV_SCRATCH_SEPARABLE_FILTER, 9, (uint16_t)width, NULL},
+        {ARM_CV_SCRATCH_GAUSSIAN_PLAN, 0, (uint16_t)width, &plan},
+        {ARM_CV_SCRATCH_BOX_FILTER, 7, (uint16_t)width, NULL},
+        {ARM_CV_SCRATCH_CANNY_SOBEL, 0, (uint16_t)width, NULL},
+        {ARM_CV_SCRATCH_CANNY_GAUSSIAN_SOBEL, 0, (uint16_t)width, NULL},
+        {ARM_CV_SCRATCH_RESIZE_FIXP, 3, (uint16_t)width, NULL},
+        // Unknown kernel
+        {0, 0, (uint16_t)width, NULL}};
+    const uint32_t nb_kernels = sizeof(kernels) / sizeof(arm_cv_scratch_kernel_t);
+    // Resize of a RGB24 image to VGA, gaussian with sigma 2 (13 taps and a q31 buffer) and canny edge
+    const arm_cv_scratch_kernel_t pipeline_vga[] = {{ARM_CV_SCRATCH_RESIZE_FIXP, 3, 640, NULL},
+                                                    {ARM_CV_SCRATCH_GAUSSIAN_PLAN, 0, 640, &plan},
+                                                    {ARM_CV_SCRATCH_CANNY_GAUSSIAN_SOBEL, 0, 640, NULL}};
+    // Gaussian 5x5 followed by a sobel on lines of 47 pixels
+    const arm_cv_scratch_kernel_t pipeline_47[] = {{ARM_CV_SCRATCH_LINEAR_BUFFER_15, 0, 47, NULL},
+                                                   {ARM_CV_SCRATCH_SOBEL, 0, 47, NULL}};
+
+    ref[0] = arm_get_linear_scratch_size_buffer_15(width);
+    ref[1] = arm_get_linear_scratch_size_buffer_31(width);
+    ref[2] = arm_get_scratch_size_sobel(width);
+    ref[3] = arm_get_scratch_size_separable_filter(width, 9);
+    ref[4] = arm_get_scratch_size_gaussian_plan(&plan, width);
+    ref[5] = arm_get_scratch_size_box_filter(width, 7);
+    ref[6] = arm_cv_get_scratch_size_canny_sobel(width);
+    ref[7] = arm_cv_get_scratch_size_canny_gaussian_sobel(width);
+    ref[8] = arm_get_scratch_size_resize_fixp(width, 3);
+    ref[9] = 0;
+    // Canny edge: 10 lines of q15 and 3 lines of uint8 = 14720 bytes.
+    // It is bigger than the resize (7680 bytes) and the gaussian ((640 + 12) * 4 = 2608 bytes)
+    ref[10] = 14720;
+    // 47 * 2 = 94 bytes for both kernels, rounded up to a multiple of 16 bytes
+    ref[11] = 96;
+
+    start = time_in_cycles();
+    for (uint32_t i = 0; i < nb_kernels; i++)
+    {
+        dst[i] = arm_cv_get_scratch_size_kernel(&kernels[i]);
+    }
+    dst[10] = arm_cv_get_scratch_size_pipeline(pipeline_vga, 3);
+    dst[11] = arm_cv_get_scratch_size_pipeline(pipeline_47, 2);
+    end = time_in_cycles();
+    cycles = end - start;
+}
+
 void run_test(const unsigned char *inputs, const uint32_t testid, const uint32_t funcid, unsigned char *&wbuf,
               uint32_t &total_bytes, long &cycles)
 {
@@ -228,6 +611,102 @@ void run_test(const unsigned char *inputs, const uint32_t testid, const uint32_t
         //arm_gaussian_filter_7x7_fixp_32 buffer q31
         test_gauss_7_31(inputs, wbuf, total_bytes, testid, cycles, ARM_CV_BORDER_WRAP, funcid);
         break;
+    case 18:
+        //arm_separable_filter_u8
+        test_separable(inputs, wbuf, total_bytes, testid, cycles, separable_row, separable_col, 9, SEPARABLE_SHIFT,
+                       ARM_CV_BORDER_NEAREST, funcid);
+        break;
+    case 19:
+        //arm_separable_filter_u8
+        test_separable(inputs, wbuf, total_bytes, testid, cycles, separable_row, separable_col, 9, SEPARABLE_SHIFT,
+                       ARM_CV_BORDER_REFLECT, funcid);
+        break;
+    case 20:
+        //arm_separable_filter_u8
+        test_separable(inputs, wbuf, total_bytes, testid, cycles, separable_row, separable_col, 9, SEPARABLE_SHIFT,
+                       ARM_CV_BORDER_WRAP, funcid);
+        break;
+    case 21:
+        //arm_gaussian_filter_plan q15 buffer
+        test_gauss_plan(inputs, wbuf, total_bytes, testid, cycles, 1.0f, 5, ARM_CV_BORDER_REFLECT, funcid);
+        break;
+    case 22:
+        //arm_gaussian_filter_plan q31 buffer
+        test_gauss_plan(inputs, wbuf, total_bytes, testid, cycles, 2.0f, 0, ARM_CV_BORDER_REFLECT, funcid);
+        break;
+    case 23:
+        //arm_box_filter_u8
+        test_box(inputs, wbuf, total_bytes, testid, cycles, 1, ARM_CV_BORDER_NEAREST, funcid);
+        break;
+    case 24:
+        //arm_box_filter_u8
+        test_box(inputs, wbuf, total_bytes, testid, cycles, 7, ARM_CV_BORDER_REFLECT, funcid);
+        break;
+    case 25:
+        //arm_box_filter_u8
+        test_box(inputs, wbuf, total_bytes, testid, cycles, 15, ARM_CV_BORDER_WRAP, funcid);
+        break;
+    case 26:
+        //arm_median_filter_3x3
+        test_median(inputs, wbuf, total_bytes, testid, cycles, 3, ARM_CV_BORDER_NEAREST, funcid);
+        break;
+    case 27:
+        //arm_median_filter_3x3
+        test_median(inputs, wbuf, total_bytes, testid, cycles, 3, ARM_CV_BORDER_REFLECT, funcid);
+        break;
+    case 28:
+        //arm_median_filter_3x3
+        test_median(inputs, wbuf, total_bytes, testid, cycles, 3, ARM_CV_BORDER_WRAP, funcid);
+        break;
+    case 29:
+        //arm_median_filter_5x5
+        test_median(inputs, wbuf, total_bytes, testid, cycles, 5, ARM_CV_BORDER_NEAREST, funcid);
+        break;
+    case 30:
+        //arm_median_filter_5x5
+        test_median(inputs, wbuf, total_bytes, testid, cycles, 5, ARM_CV_BORDER_REFLECT, funcid);
+        break;
+    case 31:
+        //arm_median_filter_5x5
+        test_median(inputs, wbuf, total_bytes, testid, cycles, 5, ARM_CV_BORDER_WRAP, funcid);
+        break;
+    case 32:
+        //arm_gaussian_filter_3x3_fixp_strip
+        test_gauss_strip(inputs, wbuf, total_bytes, testid, cycles, 3, false, ARM_CV_BORDER_NEAREST, funcid);
+        break;
+    case 33:
+        //arm_gaussian_filter_7x7_buffer_15_fixp_strip
+        test_gauss_strip(inputs, wbuf, total_bytes, testid, cycles, 7, false, ARM_CV_BORDER_REFLECT, funcid);
+        break;
+    case 34:
+        //arm_gaussian_filter_3x3_fixp on strided images
+        test_gauss_stride(inputs, wbuf, total_bytes, testid, cycles, ARM_CV_BORDER_REFLECT, funcid);
+        break;
+    case 35:
+        //arm_gaussian_filter_5x5_fixp_strip
+        test_gauss_strip(inputs, wbuf, total_bytes, testid, cycles, 5, false, ARM_CV_BORDER_NEAREST, funcid);
+        break;
+    case 36:
+        //arm_gaussian_filter_7x7_buffer_31_fixp_strip
+        test_gauss_strip(inputs, wbuf, total_bytes, testid, cycles, 7, true, ARM_CV_BORDER_REFLECT, funcid);
+        break;
+    case 37:
+        //arm_sobel_vertical_strip
+        test_sobel_strip(inputs, wbuf, total_bytes, testid, cycles, ARM_CV_BORDER_REFLECT, 0, funcid);
+        break;
+    case 38:
+        //arm_sobel_horizontal_strip
+        test_sobel_strip(inputs, wbuf, total_bytes, testid, cycles, ARM_CV_BORDER_NEAREST, 1, funcid);
+        break;
+    case 39:
+        //arm_cv_get_scratch_size_kernel and arm_cv_get_scratch_size_pipeline
+        test_scratch_planner(inputs, wbuf, total_bytes, testid, cycles, funcid);
+        break;
+    case 40:
+        //arm_separable_filter_u8 with the largest kernel
+        test_separable(inputs, wbuf, total_bytes, testid, cycles, separable_row_15, separable_col_15, 15,
+                       SEPARABLE_SHIFT_15, ARM_CV_BORDER_REFLECT, funcid);
+        break;
     }
 }
 
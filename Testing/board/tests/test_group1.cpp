@@ -6,6 +6,7 @@
 
 extern "C" {
     #include "cv/color_transforms.h"
+    #include "cv/strip.h"
 }
 
 
@@ -38,14 +39,9 @@ void test0(const unsigned char* inputs,
     const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);
     uint8_t *dst = Buffer<uint8_t>::write(outputs,0);
 
-    const arm_cv_image_yuv420_t input={(uint16_t)width,
-                                       (uint16_t)height,
-                                       (uint8_t*)src};
+    const arm_cv_image_yuv420_t input=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)src);
 
-    arm_cv_image_gray8_t output;
-    output.width=width;
-    output.height=height;
-    output.pData=dst;
+    arm_cv_image_gray8_t output=ARM_CV_IMAGE_INIT(width,height,dst);
     
     // The test to run is executed with some timing code.
     start = time_in_cycles();
@@ -79,14 +75,9 @@ void test1(const unsigned char* inputs,
     const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);
     uint8_t *dst = Buffer<uint8_t>::write(outputs,0);
 
-    const arm_cv_image_bgr_8U3C_t input={(uint16_t)width,
-                                       (uint16_t)height,
-                                       (uint8_t*)src};
+    const arm_cv_image_bgr_8U3C_t input=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)src);
 
-    arm_cv_image_gray8_t output;
-    output.width=width;
-    output.height=height;
-    output.pData=dst;
+    arm_cv_image_gray8_t output=ARM_CV_IMAGE_INIT(width,height,dst);
     
     // The test to run is executed with some timing code.
     start = time_in_cycles();
@@ -118,14 +109,9 @@ void test2(const unsigned char* inputs,
     const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);
     uint8_t *dst = Buffer<uint8_t>::write(outputs,0);
 
-    const arm_cv_image_gray8_t input={(uint16_t)width,
-                                       (uint16_t)height,
-                                       (uint8_t*)src};
+    const arm_cv_image_gray8_t input=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)src);
 
-    arm_cv_image_rgb24_t output;
-    output.width=width;
-    output.height=height;
-    output.pData=dst;
+    arm_cv_image_rgb24_t output=ARM_CV_IMAGE_INIT(width,height,dst);
     
     // The test to run is executed with some timing code.
     start = time_in_cycles();
@@ -162,14 +148,9 @@ void test3(const unsigned char* inputs,
     const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);
     uint8_t *dst = Buffer<uint8_t>::write(outputs,0);
 
-    const arm_cv_image_bgr_8U3C_t input={(uint16_t)width,
-                                       (uint16_t)height,
-                                       (uint8_t*)src};
+    const arm_cv_image_bgr_8U3C_t input=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)src);
 
-    arm_cv_image_rgb24_t output;
-    output.width=width;
-    output.height=height;
-    output.pData=dst;
+    arm_cv_image_rgb24_t output=ARM_CV_IMAGE_INIT(width,height,dst);
     
     // The test to run is executed with some timing code.
     start = time_in_cycles();
@@ -212,14 +193,9 @@ void test4(const unsigned char* inputs,
     const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);
     uint8_t *dst = Buffer<uint8_t>::write(outputs,0);
 
-    const arm_cv_image_yuv420_t input={(uint16_t)width,
-                                       (uint16_t)height,
-                                       (uint8_t*)src};
+    const arm_cv_image_yuv420_t input=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)src);
 
-    arm_cv_image_rgb24_t output;
-    output.width=width;
-    output.height=height;
-    output.pData=dst;
+    arm_cv_image_rgb24_t output=ARM_CV_IMAGE_INIT(width,height,dst);
     
     // The test to run is executed with some timing code.
     start = time_in_cycles();
@@ -260,14 +236,9 @@ void test5(const unsigned char* inputs,
     const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);
     uint8_t *dst = Buffer<uint8_t>::write(outputs,0);
 
-    const arm_cv_image_rgb24_t input={(uint16_t)width,
-                                       (uint16_t)height,
-                                       (uint8_t*)src};
+    const arm_cv_image_rgb24_t input=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)src);
 
-    arm_cv_image_gray8_t output;
-    output.width=width;
-    output.height=height;
-    output.pData=dst;
+    arm_cv_image_gray8_t output=ARM_CV_IMAGE_INIT(width,height,dst);
     
     // The test to run is executed with some timing code.
     start = time_in_cycles();
@@ -276,6 +247,184 @@ void test5(const unsigned char* inputs,
     cycles = end - start;
 }
 
+// Number of tests of the functions converting the full image
+#define NB_TESTS_BEFORE_STRIPS (2 * STANDARD_YUV_NB_IMGS + 3 * STANDARD_RGB_NB_IMGS + STANDARD_GRAY_NB_IMGS)
+
+// arm_bgr_8U3C_to_gray8_strip
+// The first output is the image converted in one call and the second one
+// the image converted by strips of 16 rows. Each strip is written in its own
+// buffer followed by canary bytes to detect the writes after the strip
+void test6(const unsigned char* inputs,
+                 unsigned char* &outputs,
+                 uint32_t &total_bytes,
+                 uint32_t testid,
+                 long &cycles)
+{    
+    long start,end;
+    uint32_t nb,channels,width,height,misc;
+    const uint16_t stripHeight = 16;
+    int bufid = TENSOR_START + testid
+       - NB_TESTS_BEFORE_STRIPS
+       + STANDARD_YUV_NB_IMGS
+    ;
+
+    // BGR_8U3C has dimension [3,H,W]
+    get_buffer_shape(inputs,bufid,&nb,&channels,&height,&width,&misc);
+
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(height,width)
+                                                            ,kIMG_GRAY8_TYPE),
+                                           BufferDescription(Shape(height,width)
+                                                            ,kIMG_GRAY8_TYPE)
+                                          };
+
+    outputs = create_write_buffer(desc,total_bytes);
+
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);
+    uint8_t *dst = Buffer<uint8_t>::write(outputs,0);
+    uint8_t *dst_strip = Buffer<uint8_t>::write(outputs,1);
+
+    const arm_cv_image_bgr_8U3C_t input=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)src);
+
+    arm_cv_image_gray8_t output=ARM_CV_IMAGE_INIT(width,height,dst);
+    arm_bgr_8U3C_to_gray8(&input,&output);
+
+    // Only the conversion of the strips is timed
+    cycles = 0;
+    for (uint32_t row = 0; row < height; row += stripHeight)
+    {
+        arm_cv_strip_t strip = {(uint16_t)height,(uint16_t)row};
+        uint16_t nbRows = (row + stripHeight > height) ? height - row : stripHeight;
+        uint32_t stripBytes = nbRows * width;
+        uint8_t *buf = canary_malloc(stripBytes);
+
+        arm_cv_image_gray8_t stripOutput=ARM_CV_IMAGE_INIT(width,nbRows,buf);
+
+        start = time_in_cycles();
+        arm_bgr_8U3C_to_gray8_strip(&input,&stripOutput,&strip);
+        end = time_in_cycles();
+        cycles += end - start;
+
+        canary_copy_and_free(&dst_strip[row * width],&dst[row * width],buf,stripBytes);
+    }
+}
+
+// arm_bgr_8U3C_to_rgb24_strip
+// Same outputs as test6
+void test7(const unsigned char* inputs,
+                 unsigned char* &outputs,
+                 uint32_t &total_bytes,
+                 uint32_t testid,
+                 long &cycles)
+{    
+    long start,end;
+    uint32_t nb,channels,width,height,misc;
+    const uint16_t stripHeight = 16;
+    int bufid = TENSOR_START + testid
+       - NB_TESTS_BEFORE_STRIPS
+       - STANDARD_RGB_NB_IMGS
+       + STANDARD_YUV_NB_IMGS
+    ;
+
+    // BGR_8U3C has dimension [3,H,W]
+    get_buffer_shape(inputs,bufid,&nb,&channels,&height,&width,&misc);
+
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(height,width)
+                                                            ,kIMG_RGB_TYPE),
+                                           BufferDescription(Shape(height,width)
+                                                            ,kIMG_RGB_TYPE)
+                                          };
+
+    outputs = create_write_buffer(desc,total_bytes);
+
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);
+    uint8_t *dst = Buffer<uint8_t>::write(outputs,0);
+    uint8_t *dst_strip = Buffer<uint8_t>::write(outputs,1);
+
+    const arm_cv_image_bgr_8U3C_t input=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)src);
+
+    arm_cv_image_rgb24_t output=ARM_CV_IMAGE_INIT(width,height,dst);
+    arm_bgr_8U3C_to_rgb24(&input,&output);
+
+    // Only the conversion of the strips is timed
+    cycles = 0;
+    for (uint32_t row = 0; row < height; row += stripHeight)
+    {
+        arm_cv_strip_t strip = {(uint16_t)height,(uint16_t)row};
+        uint16_t nbRows = (row + stripHeight > height) ? height - row : stripHeight;
+        uint32_t stripBytes = nbRows * width * 3;
+        uint8_t *buf = canary_malloc(stripBytes);
+
+        arm_cv_image_rgb24_t stripOutput=ARM_CV_IMAGE_INIT(width,nbRows,buf);
+
+        start = time_in_cycles();
+        arm_bgr_8U3C_to_rgb24_strip(&input,&stripOutput,&strip);
+        end = time_in_cycles();
+        cycles += end - start;
+
+        canary_copy_and_free(&dst_strip[row * width * 3],&dst[row * width * 3],buf,stripBytes);
+    }
+}
+
+// arm_yuv420_to_rgb24_strip
+// Same outputs as test6
+void test8(const unsigned char* inputs,
+                 unsigned char* &outputs,
+                 uint32_t &total_bytes,
+                 uint32_t testid,
+                 long &cycles)
+{    
+    long start,end;
+    uint32_t width,height;
+    const uint16_t stripHeight = 16;
+    int bufid = TENSOR_START + testid
+       - NB_TESTS_BEFORE_STRIPS
+       - STANDARD_RGB_NB_IMGS
+       - STANDARD_RGB_NB_IMGS
+    ;
+
+    // YUV is recorded as a bidimensional tensor
+    get_img_dims(inputs,bufid,&width,&height);
+
+    // Convert to image height from YUV height
+    height = height * 2 / 3;
+
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(height,width)
+                                                            ,kIMG_RGB_TYPE),
+                                           BufferDescription(Shape(height,width)
+                                                            ,kIMG_RGB_TYPE)
+                                          };
+
+    outputs = create_write_buffer(desc,total_bytes);
+
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);
+    uint8_t *dst = Buffer<uint8_t>::write(outputs,0);
+    uint8_t *dst_strip = Buffer<uint8_t>::write(outputs,1);
+
+    const arm_cv_image_yuv420_t input=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)src);
+
+    arm_cv_image_rgb24_t output=ARM_CV_IMAGE_INIT(width,height,dst);
+    arm_yuv420_to_rgb24(&input,&output);
+
+    // Only the conversion of the strips is timed
+    cycles = 0;
+    for (uint32_t row = 0; row < height; row += stripHeight)
+    {
+        arm_cv_strip_t strip = {(uint16_t)height,(uint16_t)row};
+        uint16_t nbRows = (row + stripHeight > height) ? height - row : stripHeight;
+        uint32_t stripBytes = nbRows * width * 3;
+        uint8_t *buf = canary_malloc(stripBytes);
+
+        arm_cv_image_rgb24_t stripOutput=ARM_CV_IMAGE_INIT(width,nbRows,buf);
+
+        start = time_in_cycles();
+        arm_yuv420_to_rgb24_strip(&input,&stripOutput,&strip);
+        end = time_in_cycles();
+        cycles += end - start;
+
+        canary_copy_and_free(&dst_strip[row * width * 3],&dst[row * width * 3],buf,stripBytes);
+    }
+}
+
 void run_test(const unsigned char* inputs,
               const uint32_t testid,
               const uint32_t funcid,
@@ -310,6 +459,18 @@ void run_test(const unsigned char* inputs,
             // arm_rgb24_to_gray8
             test5(inputs,wbuf,total_bytes,testid,cycles);
         break;
+        case 6:
+            // arm_bgr_8U3C_to_gray8_strip
+            test6(inputs,wbuf,total_bytes,testid,cycles);
+        break;
+        case 7:
+            // arm_bgr_8U3C_to_rgb24_strip
+            test7(inputs,wbuf,total_bytes,testid,cycles);
+        break;
+        case 8:
+            // arm_yuv420_to_rgb24_strip
+            test8(inputs,wbuf,total_bytes,testid,cycles);
+        break;
     }
 
 }
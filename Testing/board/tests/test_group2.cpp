@@ -4,9 +4,11 @@
 #include <vector>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 extern "C" {
     #include "cv/image_transforms.h"
+    #include "cv/color_transforms.h"
 }
 
 
@@ -37,14 +39,9 @@ void test##TESTID(const unsigned char* inputs,
     const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                                    \
     uint8_t *dst = Buffer<uint8_t>::write(outputs,0);                                            \
                                                                                                  \
-    const arm_cv_image_gray8_t input={(uint16_t)width,                                           \
-                                       (uint16_t)height,                                         \
-                                       (uint8_t*)src};                                           \
+    const arm_cv_image_gray8_t input=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)src);              \
                                                                                                  \
-    arm_cv_image_gray8_t output;                                                                 \
-    output.width=(RIGHT)-(LEFT);                                                                 \
-    output.height=(BOTTOM)-(TOP);                                                                \
-    output.pData=dst;                                                                            \
+    arm_cv_image_gray8_t output=ARM_CV_IMAGE_INIT((RIGHT)-(LEFT),(BOTTOM)-(TOP),dst);            \
                                                                                                  \
     start = time_in_cycles();                                                                    \
     arm_crop_gray8(&input,&output,(LEFT),(TOP),(RIGHT),(BOTTOM));                                \
@@ -76,14 +73,9 @@ void test##TESTID(const unsigned char* inputs,
     const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                                    \
     uint8_t *dst = Buffer<uint8_t>::write(outputs,0);                                            \
                                                                                                  \
-    const arm_cv_image_rgb24_t input={(uint16_t)width,                                           \
-                                       (uint16_t)height,                                         \
-                                       (uint8_t*)src};                                           \
+    const arm_cv_image_rgb24_t input=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)src);              \
                                                                                                  \
-    arm_cv_image_rgb24_t output;                                                                 \
-    output.width=(RIGHT)-(LEFT);                                                                 \
-    output.height=(BOTTOM)-(TOP);                                                                \
-    output.pData=dst;                                                                            \
+    arm_cv_image_rgb24_t output=ARM_CV_IMAGE_INIT((RIGHT)-(LEFT),(BOTTOM)-(TOP),dst);            \
                                                                                                  \
     start = time_in_cycles();                                                                    \
     arm_crop_rgb24(&input,&output,(LEFT),(TOP),(RIGHT),(BOTTOM));                                \
@@ -116,14 +108,10 @@ void test##TESTID(const unsigned char* inputs,                               \
     const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                \
     uint8_t *dst = Buffer<uint8_t>::write(outputs,0);                        \
                                                                              \
-    const arm_cv_image_gray8_t input={(uint16_t)width,                       \
-                                       (uint16_t)height,                     \
-                                       (uint8_t*)src};                       \
+    const arm_cv_image_gray8_t input=ARM_CV_IMAGE_INIT(width,height,         \
+                                                       (uint8_t*)src);       \
                                                                              \
-    arm_cv_image_gray8_t output;                                             \
-    output.width=DSTW;                                                       \
-    output.height=DSTH;                                                      \
-    output.pData=dst;                                                        \
+    arm_cv_image_gray8_t output=ARM_CV_IMAGE_INIT(DSTW,DSTH,dst);            \
                                                                              \
     start = time_in_cycles();                                                \
     arm_image_resize_gray8_f32(&input,&output,p_img);                            \
@@ -158,14 +146,10 @@ void test##TESTID(const unsigned char* inputs,
     const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                      \
     uint8_t *dst = Buffer<uint8_t>::write(outputs,0);                              \
                                                                                    \
-    const arm_cv_image_bgr_8U3C_t input={(uint16_t)width,                          \
-                                       (uint16_t)height,                           \
-                                       (uint8_t*)src};                             \
+    const arm_cv_image_bgr_8U3C_t input=ARM_CV_IMAGE_INIT(width,height,            \
+                                                          (uint8_t*)src);          \
                                                                                    \
-    arm_cv_image_bgr_8U3C_t output;                                                \
-    output.width=DSTW;                                                             \
-    output.height=DSTH;                                                            \
-    output.pData=dst;                                                              \
+    arm_cv_image_bgr_8U3C_t output=ARM_CV_IMAGE_INIT(DSTW,DSTH,dst);               \
                                                                                    \
     start = time_in_cycles();                                                      \
     arm_image_resize_bgr_8U3C_f32(&input,&output,p_img);                               \
@@ -201,14 +185,10 @@ void test##TESTID(const unsigned char* inputs,
     const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                      \
     uint8_t *dst = Buffer<uint8_t>::write(outputs,0);                              \
                                                                                    \
-    const arm_cv_image_bgr_8U3C_t input={(uint16_t)width,                          \
-                                       (uint16_t)height,                           \
-                                       (uint8_t*)src};                             \
+    const arm_cv_image_bgr_8U3C_t input=ARM_CV_IMAGE_INIT(width,height,            \
+                                                          (uint8_t*)src);          \
                                                                                    \
-    arm_cv_image_rgb24_t output;                                                \
-    output.width=DSTW;                                                             \
-    output.height=DSTH;                                                            \
-    output.pData=dst;                                                              \
+    arm_cv_image_rgb24_t output=ARM_CV_IMAGE_INIT(DSTW,DSTH,dst);                  \
                                                                                    \
     start = time_in_cycles();                                                      \
     arm_image_resize_bgr_8U3C_to_rgb24_f32(&input,&output,p_img);                               \
@@ -218,6 +198,642 @@ void test##TESTID(const unsigned char* inputs,
     free(p_img);                                                                   \
 }
 
+#define INTEGRAL_GRAY8(TESTID,WIDTH)                                             \
+void test##TESTID(const unsigned char* inputs,                                   \
+                        unsigned char* &outputs,                                 \
+                        uint32_t &total_bytes,                                   \
+                        uint32_t testid,                                         \
+                        long &cycles)                                            \
+{                                                                                \
+    long start,end;                                                              \
+    uint32_t width,height;                                                       \
+    int bufid = TENSOR_START + 0;                                                \
+    (void)testid;                                                                \
+                                                                                 \
+    get_img_dims(inputs,bufid,&width,&height);                                   \
+                                                                                 \
+    /* The first WIDTH columns of the input are used */                          \
+    const uint32_t stride = width;                                               \
+    width = WIDTH;                                                               \
+                                                                                 \
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(height+1,width+1)\
+                                                            ,kIMG_NUMPY_TYPE_UINT32)\
+                                          };                                     \
+                                                                                 \
+    outputs = create_write_buffer(desc,total_bytes);                             \
+                                                                                 \
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                    \
+    uint32_t *dst = Buffer<uint32_t>::write(outputs,0);                          \
+                                                                                 \
+    const arm_cv_image_gray8_t input={(uint16_t)width,                           \
+                                       (uint16_t)height,                         \
+                                       (uint8_t*)src,                            \
+                                       (uint16_t)stride};                        \
+                                                                                 \
+    arm_cv_image_u32_t output=ARM_CV_IMAGE_INIT(width+1,height+1,dst);           \
+                                                                                 \
+    start = time_in_cycles();                                                    \
+    arm_integral_gray8(&input,&output);                                          \
+    end = time_in_cycles();                                                      \
+    cycles = end - start;                                                        \
+}
+
+#define INTEGRAL_SQUARED_GRAY8(TESTID,WIDTH)                                     \
+void test##TESTID(const unsigned char* inputs,                                   \
+                        unsigned char* &outputs,                                 \
+                        uint32_t &total_bytes,                                   \
+                        uint32_t testid,                                         \
+                        long &cycles)                                            \
+{                                                                                \
+    long start,end;                                                              \
+    uint32_t width,height;                                                       \
+    int bufid = TENSOR_START + 0;                                                \
+    (void)testid;                                                                \
+                                                                                 \
+    get_img_dims(inputs,bufid,&width,&height);                                   \
+                                                                                 \
+    /* The first WIDTH columns of the input are used */                          \
+    const uint32_t stride = width;                                               \
+    width = WIDTH;                                                               \
+                                                                                 \
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(height+1,width+1)\
+                                                            ,kIMG_NUMPY_TYPE_UINT32),\
+                                           BufferDescription(Shape(height+1,width+1)\
+                                                            ,kIMG_NUMPY_TYPE_UINT32)\
+                                          };                                     \
+                                                                                 \
+    outputs = create_write_buffer(desc,total_bytes);                             \
+                                                                                 \
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                    \
+    uint32_t *dst = Buffer<uint32_t>::write(outputs,0);                          \
+    uint32_t *dst_sq = Buffer<uint32_t>::write(outputs,1);                       \
+    uint64_t *sq = (uint64_t*)malloc((width+1)*(height+1)*sizeof(uint64_t));     \
+                                                                                 \
+    const arm_cv_image_gray8_t input={(uint16_t)width,                           \
+                                       (uint16_t)height,                         \
+                                       (uint8_t*)src,                            \
+                                       (uint16_t)stride};                        \
+                                                                                 \
+    arm_cv_image_u32_t output=ARM_CV_IMAGE_INIT(width+1,height+1,dst);           \
+                                                                                 \
+    arm_cv_image_u64_t output_sq=ARM_CV_IMAGE_INIT(width+1,height+1,sq);         \
+                                                                                 \
+    start = time_in_cycles();                                                    \
+    arm_integral_squared_gray8(&input,&output,&output_sq);                       \
+    end = time_in_cycles();                                                      \
+    cycles = end - start;                                                        \
+                                                                                 \
+    /* No 64 bit tensor in the test framework. For the test images               \
+       the squared sums are less than 128*128*255*255 and fit on 32 bits */      \
+    for(uint32_t i=0;i<(width+1)*(height+1);i++)                                 \
+    {                                                                            \
+        dst_sq[i] = (uint32_t)sq[i];                                             \
+    }                                                                            \
+    free(sq);                                                                    \
+}
+
+#define GRAY8_VIEW(TESTID,LEFT,TOP,RIGHT,BOTTOM)                                                 \
+void test##TESTID(const unsigned char* inputs,                                                   \
+                        unsigned char* &outputs,                                                 \
+                        uint32_t &total_bytes,                                                   \
+                        uint32_t testid,                                                         \
+                        long &cycles)                                                            \
+{                                                                                                \
+    long start,end;                                                                              \
+    uint32_t width,height;                                                                       \
+    int bufid = TENSOR_START + 0;                                                                \
+    (void)testid;                                                                                \
+                                                                                                 \
+    get_img_dims(inputs,bufid,&width,&height);                                                   \
+                                                                                                 \
+    std::vector<BufferDescription> desc = {BufferDescription(Shape((BOTTOM)-(TOP),(RIGHT)-(LEFT))\
+                                                            ,kIMG_GRAY8_TYPE)                    \
+                                          };                                                     \
+                                                                                                 \
+                                                                                                 \
+    outputs = create_write_buffer(desc,total_bytes);                                             \
+                                                                                                 \
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                                    \
+    uint8_t *dst = Buffer<uint8_t>::write(outputs,0);                                            \
+                                                                                                 \
+    const arm_cv_image_gray8_t input=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)src);              \
+                                                                                                 \
+    arm_cv_image_gray8_t view;                                                                   \
+    arm_cv_image_gray8_t output=ARM_CV_IMAGE_INIT((RIGHT)-(LEFT),(BOTTOM)-(TOP),dst);            \
+                                                                                                 \
+    start = time_in_cycles();                                                                    \
+    arm_cv_image_view_gray8(&input,&view,(LEFT),(TOP),(RIGHT),(BOTTOM));                         \
+    end = time_in_cycles();                                                                      \
+    cycles = end - start;                                                                        \
+                                                                                                 \
+    /* The view is packed in the output to be checked */                                         \
+    arm_crop_gray8(&view,&output,0,0,view.width,view.height);                                    \
+}
+
+#define RGB24_VIEW(TESTID,LEFT,TOP,RIGHT,BOTTOM)                                                 \
+void test##TESTID(const unsigned char* inputs,                                                   \
+                        unsigned char* &outputs,                                                 \
+                        uint32_t &total_bytes,                                                   \
+                        uint32_t testid,                                                         \
+                        long &cycles)                                                            \
+{                                                                                                \
+    long start,end;                                                                              \
+    uint32_t width,height;                                                                       \
+    int bufid = TENSOR_START + 1;                                                                \
+    (void)testid;                                                                                \
+                                                                                                 \
+    get_img_dims(inputs,bufid,&width,&height);                                                   \
+                                                                                                 \
+    std::vector<BufferDescription> desc = {BufferDescription(Shape((BOTTOM)-(TOP),(RIGHT)-(LEFT))\
+                                                            ,kIMG_RGB_TYPE)                      \
+                                          };                                                     \
+                                                                                                 \
+                                                                                                 \
+    outputs = create_write_buffer(desc,total_bytes);                                             \
+                                                                                                 \
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                                    \
+    uint8_t *dst = Buffer<uint8_t>::write(outputs,0);                                            \
+                                                                                                 \
+    const arm_cv_image_rgb24_t input=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)src);              \
+                                                                                                 \
+    arm_cv_image_rgb24_t view;                                                                   \
+    arm_cv_image_rgb24_t output=ARM_CV_IMAGE_INIT((RIGHT)-(LEFT),(BOTTOM)-(TOP),dst);            \
+                                                                                                 \
+    start = time_in_cycles();                                                                    \
+    arm_cv_image_view_rgb24(&input,&view,(LEFT),(TOP),(RIGHT),(BOTTOM));                         \
+    end = time_in_cycles();                                                                      \
+    cycles = end - start;                                                                        \
+                                                                                                 \
+    /* The view is packed in the output to be checked */                                         \
+    arm_crop_rgb24(&view,&output,0,0,view.width,view.height);                                    \
+}
+
+#define RESIZE_GRAY8_FIXP(TESTID,DSTW,DSTH)                                         \
+void test##TESTID(const unsigned char* inputs,                                      \
+                        unsigned char* &outputs,                                    \
+                        uint32_t &total_bytes,                                      \
+                        uint32_t testid,                                            \
+                        long &cycles)                                               \
+{                                                                                   \
+    long start,end;                                                                 \
+    uint32_t width,height;                                                          \
+    int bufid = TENSOR_START + 0;                                                   \
+    (void)testid;                                                                   \
+    uint16_t *p_lines = (uint16_t*)malloc(arm_get_scratch_size_resize_fixp(DSTW,1));\
+                                                                                    \
+    get_img_dims(inputs,bufid,&width,&height);                                      \
+                                                                                    \
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(DSTH,DSTW)       \
+                                                            ,kIMG_GRAY8_TYPE)       \
+                                          };                                        \
+                                                                                    \
+                                                                                    \
+    outputs = create_write_buffer(desc,total_bytes);                                \
+                                                                                    \
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                       \
+    uint8_t *dst = Buffer<uint8_t>::write(outputs,0);                               \
+                                                                                    \
+    const arm_cv_image_gray8_t input=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)src); \
+                                                                                    \
+    arm_cv_image_gray8_t output=ARM_CV_IMAGE_INIT(DSTW,DSTH,dst);                   \
+                                                                                    \
+    start = time_in_cycles();                                                       \
+    arm_image_resize_gray8_fixp(&input,&output,p_lines);                            \
+    end = time_in_cycles();                                                         \
+    cycles = end - start;                                                           \
+                                                                                    \
+    free(p_lines);                                                                  \
+}
+
+#define RESIZE_BGR_FIXP(TESTID,DSTW,DSTH)                                           \
+void test##TESTID(const unsigned char* inputs,                                      \
+                        unsigned char* &outputs,                                    \
+                        uint32_t &total_bytes,                                      \
+                        uint32_t testid,                                            \
+                        long &cycles)                                               \
+{                                                                                   \
+    long start,end;                                                                 \
+    uint32_t nb,channels,width,height,misc;                                         \
+    int bufid = TENSOR_START + 2;                                                   \
+    (void)testid;                                                                   \
+    uint16_t *p_lines = (uint16_t*)malloc(arm_get_scratch_size_resize_fixp(DSTW,1));\
+                                                                                    \
+    get_buffer_shape(inputs,bufid,&nb,&channels,&height,&width,&misc);              \
+                                                                                    \
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(3,DSTH,DSTW)     \
+                                                            ,kIMG_NUMPY_TYPE_UINT8) \
+                                          };                                        \
+                                                                                    \
+                                                                                    \
+    outputs = create_write_buffer(desc,total_bytes);                                \
+                                                                                    \
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                       \
+    uint8_t *dst = Buffer<uint8_t>::write(outputs,0);                               \
+                                                                                    \
+    const arm_cv_image_bgr_8U3C_t input=ARM_CV_IMAGE_INIT(width,height,             \
+                                                          (uint8_t*)src);           \
+                                                                                    \
+    arm_cv_image_bgr_8U3C_t output=ARM_CV_IMAGE_INIT(DSTW,DSTH,dst);                \
+                                                                                    \
+    start = time_in_cycles();                                                       \
+    arm_image_resize_bgr_8U3C_fixp(&input,&output,p_lines);                         \
+    end = time_in_cycles();                                                         \
+    cycles = end - start;                                                           \
+                                                                                    \
+    free(p_lines);                                                                  \
+}
+
+#define RESIZE_RGB_FIXP(TESTID,DSTW,DSTH)                                           \
+void test##TESTID(const unsigned char* inputs,                                      \
+                        unsigned char* &outputs,                                    \
+                        uint32_t &total_bytes,                                      \
+                        uint32_t testid,                                            \
+                        long &cycles)                                               \
+{                                                                                   \
+    long start,end;                                                                 \
+    uint32_t width,height;                                                          \
+    int bufid = TENSOR_START + 1;                                                   \
+    (void)testid;                                                                   \
+    uint16_t *p_lines = (uint16_t*)malloc(arm_get_scratch_size_resize_fixp(DSTW,3));\
+                                                                                    \
+    get_img_dims(inputs,bufid,&width,&height);                                      \
+                                                                                    \
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(DSTH,DSTW)       \
+                                                            ,kIMG_RGB_TYPE)         \
+                                          };                                        \
+                                                                                    \
+                                                                                    \
+    outputs = create_write_buffer(desc,total_bytes);                                \
+                                                                                    \
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                       \
+    uint8_t *dst = Buffer<uint8_t>::write(outputs,0);                               \
+                                                                                    \
+    const arm_cv_image_rgb24_t input=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)src); \
+                                                                                    \
+    arm_cv_image_rgb24_t output=ARM_CV_IMAGE_INIT(DSTW,DSTH,dst);                   \
+                                                                                    \
+    start = time_in_cycles();                                                       \
+    arm_image_resize_rgb24_fixp(&input,&output,p_lines);                            \
+    end = time_in_cycles();                                                         \
+    cycles = end - start;                                                           \
+                                                                                    \
+    free(p_lines);                                                                  \
+}
+
+#define RESIZE_GRAY8_PLAN(TESTID,DSTW,DSTH)                                         \
+void test##TESTID(const unsigned char* inputs,                                      \
+                        unsigned char* &outputs,                                    \
+                        uint32_t &total_bytes,                                      \
+                        uint32_t testid,                                            \
+                        long &cycles)                                               \
+{                                                                                   \
+    long start,end;                                                                 \
+    uint32_t width,height;                                                          \
+    int bufid = TENSOR_START + 0;                                                   \
+    (void)testid;                                                                   \
+    uint16_t *p_lines = (uint16_t*)malloc(arm_get_scratch_size_resize_fixp(DSTW,1));\
+    uint8_t *p_plan = (uint8_t*)malloc(arm_get_buffer_size_resize_plan(DSTW,DSTH)); \
+    arm_image_resize_plan_t plan;                                                   \
+                                                                                    \
+    get_img_dims(inputs,bufid,&width,&height);                                      \
+                                                                                    \
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(DSTH,DSTW)       \
+                                                            ,kIMG_GRAY8_TYPE)       \
+                                          };                                        \
+                                                                                    \
+                                                                                    \
+    outputs = create_write_buffer(desc,total_bytes);                                \
+                                                                                    \
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                       \
+    uint8_t *dst = Buffer<uint8_t>::write(outputs,0);                               \
+                                                                                    \
+    const arm_cv_image_gray8_t input=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)src); \
+                                                                                    \
+    arm_cv_image_gray8_t output=ARM_CV_IMAGE_INIT(DSTW,DSTH,dst);                   \
+                                                                                    \
+    /* The plan is computed once and is not part of the measured time */            \
+    arm_image_resize_plan_init(&plan,(uint16_t)width,(uint16_t)height,DSTW,DSTH,p_plan);\
+                                                                                    \
+    start = time_in_cycles();                                                       \
+    arm_image_resize_gray8_plan(&plan,&input,&output,p_lines);                      \
+    end = time_in_cycles();                                                         \
+    cycles = end - start;                                                           \
+                                                                                    \
+    free(p_plan);                                                                   \
+    free(p_lines);                                                                  \
+}
+
+#define RESIZE_BGR_PLAN(TESTID,DSTW,DSTH)                                           \
+void test##TESTID(const unsigned char* inputs,                                      \
+                        unsigned char* &outputs,                                    \
+                        uint32_t &total_bytes,                                      \
+                        uint32_t testid,                                            \
+                        long &cycles)                                               \
+{                                                                                   \
+    long start,end;                                                                 \
+    uint32_t nb,channels,width,height,misc;                                         \
+    int bufid = TENSOR_START + 2;                                                   \
+    (void)testid;                                                                   \
+    uint16_t *p_lines = (uint16_t*)malloc(arm_get_scratch_size_resize_fixp(DSTW,1));\
+    uint8_t *p_plan = (uint8_t*)malloc(arm_get_buffer_size_resize_plan(DSTW,DSTH)); \
+    arm_image_resize_plan_t plan;                                                   \
+                                                                                    \
+    get_buffer_shape(inputs,bufid,&nb,&channels,&height,&width,&misc);              \
+                                                                                    \
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(3,DSTH,DSTW)     \
+                                                            ,kIMG_NUMPY_TYPE_UINT8) \
+                                          };                                        \
+                                                                                    \
+                                                                                    \
+    outputs = create_write_buffer(desc,total_bytes);                                \
+                                                                                    \
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                       \
+    uint8_t *dst = Buffer<uint8_t>::write(outputs,0);                               \
+                                                                                    \
+    const arm_cv_image_bgr_8U3C_t input=ARM_CV_IMAGE_INIT(width,height,             \
+                                                          (uint8_t*)src);           \
+                                                                                    \
+    arm_cv_image_bgr_8U3C_t output=ARM_CV_IMAGE_INIT(DSTW,DSTH,dst);                \
+                                                                                    \
+    /* The plan is computed once and is not part of the measured time */            \
+    arm_image_resize_plan_init(&plan,(uint16_t)width,(uint16_t)height,DSTW,DSTH,p_plan);\
+                                                                                    \
+    start = time_in_cycles();                                                       \
+    arm_image_resize_bgr_8U3C_plan(&plan,&input,&output,p_lines);                   \
+    end = time_in_cycles();                                                         \
+    cycles = end - start;                                                           \
+                                                                                    \
+    free(p_plan);                                                                   \
+    free(p_lines);                                                                  \
+}
+
+#define RESIZE_RGB_PLAN(TESTID,DSTW,DSTH)                                           \
+void test##TESTID(const unsigned char* inputs,                                      \
+                        unsigned char* &outputs,                                    \
+                        uint32_t &total_bytes,                                      \
+                        uint32_t testid,                                            \
+                        long &cycles)                                               \
+{                                                                                   \
+    long start,end;                                                                 \
+    uint32_t width,height;                                                          \
+    int bufid = TENSOR_START + 1;                                                   \
+    (void)testid;                                                                   \
+    uint16_t *p_lines = (uint16_t*)malloc(arm_get_scratch_size_resize_fixp(DSTW,3));\
+    uint8_t *p_plan = (uint8_t*)malloc(arm_get_buffer_size_resize_plan(DSTW,DSTH)); \
+    arm_image_resize_plan_t plan;                                                   \
+                                                                                    \
+    get_img_dims(inputs,bufid,&width,&height);                                      \
+                                                                                    \
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(DSTH,DSTW)       \
+                                                            ,kIMG_RGB_TYPE)         \
+                                          };                                        \
+                                                                                    \
+                                                                                    \
+    outputs = create_write_buffer(desc,total_bytes);                                \
+                                                                                    \
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                       \
+    uint8_t *dst = Buffer<uint8_t>::write(outputs,0);                               \
+                                                                                    \
+    const arm_cv_image_rgb24_t input=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)src); \
+                                                                                    \
+    arm_cv_image_rgb24_t output=ARM_CV_IMAGE_INIT(DSTW,DSTH,dst);                   \
+                                                                                    \
+    /* The plan is computed once and is not part of the measured time */            \
+    arm_image_resize_plan_init(&plan,(uint16_t)width,(uint16_t)height,DSTW,DSTH,p_plan);\
+                                                                                    \
+    start = time_in_cycles();                                                       \
+    arm_image_resize_rgb24_plan(&plan,&input,&output,p_lines);                      \
+    end = time_in_cycles();                                                         \
+    cycles = end - start;                                                           \
+                                                                                    \
+    free(p_plan);                                                                   \
+    free(p_lines);                                                                  \
+}
+
+#define RESIZE_AREA_GRAY8(TESTID,DSTW,DSTH)                                         \
+void test##TESTID(const unsigned char* inputs,                                      \
+                        unsigned char* &outputs,                                    \
+                        uint32_t &total_bytes,                                      \
+                        uint32_t testid,                                            \
+                        long &cycles)                                               \
+{                                                                                   \
+    long start,end;                                                                 \
+    uint32_t width,height;                                                          \
+    int bufid = TENSOR_START + 0;                                                   \
+    (void)testid;                                                                   \
+                                                                                    \
+    get_img_dims(inputs,bufid,&width,&height);                                      \
+    uint32_t *scratch = (uint32_t*)malloc(arm_get_scratch_size_resize_area(width,DSTW,1));\
+                                                                                    \
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(DSTH,DSTW)       \
+                                                            ,kIMG_GRAY8_TYPE)       \
+                                          };                                        \
+                                                                                    \
+                                                                                    \
+    outputs = create_write_buffer(desc,total_bytes);                                \
+                                                                                    \
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                       \
+    uint8_t *dst = Buffer<uint8_t>::write(outputs,0);                               \
+                                                                                    \
+    const arm_cv_image_gray8_t input=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)src); \
+                                                                                    \
+    arm_cv_image_gray8_t output=ARM_CV_IMAGE_INIT(DSTW,DSTH,dst);                   \
+                                                                                    \
+    start = time_in_cycles();                                                       \
+    arm_image_resize_area_gray8(&input,&output,scratch);                            \
+    end = time_in_cycles();                                                         \
+    cycles = end - start;                                                           \
+                                                                                    \
+    free(scratch);                                                                  \
+}
+
+#define RESIZE_AREA_BGR(TESTID,DSTW,DSTH)                                           \
+void test##TESTID(const unsigned char* inputs,                                      \
+                        unsigned char* &outputs,                                    \
+                        uint32_t &total_bytes,                                      \
+                        uint32_t testid,                                            \
+                        long &cycles)                                               \
+{                                                                                   \
+    long start,end;                                                                 \
+    uint32_t nb,channels,width,height,misc;                                         \
+    int bufid = TENSOR_START + 2;                                                   \
+    (void)testid;                                                                   \
+                                                                                    \
+    get_buffer_shape(inputs,bufid,&nb,&channels,&height,&width,&misc);              \
+    uint32_t *scratch = (uint32_t*)malloc(arm_get_scratch_size_resize_area(width,DSTW,1));\
+                                                                                    \
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(3,DSTH,DSTW)     \
+                                                            ,kIMG_NUMPY_TYPE_UINT8) \
+                                          };                                        \
+                                                                                    \
+                                                                                    \
+    outputs = create_write_buffer(desc,total_bytes);                                \
+                                                                                    \
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                       \
+    uint8_t *dst = Buffer<uint8_t>::write(outputs,0);                               \
+                                                                                    \
+    const arm_cv_image_bgr_8U3C_t input=ARM_CV_IMAGE_INIT(width,height,             \
+                                                          (uint8_t*)src);           \
+                                                                                    \
+    arm_cv_image_bgr_8U3C_t output=ARM_CV_IMAGE_INIT(DSTW,DSTH,dst);                \
+                                                                                    \
+    start = time_in_cycles();                                                       \
+    arm_image_resize_area_bgr_8U3C(&input,&output,scratch);                         \
+    end = time_in_cycles();                                                         \
+    cycles = end - start;                                                           \
+                                                                                    \
+    free(scratch);                                                                  \
+}
+
+#define RESIZE_AREA_RGB(TESTID,DSTW,DSTH)                                           \
+void test##TESTID(const unsigned char* inputs,                                      \
+                        unsigned char* &outputs,                                    \
+                        uint32_t &total_bytes,                                      \
+                        uint32_t testid,                                            \
+                        long &cycles)                                               \
+{                                                                                   \
+    long start,end;                                                                 \
+    uint32_t width,height;                                                          \
+    int bufid = TENSOR_START + 1;                                                   \
+    (void)testid;                                                                   \
+                                                                                    \
+    get_img_dims(inputs,bufid,&width,&height);                                      \
+    uint32_t *scratch = (uint32_t*)malloc(arm_get_scratch_size_resize_area(width,DSTW,3));\
+                                                                                    \
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(DSTH,DSTW)       \
+                                                            ,kIMG_RGB_TYPE)         \
+                                          };                                        \
+                                                                                    \
+                                                                                    \
+    outputs = create_write_buffer(desc,total_bytes);                                \
+                                                                                    \
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                       \
+    uint8_t *dst = Buffer<uint8_t>::write(outputs,0);                               \
+                                                                                    \
+    const arm_cv_image_rgb24_t input=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)src); \
+                                                                                    \
+    arm_cv_image_rgb24_t output=ARM_CV_IMAGE_INIT(DSTW,DSTH,dst);                   \
+                                                                                    \
+    start = time_in_cycles();                                                       \
+    arm_image_resize_area_rgb24(&input,&output,scratch);                            \
+    end = time_in_cycles();                                                         \
+    cycles = end - start;                                                           \
+                                                                                    \
+    free(scratch);                                                                  \
+}
+
+#define RESIZE_NEAREST_GRAY8(TESTID,DSTW,DSTH)                                              \
+void test##TESTID(const unsigned char* inputs,                                              \
+                        unsigned char* &outputs,                                            \
+                        uint32_t &total_bytes,                                              \
+                        uint32_t testid,                                                    \
+                        long &cycles)                                                       \
+{                                                                                           \
+    long start,end;                                                                         \
+    uint32_t width,height;                                                                  \
+    int bufid = TENSOR_START + 0;                                                           \
+    (void)testid;                                                                           \
+                                                                                            \
+    get_img_dims(inputs,bufid,&width,&height);                                              \
+    uint32_t *scratch = (uint32_t*)malloc(arm_get_scratch_size_resize_nearest(DSTW));       \
+                                                                                            \
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(DSTH,DSTW)               \
+                                                            ,kIMG_GRAY8_TYPE)               \
+                                          };                                                \
+                                                                                            \
+                                                                                            \
+    outputs = create_write_buffer(desc,total_bytes);                                        \
+                                                                                            \
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                               \
+    uint8_t *dst = Buffer<uint8_t>::write(outputs,0);                                       \
+                                                                                            \
+    const arm_cv_image_gray8_t input=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)src);         \
+                                                                                            \
+    arm_cv_image_gray8_t output=ARM_CV_IMAGE_INIT(DSTW,DSTH,dst);                           \
+                                                                                    \
+    start = time_in_cycles();                                                       \
+    arm_image_resize_nearest_gray8(&input,&output,scratch);                         \
+    end = time_in_cycles();                                                         \
+    cycles = end - start;                                                           \
+                                                                                    \
+    free(scratch);                                                                  \
+}
+
+#define RESIZE_NEAREST_BGR(TESTID,DSTW,DSTH)                                        \
+void test##TESTID(const unsigned char* inputs,                                      \
+                        unsigned char* &outputs,                                    \
+                        uint32_t &total_bytes,                                      \
+                        uint32_t testid,                                            \
+                        long &cycles)                                               \
+{                                                                                   \
+    long start,end;                                                                 \
+    uint32_t nb,channels,width,height,misc;                                         \
+    int bufid = TENSOR_START + 2;                                                   \
+    (void)testid;                                                                   \
+                                                                                    \
+    get_buffer_shape(inputs,bufid,&nb,&channels,&height,&width,&misc);              \
+    uint32_t *scratch = (uint32_t*)malloc(arm_get_scratch_size_resize_nearest(DSTW));\
+                                                                                    \
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(3,DSTH,DSTW)     \
+                                                            ,kIMG_NUMPY_TYPE_UINT8) \
+                                          };                                        \
+                                                                                    \
+                                                                                    \
+    outputs = create_write_buffer(desc,total_bytes);                                \
+                                                                                    \
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                       \
+    uint8_t *dst = Buffer<uint8_t>::write(outputs,0);                               \
+                                                                                    \
+    const arm_cv_image_bgr_8U3C_t input=ARM_CV_IMAGE_INIT(width,height,             \
+                                                          (uint8_t*)src);           \
+                                                                                    \
+    arm_cv_image_bgr_8U3C_t output=ARM_CV_IMAGE_INIT(DSTW,DSTH,dst);                \
+                                                                                    \
+    start = time_in_cycles();                                                       \
+    arm_image_resize_nearest_bgr_8U3C(&input,&output,scratch);                      \
+    end = time_in_cycles();                                                         \
+    cycles = end - start;                                                           \
+                                                                                    \
+    free(scratch);                                                                  \
+}
+
+#define RESIZE_NEAREST_RGB(TESTID,DSTW,DSTH)                                        \
+void test##TESTID(const unsigned char* inputs,                                      \
+                        unsigned char* &outputs,                                    \
+                        uint32_t &total_bytes,                                      \
+                        uint32_t testid,                                            \
+                        long &cycles)                                               \
+{                                                                                   \
+    long start,end;                                                                 \
+    uint32_t width,height;                                                          \
+    int bufid = TENSOR_START + 1;                                                   \
+    (void)testid;                                                                   \
+                                                                                    \
+    get_img_dims(inputs,bufid,&width,&height);                                      \
+    uint32_t *scratch = (uint32_t*)malloc(arm_get_scratch_size_resize_nearest(DSTW));\
+                                                                                    \
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(DSTH,DSTW)       \
+                                                            ,kIMG_RGB_TYPE)         \
+                                          };                                        \
+                                                                                    \
+                                                                                    \
+    outputs = create_write_buffer(desc,total_bytes);                                \
+                                                                                    \
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                       \
+    uint8_t *dst = Buffer<uint8_t>::write(outputs,0);                               \
+                                                                                    \
+    const arm_cv_image_rgb24_t input=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)src); \
+                                                                                    \
+    arm_cv_image_rgb24_t output=ARM_CV_IMAGE_INIT(DSTW,DSTH,dst);                   \
+                                                                                    \
+    start = time_in_cycles();                                                       \
+    arm_image_resize_nearest_rgb24(&input,&output,scratch);                         \
+    end = time_in_cycles();                                                         \
+    cycles = end - start;                                                           \
+                                                                                    \
+    free(scratch);                                                                  \
+}
+
 GRAY8_CROP(0,15,15,113,113);
 GRAY8_CROP(1,16,16,112,112);
 GRAY8_CROP(2,32,32,96,96);
@@ -253,6 +869,733 @@ RESIZE_BGR_to_RGB(27,47,17);
 RESIZE_BGR_to_RGB(28,150,150);
 RESIZE_BGR_to_RGB(29,256,256);
 
+INTEGRAL_GRAY8(30,128);
+
+GRAY8_VIEW(31,16,60,112,68);
+RGB24_VIEW(32,15,15,113,113);
+
+RESIZE_GRAY8_FIXP(33,64,64);
+RESIZE_GRAY8_FIXP(34,47,17);
+RESIZE_GRAY8_FIXP(35,150,150);
+
+RESIZE_BGR_FIXP(36,64,64);
+RESIZE_BGR_FIXP(37,47,17);
+RESIZE_BGR_FIXP(38,150,150);
+
+RESIZE_RGB_FIXP(39,64,64);
+RESIZE_RGB_FIXP(40,47,17);
+RESIZE_RGB_FIXP(41,150,150);
+
+RESIZE_GRAY8_PLAN(42,47,17);
+RESIZE_BGR_PLAN(43,47,17);
+RESIZE_RGB_PLAN(44,47,17);
+
+RESIZE_AREA_GRAY8(45,64,64);
+RESIZE_AREA_GRAY8(46,32,16);
+RESIZE_AREA_GRAY8(47,47,17);
+RESIZE_AREA_BGR(48,64,64);
+RESIZE_AREA_BGR(49,47,17);
+RESIZE_AREA_RGB(50,32,32);
+RESIZE_AREA_RGB(51,47,17);
+
+RESIZE_NEAREST_GRAY8(52,47,17);
+RESIZE_NEAREST_GRAY8(53,150,150);
+RESIZE_NEAREST_BGR(54,47,17);
+RESIZE_NEAREST_BGR(55,150,150);
+RESIZE_NEAREST_RGB(56,47,17);
+RESIZE_NEAREST_RGB(57,150,150);
+
+#define RESIZE_YUV420_TO_RGB_FIXP(TESTID,DSTW,DSTH)                                 \
+void test##TESTID(const unsigned char* inputs,                                      \
+                        unsigned char* &outputs,                                    \
+                        uint32_t &total_bytes,                                      \
+                        uint32_t testid,                                            \
+                        long &cycles)                                               \
+{                                                                                   \
+    long start,end;                                                                 \
+    uint32_t width,height;                                                          \
+    int bufid = TENSOR_START + 3;                                                   \
+    (void)testid;                                                                   \
+    uint32_t scratch_size = arm_get_scratch_size_resize_yuv420_to_rgb24_fixp(DSTW); \
+    uint16_t *p_lines = (uint16_t*)malloc(scratch_size);                            \
+                                                                                    \
+    /* YUV is recorded as a bidimensional tensor */                                 \
+    get_img_dims(inputs,bufid,&width,&height);                                      \
+                                                                                    \
+    /* Convert to image height from YUV height */                                   \
+    height = height * 2 / 3;                                                        \
+                                                                                    \
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(DSTH,DSTW)       \
+                                                            ,kIMG_RGB_TYPE)         \
+                                          };                                        \
+                                                                                    \
+                                                                                    \
+    outputs = create_write_buffer(desc,total_bytes);                                \
+                                                                                    \
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                       \
+    uint8_t *dst = Buffer<uint8_t>::write(outputs,0);                               \
+                                                                                    \
+    const arm_cv_image_yuv420_t input=ARM_CV_IMAGE_INIT(width,height,               \
+                                                        (uint8_t*)src);             \
+                                                                                    \
+    arm_cv_image_rgb24_t output=ARM_CV_IMAGE_INIT(DSTW,DSTH,dst);                   \
+                                                                                    \
+    start = time_in_cycles();                                                       \
+    arm_image_resize_yuv420_to_rgb24_fixp(&input,&output,p_lines);                  \
+    end = time_in_cycles();                                                         \
+    cycles = end - start;                                                           \
+                                                                                    \
+    free(p_lines);                                                                  \
+}
+
+RESIZE_YUV420_TO_RGB_FIXP(58,64,64);
+RESIZE_YUV420_TO_RGB_FIXP(59,47,17);
+RESIZE_YUV420_TO_RGB_FIXP(60,150,150);
+
+// Normalization of the ImageNet models, quantized like a TFLM int8 input
+static const arm_cv_tensor_norm_t tensor_norm_imagenet = {{123.675f,116.28f,103.53f},
+                                                          {1.0f/58.395f,1.0f/57.12f,1.0f/57.375f},
+                                                          0.0186f,
+                                                          -14};
+
+// Pixels mapped to [-1,1], quantized with a zero point of 128
+static const arm_cv_tensor_norm_t tensor_norm_unit = {{127.5f,127.5f,127.5f},
+                                                      {1.0f/127.5f,1.0f/127.5f,1.0f/127.5f},
+                                                      1.0f/128.0f,
+                                                      128};
+
+static Shape tensor_shape(const arm_cv_tensor_layout_t layout,
+                          uint32_t nb,uint32_t height,uint32_t width)
+{
+    if (layout == ARM_CV_TENSOR_NCHW)
+    {
+        return(Shape(nb,height,width));
+    }
+    return(Shape(height,width,nb));
+}
+
+#define GRAY8_TO_TENSOR(TESTID,SUFFIX,ELEMTYPE,BUFTYPE,LAYOUT,NORM)                 \
+void test##TESTID(const unsigned char* inputs,                                      \
+                        unsigned char* &outputs,                                    \
+                        uint32_t &total_bytes,                                      \
+                        uint32_t testid,                                            \
+                        long &cycles)                                               \
+{                                                                                   \
+    long start,end;                                                                 \
+    uint32_t width,height;                                                          \
+    int bufid = TENSOR_START + 0;                                                   \
+    (void)testid;                                                                   \
+                                                                                    \
+    get_img_dims(inputs,bufid,&width,&height);                                      \
+                                                                                    \
+    ELEMTYPE lut[1 * ARM_CV_TENSOR_LUT_LENGTH];                                     \
+    arm_cv_tensor_plan_##SUFFIX##_t plan;                                           \
+                                                                                    \
+    std::vector<BufferDescription> desc = {BufferDescription(tensor_shape(LAYOUT,1, \
+                                                              height,width)         \
+                                                            ,BUFTYPE)               \
+                                          };                                        \
+                                                                                    \
+                                                                                    \
+    outputs = create_write_buffer(desc,total_bytes);                                \
+                                                                                    \
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                       \
+    ELEMTYPE *dst = Buffer<ELEMTYPE>::write(outputs,0);                             \
+                                                                                    \
+    const arm_cv_image_gray8_t input=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)src); \
+                                                                                    \
+    arm_cv_tensor_plan_init_##SUFFIX(&plan,&NORM,1,LAYOUT,lut);                     \
+                                                                                    \
+    start = time_in_cycles();                                                       \
+    arm_gray8_to_tensor_##SUFFIX(&input,&plan,dst);                                 \
+    end = time_in_cycles();                                                         \
+    cycles = end - start;                                                           \
+}
+
+#define RGB_TO_TENSOR(TESTID,SUFFIX,ELEMTYPE,BUFTYPE,LAYOUT,NORM)                   \
+void test##TESTID(const unsigned char* inputs,                                      \
+                        unsigned char* &outputs,                                    \
+                        uint32_t &total_bytes,                                      \
+                        uint32_t testid,                                            \
+                        long &cycles)                                               \
+{                                                                                   \
+    long start,end;                                                                 \
+    uint32_t width,height;                                                          \
+    int bufid = TENSOR_START + 1;                                                   \
+    (void)testid;                                                                   \
+                                                                                    \
+    get_img_dims(inputs,bufid,&width,&height);                                      \
+                                                                                    \
+    ELEMTYPE lut[3 * ARM_CV_TENSOR_LUT_LENGTH];                                     \
+    arm_cv_tensor_plan_##SUFFIX##_t plan;                                           \
+                                                                                    \
+    std::vector<BufferDescription> desc = {BufferDescription(tensor_shape(LAYOUT,3, \
+                                                              height,width)         \
+                                                            ,BUFTYPE)               \
+                                          };                                        \
+                                                                                    \
+                                                                                    \
+    outputs = create_write_buffer(desc,total_bytes);                                \
+                                                                                    \
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                       \
+    ELEMTYPE *dst = Buffer<ELEMTYPE>::write(outputs,0);                             \
+                                                                                    \
+    const arm_cv_image_rgb24_t input=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)src); \
+                                                                                    \
+    arm_cv_tensor_plan_init_##SUFFIX(&plan,&NORM,3,LAYOUT,lut);                     \
+                                                                                    \
+    start = time_in_cycles();                                                       \
+    arm_rgb24_to_tensor_##SUFFIX(&input,&plan,dst);                                 \
+    end = time_in_cycles();                                                         \
+    cycles = end - start;                                                           \
+}
+
+#define BGR_TO_TENSOR(TESTID,SUFFIX,ELEMTYPE,BUFTYPE,LAYOUT,NORM)                   \
+void test##TESTID(const unsigned char* inputs,                                      \
+                        unsigned char* &outputs,                                    \
+                        uint32_t &total_bytes,                                      \
+                        uint32_t testid,                                            \
+                        long &cycles)                                               \
+{                                                                                   \
+    long start,end;                                                                 \
+    uint32_t nb,channels,width,height,misc;                                         \
+    int bufid = TENSOR_START + 2;                                                   \
+    (void)testid;                                                                   \
+                                                                                    \
+    get_buffer_shape(inputs,bufid,&nb,&channels,&height,&width,&misc);              \
+                                                                                    \
+    ELEMTYPE lut[3 * ARM_CV_TENSOR_LUT_LENGTH];                                     \
+    arm_cv_tensor_plan_##SUFFIX##_t plan;                                           \
+                                                                                    \
+    std::vector<BufferDescription> desc = {BufferDescription(tensor_shape(LAYOUT,3, \
+                                                              height,width)         \
+                                                            ,BUFTYPE)               \
+                                          };                                        \
+                                                                                    \
+                                                                                    \
+    outputs = create_write_buffer(desc,total_bytes);                                \
+                                                                                    \
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                       \
+    ELEMTYPE *dst = Buffer<ELEMTYPE>::write(outputs,0);                             \
+                                                                                    \
+    const arm_cv_image_bgr_8U3C_t input=ARM_CV_IMAGE_INIT(width,height,             \
+                                                          (uint8_t*)src);           \
+                                                                                    \
+    arm_cv_tensor_plan_init_##SUFFIX(&plan,&NORM,3,LAYOUT,lut);                     \
+                                                                                    \
+    start = time_in_cycles();                                                       \
+    arm_bgr_8U3C_to_tensor_##SUFFIX(&input,&plan,dst);                              \
+    end = time_in_cycles();                                                         \
+    cycles = end - start;                                                           \
+}
+
+RGB_TO_TENSOR(61,s8,int8_t,kIMG_NUMPY_TYPE_SINT8,ARM_CV_TENSOR_NHWC,tensor_norm_imagenet);
+BGR_TO_TENSOR(62,s8,int8_t,kIMG_NUMPY_TYPE_SINT8,ARM_CV_TENSOR_NCHW,tensor_norm_imagenet);
+GRAY8_TO_TENSOR(63,u8,uint8_t,kIMG_NUMPY_TYPE_UINT8,ARM_CV_TENSOR_NHWC,tensor_norm_unit);
+RGB_TO_TENSOR(64,f32,float32_t,kIMG_NUMPY_TYPE_F32,ARM_CV_TENSOR_NCHW,tensor_norm_imagenet);
+BGR_TO_TENSOR(65,u8,uint8_t,kIMG_NUMPY_TYPE_UINT8,ARM_CV_TENSOR_NHWC,tensor_norm_unit);
+
+// NV12 (uFirst = 1) or NV21 (uFirst = 0) copy of a packed I420 image
+static uint8_t* i420_to_semi_planar(const uint8_t *src,
+                                    uint32_t width,uint32_t height,int uFirst)
+{
+    const uint32_t chroma = (width >> 1) * (height >> 1);
+    const uint8_t *pU = src + width * height;
+    const uint8_t *pV = pU + chroma;
+    uint8_t *dst = (uint8_t*)malloc(width * height + 2 * chroma);
+    uint8_t *pUV = dst + width * height;
+
+    memcpy(dst,src,width * height);
+    for(uint32_t i=0;i<chroma;i++)
+    {
+        pUV[2*i]   = uFirst ? pU[i] : pV[i];
+        pUV[2*i+1] = uFirst ? pV[i] : pU[i];
+    }
+    return(dst);
+}
+
+#define SEMI_PLANAR_TO_GRAY8(TESTID,FMT,UFIRST)                                     \
+void test##TESTID(const unsigned char* inputs,                                      \
+                        unsigned char* &outputs,                                    \
+                        uint32_t &total_bytes,                                      \
+                        uint32_t testid,                                            \
+                        long &cycles)                                               \
+{                                                                                   \
+    long start,end;                                                                 \
+    uint32_t width,height;                                                          \
+    int bufid = TENSOR_START + 3;                                                   \
+    (void)testid;                                                                   \
+                                                                                    \
+    /* YUV is recorded as a bidimensional tensor */                                 \
+    get_img_dims(inputs,bufid,&width,&height);                                      \
+                                                                                    \
+    /* Convert to image height from YUV height */                                   \
+    height = height * 2 / 3;                                                        \
+                                                                                    \
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(height,width)    \
+                                                            ,kIMG_GRAY8_TYPE)       \
+                                          };                                        \
+                                                                                    \
+                                                                                    \
+    outputs = create_write_buffer(desc,total_bytes);                                \
+                                                                                    \
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                       \
+    uint8_t *dst = Buffer<uint8_t>::write(outputs,0);                               \
+    uint8_t *semi = i420_to_semi_planar(src,width,height,UFIRST);                   \
+                                                                                    \
+    const arm_cv_image_##FMT##_t input=ARM_CV_IMAGE_INIT(width,height,semi);        \
+                                                                                    \
+    arm_cv_image_gray8_t output=ARM_CV_IMAGE_INIT(width,height,dst);                \
+                                                                                    \
+    start = time_in_cycles();                                                       \
+    arm_##FMT##_to_gray8(&input,&output);                                           \
+    end = time_in_cycles();                                                         \
+    cycles = end - start;                                                           \
+                                                                                    \
+    free(semi);                                                                     \
+}
+
+#define SEMI_PLANAR_TO_RGB(TESTID,FMT,UFIRST)                                       \
+void test##TESTID(const unsigned char* inputs,                                      \
+                        unsigned char* &outputs,                                    \
+                        uint32_t &total_bytes,                                      \
+                        uint32_t testid,                                            \
+                        long &cycles)                                               \
+{                                                                                   \
+    long start,end;                                                                 \
+    uint32_t width,height;                                                          \
+    int bufid = TENSOR_START + 3;                                                   \
+    (void)testid;                                                                   \
+                                                                                    \
+    /* YUV is recorded as a bidimensional tensor */                                 \
+    get_img_dims(inputs,bufid,&width,&height);                                      \
+                                                                                    \
+    /* Convert to image height from YUV height */                                   \
+    height = height * 2 / 3;                                                        \
+                                                                                    \
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(height,width)    \
+                                                            ,kIMG_RGB_TYPE)         \
+                                          };                                        \
+                                                                                    \
+                                                                                    \
+    outputs = create_write_buffer(desc,total_bytes);                                \
+                                                                                    \
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                       \
+    uint8_t *dst = Buffer<uint8_t>::write(outputs,0);                               \
+    uint8_t *semi = i420_to_semi_planar(src,width,height,UFIRST);                   \
+                                                                                    \
+    const arm_cv_image_##FMT##_t input=ARM_CV_IMAGE_INIT(width,height,semi);        \
+                                                                                    \
+    arm_cv_image_rgb24_t output=ARM_CV_IMAGE_INIT(width,height,dst);                \
+                                                                                    \
+    start = time_in_cycles();                                                       \
+    arm_##FMT##_to_rgb24(&input,&output);                                           \
+    end = time_in_cycles();                                                         \
+    cycles = end - start;                                                           \
+                                                                                    \
+    free(semi);                                                                     \
+}
+
+#define RESIZE_SEMI_PLANAR_TO_RGB_FIXP(TESTID,FMT,UFIRST,DSTW,DSTH)                 \
+void test##TESTID(const unsigned char* inputs,                                      \
+                        unsigned char* &outputs,                                    \
+                        uint32_t &total_bytes,                                      \
+                        uint32_t testid,                                            \
+                        long &cycles)                                               \
+{                                                                                   \
+    long start,end;                                                                 \
+    uint32_t width,height;                                                          \
+    int bufid = TENSOR_START + 3;                                                   \
+    (void)testid;                                                                   \
+                                                                                    \
+    /* YUV is recorded as a bidimensional tensor */                                 \
+    get_img_dims(inputs,bufid,&width,&height);                                      \
+                                                                                    \
+    /* Convert to image height from YUV height */                                   \
+    height = height * 2 / 3;                                                        \
+                                                                                    \
+    uint32_t scratch_size = arm_get_scratch_size_resize_yuv420_to_rgb24_fixp(DSTW); \
+    uint16_t *p_lines = (uint16_t*)malloc(scratch_size);                            \
+                                                                                    \
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(DSTH,DSTW)       \
+                                                            ,kIMG_RGB_TYPE)         \
+                                          };                                        \
+                                                                                    \
+                                                                                    \
+    outputs = create_write_buffer(desc,total_bytes);                                \
+                                                                                    \
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                       \
+    uint8_t *dst = Buffer<uint8_t>::write(outputs,0);                               \
+    uint8_t *semi = i420_to_semi_planar(src,width,height,UFIRST);                   \
+                                                                                    \
+    const arm_cv_image_##FMT##_t input=ARM_CV_IMAGE_INIT(width,height,semi);        \
+                                                                                    \
+    arm_cv_image_rgb24_t output=ARM_CV_IMAGE_INIT(DSTW,DSTH,dst);                   \
+                                                                                    \
+    start = time_in_cycles();                                                       \
+    arm_image_resize_##FMT##_to_rgb24_fixp(&input,&output,p_lines);                 \
+    end = time_in_cycles();                                                         \
+    cycles = end - start;                                                           \
+                                                                                    \
+    free(semi);                                                                     \
+    free(p_lines);                                                                  \
+}
+
+SEMI_PLANAR_TO_GRAY8(66,nv12,1);
+SEMI_PLANAR_TO_RGB(67,nv12,1);
+SEMI_PLANAR_TO_RGB(68,nv21,0);
+RESIZE_SEMI_PLANAR_TO_RGB_FIXP(69,nv12,1,47,17);
+RESIZE_SEMI_PLANAR_TO_RGB_FIXP(70,nv21,0,150,150);
+
+// YUYV (yFirst = 1) or UYVY (yFirst = 0) copy of the packed YUYV input.
+// Each row of the input has its own chroma
+static uint8_t* yuyv_to_yuv422(const uint8_t *src,
+                               uint32_t width,uint32_t height,int yFirst)
+{
+    uint8_t *dst = (uint8_t*)malloc(width * height * 2);
+
+    for(uint32_t k=0;k<width * height * 2;k+=2)
+    {
+        dst[k]   = yFirst ? src[k]   : src[k+1];
+        dst[k+1] = yFirst ? src[k+1] : src[k];
+    }
+    return(dst);
+}
+
+// The top left WIDTH x HEIGHT part of the image is converted.
+// With a width which is not a multiple of 32, the tails of the rows are tested
+#define YUV422_TO_GRAY8(TESTID,FMT,YFIRST,WIDTH,HEIGHT)                             \
+void test##TESTID(const unsigned char* inputs,                                      \
+                        unsigned char* &outputs,                                    \
+                        uint32_t &total_bytes,                                      \
+                        uint32_t testid,                                            \
+                        long &cycles)                                               \
+{                                                                                   \
+    long start,end;                                                                 \
+    uint32_t width,height;                                                          \
+    int bufid = TENSOR_START + 4;                                                   \
+    (void)testid;                                                                   \
+                                                                                    \
+    /* YUYV is recorded as a (height,width,2) tensor */                             \
+    get_img_dims(inputs,bufid,&width,&height);                                      \
+                                                                                    \
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(HEIGHT,WIDTH)    \
+                                                            ,kIMG_GRAY8_TYPE)       \
+                                          };                                        \
+                                                                                    \
+                                                                                    \
+    outputs = create_write_buffer(desc,total_bytes);                                \
+                                                                                    \
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                       \
+    uint8_t *dst = Buffer<uint8_t>::write(outputs,0);                               \
+    uint8_t *packed = yuyv_to_yuv422(src,width,height,YFIRST);                      \
+                                                                                    \
+    const arm_cv_image_##FMT##_t input={(uint16_t)WIDTH,                            \
+                                       (uint16_t)HEIGHT,                            \
+                                       packed,                                      \
+                                       width*2};                                    \
+                                                                                    \
+    arm_cv_image_gray8_t output=ARM_CV_IMAGE_INIT(WIDTH,HEIGHT,dst);                \
+                                                                                    \
+    start = time_in_cycles();                                                       \
+    arm_##FMT##_to_gray8(&input,&output);                                           \
+    end = time_in_cycles();                                                         \
+    cycles = end - start;                                                           \
+                                                                                    \
+    free(packed);                                                                   \
+}
+
+#define YUV422_TO_RGB(TESTID,FMT,YFIRST,WIDTH,HEIGHT)                               \
+void test##TESTID(const unsigned char* inputs,                                      \
+                        unsigned char* &outputs,                                    \
+                        uint32_t &total_bytes,                                      \
+                        uint32_t testid,                                            \
+                        long &cycles)                                               \
+{                                                                                   \
+    long start,end;                                                                 \
+    uint32_t width,height;                                                          \
+    int bufid = TENSOR_START + 4;                                                   \
+    (void)testid;                                                                   \
+                                                                                    \
+    /* YUYV is recorded as a (height,width,2) tensor */                             \
+    get_img_dims(inputs,bufid,&width,&height);                                      \
+                                                                                    \
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(HEIGHT,WIDTH)    \
+                                                            ,kIMG_RGB_TYPE)         \
+                                          };                                        \
+                                                                                    \
+                                                                                    \
+    outputs = create_write_buffer(desc,total_bytes);                                \
+                                                                                    \
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                       \
+    uint8_t *dst = Buffer<uint8_t>::write(outputs,0);                               \
+    uint8_t *packed = yuyv_to_yuv422(src,width,height,YFIRST);                      \
+                                                                                    \
+    const arm_cv_image_##FMT##_t input={(uint16_t)WIDTH,                            \
+                                       (uint16_t)HEIGHT,                            \
+                                       packed,                                      \
+                                       width*2};                                    \
+                                                                                    \
+    arm_cv_image_rgb24_t output=ARM_CV_IMAGE_INIT(WIDTH,HEIGHT,dst);                \
+                                                                                    \
+    start = time_in_cycles();                                                       \
+    arm_##FMT##_to_rgb24(&input,&output);                                           \
+    end = time_in_cycles();                                                         \
+    cycles = end - start;                                                           \
+                                                                                    \
+    free(packed);                                                                   \
+}
+
+#define YUV422_TO_TENSOR(TESTID,FMT,YFIRST,SUFFIX,ELEMTYPE,BUFTYPE,LAYOUT,NORM,WIDTH,HEIGHT) \
+void test##TESTID(const unsigned char* inputs,                                      \
+                        unsigned char* &outputs,                                    \
+                        uint32_t &total_bytes,                                      \
+                        uint32_t testid,                                            \
+                        long &cycles)                                               \
+{                                                                                   \
+    long start,end;                                                                 \
+    uint32_t width,height;                                                          \
+    int bufid = TENSOR_START + 4;                                                   \
+    (void)testid;                                                                   \
+                                                                                    \
+    /* YUYV is recorded as a (height,width,2) tensor */                             \
+    get_img_dims(inputs,bufid,&width,&height);                                      \
+                                                                                    \
+    ELEMTYPE lut[3 * ARM_CV_TENSOR_LUT_LENGTH];                                     \
+    arm_cv_tensor_plan_##SUFFIX##_t plan;                                           \
+    uint8_t *scratch = (uint8_t*)malloc(WIDTH * 3);                                 \
+                                                                                    \
+    std::vector<BufferDescription> desc = {BufferDescription(tensor_shape(LAYOUT,3, \
+                                                              HEIGHT,WIDTH)         \
+                                                            ,BUFTYPE)               \
+                                          };                                        \
+                                                                                    \
+                                                                                    \
+    outputs = create_write_buffer(desc,total_bytes);                                \
+                                                                                    \
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                       \
+    ELEMTYPE *dst = Buffer<ELEMTYPE>::write(outputs,0);                             \
+    uint8_t *packed = yuyv_to_yuv422(src,width,height,YFIRST);                      \
+                                                                                    \
+    const arm_cv_image_##FMT##_t input={(uint16_t)WIDTH,                            \
+                                       (uint16_t)HEIGHT,                            \
+                                       packed,                                      \
+                                       width*2};                                    \
+                                                                                    \
+    arm_cv_tensor_plan_init_##SUFFIX(&plan,&NORM,3,LAYOUT,lut);                     \
+                                                                                    \
+    start = time_in_cycles();                                                       \
+    arm_##FMT##_to_tensor_##SUFFIX(&input,&plan,dst,scratch);                       \
+    end = time_in_cycles();                                                         \
+    cycles = end - start;                                                           \
+                                                                                    \
+    free(packed);                                                                   \
+    free(scratch);                                                                  \
+}
+
+YUV422_TO_GRAY8(71,yuyv,1,128,128);
+YUV422_TO_GRAY8(72,uyvy,0,128,128);
+YUV422_TO_RGB(73,yuyv,1,128,128);
+YUV422_TO_RGB(74,uyvy,0,128,128);
+YUV422_TO_TENSOR(75,yuyv,1,s8,int8_t,kIMG_NUMPY_TYPE_SINT8,ARM_CV_TENSOR_NHWC,tensor_norm_imagenet,128,128);
+YUV422_TO_TENSOR(76,uyvy,0,f32,float32_t,kIMG_NUMPY_TYPE_F32,ARM_CV_TENSOR_NCHW,tensor_norm_imagenet,128,128);
+
+// RGB565 copy of a packed RGB24 image, the low bits of the
+// components are truncated
+static uint16_t* rgb24_to_rgb565_copy(const uint8_t *src,
+                                      uint32_t width,uint32_t height)
+{
+    uint16_t *dst = (uint16_t*)malloc(width * height * sizeof(uint16_t));
+
+    for(uint32_t i=0;i<width*height;i++)
+    {
+        dst[i] = (uint16_t)(((src[3*i] >> 3) << 11) |
+                            ((src[3*i+1] >> 2) << 5) |
+                             (src[3*i+2] >> 3));
+    }
+    return(dst);
+}
+
+// The top left WIDTH x HEIGHT part of the image is converted
+#define GRAY8_TO_RGB565(TESTID,WIDTH,HEIGHT)                                        \
+void test##TESTID(const unsigned char* inputs,                                      \
+                        unsigned char* &outputs,                                    \
+                        uint32_t &total_bytes,                                      \
+                        uint32_t testid,                                            \
+                        long &cycles)                                               \
+{                                                                                   \
+    long start,end;                                                                 \
+    uint32_t width,height;                                                          \
+    int bufid = TENSOR_START + 0;                                                   \
+    (void)testid;                                                                   \
+                                                                                    \
+    get_img_dims(inputs,bufid,&width,&height);                                      \
+                                                                                    \
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(HEIGHT,WIDTH)    \
+                                                            ,kIMG_NUMPY_TYPE_UINT16)\
+                                          };                                        \
+                                                                                    \
+                                                                                    \
+    outputs = create_write_buffer(desc,total_bytes);                                \
+                                                                                    \
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                       \
+    uint16_t *dst = Buffer<uint16_t>::write(outputs,0);                             \
+                                                                                    \
+    const arm_cv_image_gray8_t input={(uint16_t)WIDTH,                              \
+                                       (uint16_t)HEIGHT,                            \
+                                       (uint8_t*)src,                               \
+                                       width};                                      \
+                                                                                    \
+    arm_cv_image_rgb565_t output=ARM_CV_IMAGE_INIT(WIDTH,HEIGHT,dst);               \
+                                                                                    \
+    start = time_in_cycles();                                                       \
+    arm_gray8_to_rgb565(&input,&output);                                            \
+    end = time_in_cycles();                                                         \
+    cycles = end - start;                                                           \
+}
+
+#define RGB_TO_RGB565(TESTID,WIDTH,HEIGHT)                                          \
+void test##TESTID(const unsigned char* inputs,                                      \
+                        unsigned char* &outputs,                                    \
+                        uint32_t &total_bytes,                                      \
+                        uint32_t testid,                                            \
+                        long &cycles)                                               \
+{                                                                                   \
+    long start,end;                                                                 \
+    uint32_t width,height;                                                          \
+    int bufid = TENSOR_START + 1;                                                   \
+    (void)testid;                                                                   \
+                                                                                    \
+    get_img_dims(inputs,bufid,&width,&height);                                      \
+                                                                                    \
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(HEIGHT,WIDTH)    \
+                                                            ,kIMG_NUMPY_TYPE_UINT16)\
+                                          };                                        \
+                                                                                    \
+                                                                                    \
+    outputs = create_write_buffer(desc,total_bytes);                                \
+                                                                                    \
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                       \
+    uint16_t *dst = Buffer<uint16_t>::write(outputs,0);                             \
+                                                                                    \
+    const arm_cv_image_rgb24_t input={(uint16_t)WIDTH,                              \
+                                       (uint16_t)HEIGHT,                            \
+                                       (uint8_t*)src,                               \
+                                       width*3};                                    \
+                                                                                    \
+    arm_cv_image_rgb565_t output=ARM_CV_IMAGE_INIT(WIDTH,HEIGHT,dst);               \
+                                                                                    \
+    start = time_in_cycles();                                                       \
+    arm_rgb24_to_rgb565(&input,&output);                                            \
+    end = time_in_cycles();                                                         \
+    cycles = end - start;                                                           \
+}
+
+#define RGB565_TO_RGB(TESTID,WIDTH,HEIGHT)                                          \
+void test##TESTID(const unsigned char* inputs,                                      \
+                        unsigned char* &outputs,                                    \
+                        uint32_t &total_bytes,                                      \
+                        uint32_t testid,                                            \
+                        long &cycles)                                               \
+{                                                                                   \
+    long start,end;                                                                 \
+    uint32_t width,height;                                                          \
+    int bufid = TENSOR_START + 1;                                                   \
+    (void)testid;                                                                   \
+                                                                                    \
+    get_img_dims(inputs,bufid,&width,&height);                                      \
+                                                                                    \
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(HEIGHT,WIDTH)    \
+                                                            ,kIMG_RGB_TYPE)         \
+                                          };                                        \
+                                                                                    \
+                                                                                    \
+    outputs = create_write_buffer(desc,total_bytes);                                \
+                                                                                    \
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                       \
+    uint8_t *dst = Buffer<uint8_t>::write(outputs,0);                               \
+    uint16_t *rgb565 = rgb24_to_rgb565_copy(src,width,height);                      \
+                                                                                    \
+    const arm_cv_image_rgb565_t input={(uint16_t)WIDTH,                             \
+                                       (uint16_t)HEIGHT,                            \
+                                       rgb565,                                      \
+                                       width};                                      \
+                                                                                    \
+    arm_cv_image_rgb24_t output=ARM_CV_IMAGE_INIT(WIDTH,HEIGHT,dst);                \
+                                                                                    \
+    start = time_in_cycles();                                                       \
+    arm_rgb565_to_rgb24(&input,&output);                                            \
+    end = time_in_cycles();                                                         \
+    cycles = end - start;                                                           \
+                                                                                    \
+    free(rgb565);                                                                   \
+}
+
+#define RGB565_TO_GRAY8(TESTID,WIDTH,HEIGHT)                                        \
+void test##TESTID(const unsigned char* inputs,                                      \
+                        unsigned char* &outputs,                                    \
+                        uint32_t &total_bytes,                                      \
+                        uint32_t testid,                                            \
+                        long &cycles)                                               \
+{                                                                                   \
+    long start,end;                                                                 \
+    uint32_t width,height;                                                          \
+    int bufid = TENSOR_START + 1;                                                   \
+    (void)testid;                                                                   \
+                                                                                    \
+    get_img_dims(inputs,bufid,&width,&height);                                      \
+                                                                                    \
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(HEIGHT,WIDTH)    \
+                                                            ,kIMG_GRAY8_TYPE)       \
+                                          };                                        \
+                                                                                    \
+                                                                                    \
+    outputs = create_write_buffer(desc,total_bytes);                                \
+                                                                                    \
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);                       \
+    uint8_t *dst = Buffer<uint8_t>::write(outputs,0);                               \
+    uint16_t *rgb565 = rgb24_to_rgb565_copy(src,width,height);                      \
+                                                                                    \
+    const arm_cv_image_rgb565_t input={(uint16_t)WIDTH,                             \
+                                       (uint16_t)HEIGHT,                            \
+                                       rgb565,                                      \
+                                       width};                                      \
+                                                                                    \
+    arm_cv_image_gray8_t output=ARM_CV_IMAGE_INIT(WIDTH,HEIGHT,dst);                \
+                                                                                    \
+    start = time_in_cycles();                                                       \
+    arm_rgb565_to_gray8(&input,&output);                                            \
+    end = time_in_cycles();                                                         \
+    cycles = end - start;                                                           \
+                                                                                    \
+    free(rgb565);                                                                   \
+}
+
+GRAY8_TO_RGB565(77,128,128);
+RGB_TO_RGB565(78,128,128);
+RGB565_TO_RGB(79,128,128);
+RGB565_TO_GRAY8(80,128,128);
+
+// Ratios of 42.67 and 25.6
+RESIZE_AREA_GRAY8(81,3,5);
+RESIZE_AREA_RGB(82,5,3);
+
+INTEGRAL_GRAY8(83,127);
+INTEGRAL_SQUARED_GRAY8(84,128);
+INTEGRAL_SQUARED_GRAY8(85,127);
+
+// Same as 71 to 80 with a width which is not a multiple of 32
+YUV422_TO_GRAY8(86,yuyv,1,94,30);
+YUV422_TO_GRAY8(87,uyvy,0,94,30);
+YUV422_TO_RGB(88,yuyv,1,94,30);
+YUV422_TO_RGB(89,uyvy,0,94,30);
+YUV422_TO_TENSOR(90,yuyv,1,s8,int8_t,kIMG_NUMPY_TYPE_SINT8,ARM_CV_TENSOR_NHWC,tensor_norm_imagenet,94,30);
+YUV422_TO_TENSOR(91,uyvy,0,f32,float32_t,kIMG_NUMPY_TYPE_F32,ARM_CV_TENSOR_NCHW,tensor_norm_imagenet,94,30);
+GRAY8_TO_RGB565(92,94,30);
+RGB_TO_RGB565(93,94,30);
+RGB565_TO_RGB(94,94,30);
+RGB565_TO_GRAY8(95,94,30);
+
 void run_test(const unsigned char* inputs,
               const uint32_t testid,
               const uint32_t funcid,
@@ -407,6 +1750,336 @@ void run_test(const unsigned char* inputs,
             // bgr 8U3C resize to rgb24
             test29(inputs,wbuf,total_bytes,testid,cycles);
             break;
+
+        case 30:
+            // gray8 integral
+            test30(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 31:
+            // gray8 view
+            test31(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 32:
+            // rgb24 view
+            test32(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 33:
+            // gray8 fixed point resize
+            test33(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 34:
+            // gray8 fixed point resize
+            test34(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 35:
+            // gray8 fixed point resize
+            test35(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 36:
+            // bgr 8U3C fixed point resize
+            test36(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 37:
+            // bgr 8U3C fixed point resize
+            test37(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 38:
+            // bgr 8U3C fixed point resize
+            test38(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 39:
+            // rgb24 fixed point resize
+            test39(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 40:
+            // rgb24 fixed point resize
+            test40(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 41:
+            // rgb24 fixed point resize
+            test41(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 42:
+            // gray8 resize with a plan
+            test42(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 43:
+            // bgr 8U3C resize with a plan
+            test43(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 44:
+            // rgb24 resize with a plan
+            test44(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 45:
+            // gray8 area resize
+            test45(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 46:
+            // gray8 area resize
+            test46(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 47:
+            // gray8 area resize
+            test47(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 48:
+            // bgr 8U3C area resize
+            test48(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 49:
+            // bgr 8U3C area resize
+            test49(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 50:
+            // rgb24 area resize
+            test50(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 51:
+            // rgb24 area resize
+            test51(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 52:
+            // gray8 nearest resize
+            test52(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 53:
+            // gray8 nearest resize
+            test53(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 54:
+            // bgr 8U3C nearest resize
+            test54(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 55:
+            // bgr 8U3C nearest resize
+            test55(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 56:
+            // rgb24 nearest resize
+            test56(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 57:
+            // rgb24 nearest resize
+            test57(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 58:
+            // yuv420 fixp resize to rgb24
+            test58(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 59:
+            // yuv420 fixp resize to rgb24
+            test59(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 60:
+            // yuv420 fixp resize to rgb24
+            test60(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 61:
+            // rgb24 to int8 tensor
+            test61(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 62:
+            // bgr 8U3C to int8 tensor
+            test62(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 63:
+            // gray8 to uint8 tensor
+            test63(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 64:
+            // rgb24 to float tensor
+            test64(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 65:
+            // bgr 8U3C to uint8 tensor
+            test65(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 66:
+            // nv12 to gray8
+            test66(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 67:
+            // nv12 to rgb24
+            test67(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 68:
+            // nv21 to rgb24
+            test68(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 69:
+            // nv12 fixp resize to rgb24
+            test69(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 70:
+            // nv21 fixp resize to rgb24
+            test70(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 71:
+            // yuyv to gray8
+            test71(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 72:
+            // uyvy to gray8
+            test72(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 73:
+            // yuyv to rgb24
+            test73(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 74:
+            // uyvy to rgb24
+            test74(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 75:
+            // yuyv to int8 tensor
+            test75(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 76:
+            // uyvy to float tensor
+            test76(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 77:
+            // gray8 to rgb565
+            test77(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 78:
+            // rgb24 to rgb565
+            test78(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 79:
+            // rgb565 to rgb24
+            test79(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 80:
+            // rgb565 to gray8
+            test80(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 81:
+            // gray8 area resize
+            test81(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 82:
+            // rgb24 area resize
+            test82(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 83:
+            // gray8 integral, odd width
+            test83(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 84:
+            // gray8 integral and squared integral
+            test84(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 85:
+            // gray8 integral and squared integral, odd width
+            test85(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 86:
+            // yuyv to gray8, 94x30
+            test86(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 87:
+            // uyvy to gray8, 94x30
+            test87(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 88:
+            // yuyv to rgb24, 94x30
+            test88(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 89:
+            // uyvy to rgb24, 94x30
+            test89(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 90:
+            // yuyv to int8 tensor, 94x30
+            test90(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 91:
+            // uyvy to float tensor, 94x30
+            test91(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 92:
+            // gray8 to rgb565, 94x30
+            test92(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 93:
+            // rgb24 to rgb565, 94x30
+            test93(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 94:
+            // rgb565 to rgb24, 94x30
+            test94(inputs,wbuf,total_bytes,testid,cycles);
+            break;
+
+        case 95:
+            // rgb565 to gray8, 94x30
+            test95(inputs,wbuf,total_bytes,testid,cycles);
+            break;
     }
 
 }
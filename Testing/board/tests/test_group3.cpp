@@ -5,10 +5,16 @@
 
 extern "C" {
     #include "cv/feature_detection.h"
+    #include "cv/linear_filters.h"
+    #include "cv/strip.h"
 }
 
 #if defined(TESTGROUP3)
 
+// Number of tests of the canny edge with sobel, the following tests
+// are using the first STANDARD_NB_IMGS images
+#define CANNY_SOBEL_NB_TESTS (11 * STANDARD_NB_IMGS + 5)
+
 
 void test_sobel(const unsigned char* inputs,
                  unsigned char* &outputs,
@@ -30,8 +36,8 @@ void test_sobel(const unsigned char* inputs,
     const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);
     uint8_t *dst = Buffer<uint8_t>::write(outputs,0);
 
-    const arm_cv_image_gray8_t input={(uint16_t)width,(uint16_t)height,(uint8_t*)src};
-    arm_cv_image_gray8_t output={(uint16_t)width,(uint16_t)height,(uint8_t*)dst};
+    const arm_cv_image_gray8_t input=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)src);
+    arm_cv_image_gray8_t output=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)dst);
 
     q15_t* Buffer_tmp_mag = (q15_t*)malloc(arm_cv_get_scratch_size_canny_sobel(input.width));
 
@@ -43,6 +49,226 @@ void test_sobel(const unsigned char* inputs,
 
     free(Buffer_tmp_mag);
 }
+void test_canny_gaussian_sobel(const unsigned char* inputs,
+                               unsigned char* &outputs,
+                               uint32_t &total_bytes,
+                               uint32_t test_id,
+                               long &cycles,
+                               int8_t borderType,
+                               uint8_t flags,
+                               uint32_t funcid)
+{
+    long start,end;
+    uint32_t width,height;
+    int bufid = TENSOR_START + test_id - CANNY_SOBEL_NB_TESTS - (funcid - 2) * STANDARD_NB_IMGS;
+
+    get_img_dims(inputs,bufid,&width,&height);
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(height,width)
+                                                            ,kIMG_GRAY8_TYPE)
+                                          };
+
+    outputs = create_write_buffer(desc,total_bytes);
+
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);
+    uint8_t *dst = Buffer<uint8_t>::write(outputs,0);
+
+    const arm_cv_image_gray8_t input=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)src);
+    arm_cv_image_gray8_t output=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)dst);
+
+    q15_t* Buffer_tmp = (q15_t*)malloc(arm_cv_get_scratch_size_canny_gaussian_sobel(input.width));
+
+    // The test to run is executed with some timing code.
+    start = time_in_cycles();
+    arm_cv_canny_edge_gaussian_sobel(&input,&output, Buffer_tmp, 33,78, borderType, flags);
+    end = time_in_cycles();
+    cycles = end - start;
+
+    free(Buffer_tmp);
+}
+
+void test_canny_sobel_flags(const unsigned char* inputs,
+                            unsigned char* &outputs,
+                            uint32_t &total_bytes,
+                            uint32_t test_id,
+                            long &cycles,
+                            uint8_t flags,
+                            uint32_t funcid)
+{
+    long start,end;
+    uint32_t width,height;
+    int bufid = TENSOR_START + test_id - CANNY_SOBEL_NB_TESTS - (funcid - 2) * STANDARD_NB_IMGS;
+
+    get_img_dims(inputs,bufid,&width,&height);
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(height,width)
+                                                            ,kIMG_GRAY8_TYPE)
+                                          };
+
+    outputs = create_write_buffer(desc,total_bytes);
+
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);
+    uint8_t *dst = Buffer<uint8_t>::write(outputs,0);
+
+    const arm_cv_image_gray8_t input=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)src);
+    arm_cv_image_gray8_t output=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)dst);
+
+    q15_t* Buffer_tmp = (q15_t*)malloc(arm_cv_get_scratch_size_canny_sobel(input.width));
+
+    // The test to run is executed with some timing code.
+    start = time_in_cycles();
+    arm_cv_canny_edge_sobel_flags(&input,&output, Buffer_tmp, 33,78, flags);
+    end = time_in_cycles();
+    cycles = end - start;
+
+    free(Buffer_tmp);
+}
+
+// When stackSize is 0, the stack contains 2 * width elements
+void test_canny_hysteresis(const unsigned char* inputs,
+                           unsigned char* &outputs,
+                           uint32_t &total_bytes,
+                           uint32_t test_id,
+                           long &cycles,
+                           bool gaussian,
+                           int8_t borderType,
+                           uint8_t flags,
+                           uint32_t stackSize,
+                           uint32_t funcid)
+{
+    long start,end;
+    uint32_t width,height;
+    int bufid = TENSOR_START + test_id - CANNY_SOBEL_NB_TESTS - (funcid - 2) * STANDARD_NB_IMGS;
+
+    get_img_dims(inputs,bufid,&width,&height);
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(height,width)
+                                                            ,kIMG_GRAY8_TYPE)
+                                          };
+
+    outputs = create_write_buffer(desc,total_bytes);
+
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);
+    uint8_t *dst = Buffer<uint8_t>::write(outputs,0);
+
+    const arm_cv_image_gray8_t input=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)src);
+    arm_cv_image_gray8_t output=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)dst);
+
+    if (stackSize == 0)
+    {
+        stackSize = 2 * width;
+    }
+    uint32_t* stack = (uint32_t*)malloc(stackSize * sizeof(uint32_t));
+    q15_t* Buffer_tmp;
+    if (gaussian)
+    {
+        Buffer_tmp = (q15_t*)malloc(arm_cv_get_scratch_size_canny_gaussian_sobel(input.width));
+    }
+    else
+    {
+        Buffer_tmp = (q15_t*)malloc(arm_cv_get_scratch_size_canny_sobel(input.width));
+    }
+
+    // The test to run is executed with some timing code.
+    start = time_in_cycles();
+    if (gaussian)
+    {
+        arm_cv_canny_edge_gaussian_sobel_hysteresis(&input,&output, Buffer_tmp, 33,78, borderType, flags,
+                                                    stack, stackSize);
+    }
+    else
+    {
+        arm_cv_canny_edge_sobel_hysteresis(&input,&output, Buffer_tmp, 33,78, flags, stack, stackSize);
+    }
+    end = time_in_cycles();
+    cycles = end - start;
+
+    free(Buffer_tmp);
+    free(stack);
+}
+
+// The image is processed by strips of 16 rows. The first output is the image processed
+// in one call and the second one the image processed by strips. Each strip is written
+// in its own buffer followed by canary bytes to detect the writes after the strip
+void test_canny_strip(const unsigned char* inputs,
+                      unsigned char* &outputs,
+                      uint32_t &total_bytes,
+                      uint32_t test_id,
+                      long &cycles,
+                      bool gaussian,
+                      int8_t borderType,
+                      uint8_t flags,
+                      uint32_t funcid)
+{
+    long start,end;
+    uint32_t width,height;
+    const uint16_t stripHeight = 16;
+    const uint16_t radius = gaussian ? ARM_CV_STRIP_RADIUS_CANNY_GAUSSIAN_SOBEL : ARM_CV_STRIP_RADIUS_CANNY_SOBEL;
+    int bufid = TENSOR_START + test_id - CANNY_SOBEL_NB_TESTS - (funcid - 2) * STANDARD_NB_IMGS;
+
+    get_img_dims(inputs,bufid,&width,&height);
+    std::vector<BufferDescription> desc = {BufferDescription(Shape(height,width)
+                                                            ,kIMG_GRAY8_TYPE),
+                                           BufferDescription(Shape(height,width)
+                                                            ,kIMG_GRAY8_TYPE)
+                                          };
+
+    outputs = create_write_buffer(desc,total_bytes);
+
+    const uint8_t *src = Buffer<uint8_t>::read(inputs,bufid);
+    uint8_t *dst = Buffer<uint8_t>::write(outputs,0);
+    uint8_t *dst_strip = Buffer<uint8_t>::write(outputs,1);
+
+    q15_t* Buffer_tmp;
+    if (gaussian)
+    {
+        Buffer_tmp = (q15_t*)malloc(arm_cv_get_scratch_size_canny_gaussian_sobel(width));
+    }
+    else
+    {
+        Buffer_tmp = (q15_t*)malloc(arm_cv_get_scratch_size_canny_sobel(width));
+    }
+
+    const arm_cv_image_gray8_t input=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)src);
+    arm_cv_image_gray8_t output=ARM_CV_IMAGE_INIT(width,height,(uint8_t*)dst);
+    if (gaussian)
+    {
+        arm_cv_canny_edge_gaussian_sobel(&input,&output, Buffer_tmp, 33,78, borderType, flags);
+    }
+    else
+    {
+        arm_cv_canny_edge_sobel_flags(&input,&output, Buffer_tmp, 33,78, flags);
+    }
+
+    // Only the processing of the strips is timed
+    cycles = 0;
+    for (uint32_t row = 0; row < height; row += stripHeight)
+    {
+        arm_cv_strip_t strip = {(uint16_t)height,(uint16_t)row};
+        uint16_t nbRows = (row + stripHeight > height) ? height - row : stripHeight;
+        uint16_t firstInputRow = arm_cv_get_strip_first_input_row(&strip,radius);
+        uint16_t nbInputRows = arm_cv_get_strip_nb_input_rows(&strip,nbRows,radius);
+        uint8_t *buf = canary_malloc(nbRows * width);
+
+        const arm_cv_image_gray8_t stripInput=ARM_CV_IMAGE_INIT(width,nbInputRows,
+                                                                (uint8_t*)&src[firstInputRow * width]);
+        arm_cv_image_gray8_t stripOutput=ARM_CV_IMAGE_INIT(width,nbRows,buf);
+
+        start = time_in_cycles();
+        if (gaussian)
+        {
+            arm_cv_canny_edge_gaussian_sobel_strip(&stripInput,&stripOutput,&strip, Buffer_tmp, 33,78, borderType, flags);
+        }
+        else
+        {
+            arm_cv_canny_edge_sobel_strip(&stripInput,&stripOutput,&strip, Buffer_tmp, 33,78, flags);
+        }
+        end = time_in_cycles();
+        cycles += end - start;
+
+        canary_copy_and_free(&dst_strip[row * width],&dst[row * width],buf,nbRows * width);
+    }
+
+    free(Buffer_tmp);
+}
+
 void run_test(const unsigned char* inputs,
               const uint32_t testid,
               const uint32_t funcid,
@@ -60,6 +286,52 @@ void run_test(const unsigned char* inputs,
         case 1:
             test_sobel(inputs,wbuf,total_bytes,testid,cycles);
             break;
+        case 2:
+            test_canny_gaussian_sobel(inputs,wbuf,total_bytes,testid,cycles,ARM_CV_BORDER_NEAREST,ARM_CV_CANNY_DEFAULT,funcid);
+            break;
+        case 3:
+            test_canny_gaussian_sobel(inputs,wbuf,total_bytes,testid,cycles,ARM_CV_BORDER_REFLECT,ARM_CV_CANNY_DEFAULT,funcid);
+            break;
+        case 4:
+            test_canny_gaussian_sobel(inputs,wbuf,total_bytes,testid,cycles,ARM_CV_BORDER_WRAP,ARM_CV_CANNY_DEFAULT,funcid);
+            break;
+        case 5:
+            test_canny_gaussian_sobel(inputs,wbuf,total_bytes,testid,cycles,ARM_CV_BORDER_WRAP,
+                                      ARM_CV_CANNY_OCTANT_DIRECTION | ARM_CV_CANNY_L1_GRADIENT,funcid);
+            break;
+        case 6:
+            test_canny_sobel_flags(inputs,wbuf,total_bytes,testid,cycles,
+                                   ARM_CV_CANNY_OCTANT_DIRECTION | ARM_CV_CANNY_L1_GRADIENT,funcid);
+            break;
+        case 7:
+            test_canny_gaussian_sobel(inputs,wbuf,total_bytes,testid,cycles,ARM_CV_BORDER_NEAREST,
+                                      ARM_CV_CANNY_OCTANT_DIRECTION | ARM_CV_CANNY_L1_GRADIENT,funcid);
+            break;
+        case 8:
+            test_canny_gaussian_sobel(inputs,wbuf,total_bytes,testid,cycles,ARM_CV_BORDER_REFLECT,
+                                      ARM_CV_CANNY_OCTANT_DIRECTION | ARM_CV_CANNY_L1_GRADIENT,funcid);
+            break;
+        case 9:
+            test_canny_hysteresis(inputs,wbuf,total_bytes,testid,cycles,true,ARM_CV_BORDER_NEAREST,
+                                  ARM_CV_CANNY_OCTANT_DIRECTION | ARM_CV_CANNY_L1_GRADIENT,0,funcid);
+            break;
+        case 10:
+            test_canny_hysteresis(inputs,wbuf,total_bytes,testid,cycles,false,ARM_CV_BORDER_NEAREST,
+                                  ARM_CV_CANNY_OCTANT_DIRECTION | ARM_CV_CANNY_L1_GRADIENT,0,funcid);
+            break;
+        case 11:
+            // Stack of 1 element to test the tracing when the stack is full
+            test_canny_hysteresis(inputs,wbuf,total_bytes,testid,cycles,true,ARM_CV_BORDER_NEAREST,
+                                  ARM_CV_CANNY_OCTANT_DIRECTION | ARM_CV_CANNY_L1_GRADIENT,1,funcid);
+            break;
+        case 12:
+            test_canny_strip(inputs,wbuf,total_bytes,testid,cycles,true,ARM_CV_BORDER_REFLECT,
+                             ARM_CV_CANNY_OCTANT_DIRECTION | ARM_CV_CANNY_L1_GRADIENT,funcid);
+            break;
+        case 13:
+            test_canny_strip(inputs,wbuf,total_bytes,testid,cycles,false,ARM_CV_BORDER_NEAREST,
+                             ARM_CV_CANNY_OCTANT_DIRECTION | ARM_CV_CANNY_L1_GRADIENT,funcid);
+            break;
     }
 
 }
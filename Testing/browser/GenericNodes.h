@@ -29,6 +29,7 @@
 
 #include <vector>
 #include <cstring>
+#include <cassert>
 #include <stdarg.h>
 /* 
 Defined in cg_status.h by default but user
@@ -418,6 +419,160 @@ class ImageFIFO<T,length,0,1>: public FIFOBase<T>
         const uint32_t mWidth,mHeight;
 };
 
+/*
+
+Ring of frames.
+
+In a vision graph, the producer and the consumer of a FIFO
+are exchanging full frames: the length of the FIFO is a multiple
+of the frame size and the initial delay is a number of frames.
+So a frame is never split by the end of the buffer and
+the FIFO can be used as a ring of frames
+without moving the unread data.
+
+The producer is writing directly into the next free slot and the 
+consumer is reading in place. With a length of two frames,
+it is a double buffer.
+
+The number of samples read or written must divide the length
+and the delay of the FIFO. It is checked with assert.
+
+The same implementation is used in synchronous and asynchronous mode.
+
+*/
+template<typename T, int length, int isArray=0, int isAsync = 0>
+class ImageRingFIFO;
+
+/* Buffer, same as the ImageFIFO buffer */
+template<typename T, int length, int isAsync>
+class ImageRingFIFO<T,length,1,isAsync>: public ImageFIFO<T,length,1,0>
+{
+    public:
+        using ImageFIFO<T,length,1,0>::ImageFIFO;
+};
+
+/* Real ring of frames, synchronous and asynchronous */
+template<typename T, int length, int isAsync>
+class ImageRingFIFO<T,length,0,isAsync>: public FIFOBase<T> 
+{
+    public:
+        explicit ImageRingFIFO(T *buffer,int delay,const uint32_t w,const uint32_t h):
+        mBuffer(buffer),
+        readPos(0),
+        writePos(delay % length),
+        nbSamples(delay),
+        mWidth(w),
+        mHeight(h) {};
+        explicit ImageRingFIFO(void *buffer,int delay,const uint32_t w,const uint32_t h):
+        mBuffer((T*)buffer),
+        readPos(0),
+        writePos(delay % length),
+        nbSamples(delay),
+        mWidth(w),
+        mHeight(h) {};
+
+        void setBuffer(T *buffer){mBuffer = buffer;};
+
+        int width()  const final {return mWidth;};
+        int height() const final {return mHeight;};
+
+        /* 
+        ImageRingFIFO are fixed and not made to be copied or moved.
+        */
+        ImageRingFIFO(const ImageRingFIFO&) = delete;
+        ImageRingFIFO(ImageRingFIFO&&) = delete;
+        ImageRingFIFO& operator=(const ImageRingFIFO&) = delete;
+        ImageRingFIFO& operator=(ImageRingFIFO&&) = delete;
+
+        /* 
+
+        Check for overflow must have been done
+        before using this function in asynchronous mode
+        
+        */
+        T * getWriteBuffer(int nb) final 
+        {
+            checkSlot(writePos,nb);
+            T *ret = mBuffer + writePos;
+            writePos += nb;
+            if (writePos >= length)
+            {
+                writePos = 0;
+            }
+            nbSamples += nb;
+            return(ret);
+        };
+
+        /* 
+        
+        Check for undeflow must have been done
+        before using this function in asynchronous mode
+        
+        */
+        T* getReadBuffer(int nb) final 
+        {
+            checkSlot(readPos,nb);
+            T *ret = mBuffer + readPos;
+            readPos += nb;
+            if (readPos >= length)
+            {
+                readPos = 0;
+            }
+            nbSamples -= nb;
+            return(ret);
+        }
+
+        bool willUnderflowWith(int nb) const final  
+        {
+            return((nbSamples - nb)<0);
+        }
+
+        bool willOverflowWith(int nb) const final  
+        {
+            return((nbSamples + nb)>length);
+        }
+
+        int nbSamplesInFIFO() const final   {return (nbSamples);};
+        int nbOfFreeSamplesInFIFO() const final   {return (length - nbSamples);};
+
+
+        #ifdef DEBUGSCHED
+        void dump()
+        {
+            int nb=0;
+            std::cout << std::endl;
+            std::cout << "FIFO nb samples = " << nbSamples << std::endl;
+            for(int i=0; i < length ; i++)
+            {
+                std::cout << (typename Debug<T>::type)mBuffer[i] << " ";
+                nb++;
+                if (nb == 10)
+                {
+                    nb=0;
+                    std::cout << std::endl;
+                }
+            }
+            std::cout << std::endl;
+            std::cout << std::endl;
+        }
+        #endif
+
+    protected:
+        /* A frame must never be split by the end of the buffer */
+        static void checkSlot(int pos,int nb)
+        {
+            (void)pos;
+            (void)nb;
+            assert(nb > 0 && (length % nb) == 0);
+            assert(pos + nb <= length);
+        }
+
+        T * mBuffer;
+        int readPos,writePos;
+        int nbSamples;
+        const uint32_t mWidth,mHeight;
+};
+
 /***************
  * 
  * GENERIC NODES
@@ -831,6 +986,142 @@ private:
 };
 
 
+/*
+
+Frames with a reference count.
+
+A FramePool is managing a set of frames of the same size.
+A producer is acquiring a frame from the pool and is sending
+a SharedFrame handle in the FIFO instead of the pixels.
+
+The Duplicate node is copying the handle to each output and
+increments the reference count so the frame is never copied.
+Each consumer must release the frame when it has finished
+reading it. The frame goes back to the pool when the last 
+consumer has released it.
+
+The nodes of a schedule are never running concurrently
+so the reference count does not need to be atomic.
+
+*/
+template<typename T>
+class FramePool;
+
+template<typename T>
+class SharedFrame {
+public:
+  SharedFrame():mPool(nullptr),mId(0){};
+  SharedFrame(int):SharedFrame(){};
+
+  bool isValid() const {return(mPool != nullptr);};
+
+  /* 
+
+  Other consumers may be reading the frame so
+  only a pointer to const data is given
+
+  */
+  const T* get() const 
+  {
+    assert(mPool != nullptr);
+    return(mPool->frame(mId));
+  };
+
+  /* 
+
+  Only the owner of the unique reference (the producer)
+  can write the frame. nullptr when the frame is shared.
+
+  */
+  T* getWritable() 
+  {
+    assert(mPool != nullptr);
+    if (mPool->refCount(mId) != 1)
+    {
+       return(nullptr);
+    }
+    return(mPool->frame(mId));
+  };
+
+  void retain(int nb=1) 
+  {
+    assert(mPool != nullptr);
+    mPool->retain(mId,nb);
+  };
+
+  /* The handle is no more valid after release */
+  void release()
+  {
+    if (mPool != nullptr)
+    {
+       mPool->release(mId);
+       mPool = nullptr;
+    }
+  };
+
+private:
+  friend class FramePool<T>;
+  SharedFrame(FramePool<T> *pool,int id):mPool(pool),mId(id){};
+
+  FramePool<T> *mPool;
+  int mId;
+};
+
+template<typename T>
+class FramePool {
+public:
+  /* The buffer must contain nbFrames * frameSize elements */
+  explicit FramePool(T *buffer,int nbFrames,int frameSize):
+  mBuffer(buffer),
+  mRefCount(nbFrames,0),
+  mFrameSize(frameSize){};
+
+  FramePool(const FramePool&) = delete;
+  FramePool(FramePool&&) = delete;
+  FramePool& operator=(const FramePool&) = delete;
+  FramePool& operator=(FramePool&&) = delete;
+
+  /* The frame is not valid when all the frames are used */
+  SharedFrame<T> acquire()
+  {
+    for(unsigned int i=0;i<mRefCount.size();i++)
+    {
+       if (mRefCount[i] == 0)
+       {
+          mRefCount[i] = 1;
+          return(SharedFrame<T>(this,i));
+       }
+    }
+    return(SharedFrame<T>());
+  };
+
+  int nbFreeFrames() const
+  {
+    int nb = 0;
+    for(unsigned int i=0;i<mRefCount.size();i++)
+    {
+       if (mRefCount[i] == 0)
+       {
+          nb++;
+       }
+    }
+    return(nb);
+  };
+
+private:
+  friend class SharedFrame<T>;
+
+  T* frame(int id) const {return(mBuffer + id*mFrameSize);};
+  int refCount(int id) const {return(mRefCount[id]);};
+  void retain(int id,int nb) {mRefCount[id] += nb;};
+  void release(int id) {mRefCount[id]--;};
+
+  T *mBuffer;
+  std::vector<int> mRefCount;
+  const int mFrameSize;
+};
+
+
 template<typename IN, int inputSize,
          typename OUT, int outputSize>
 class Duplicate;
@@ -887,6 +1178,72 @@ public:
 
 };
 
+/* 
+
+Duplicate without any copy of the frames.
+Only the handles are copied and each output 
+is holding a reference to the frames.
+
+*/
+template<typename T, int ioSize>
+class Duplicate<SharedFrame<T>, ioSize,
+                SharedFrame<T>, ioSize>:
+public GenericToManyNode<SharedFrame<T>, ioSize,
+                         SharedFrame<T>, ioSize>
+{
+public:
+    explicit Duplicate(FIFOBase<SharedFrame<T>> &src,
+              std::initializer_list<FIFOBase<SharedFrame<T>>*> dst):
+    GenericToManyNode<SharedFrame<T>, ioSize,
+                      SharedFrame<T>, ioSize>(src,dst)
+    {
+    };
+
+    int prepareForRunning() final
+    {
+        if (this->willUnderflow())
+        {
+           return(CG_SKIP_EXECUTION_ID_CODE); // Skip execution
+        }
+
+        for(unsigned int i=0;i<this->getNbOutputs();i++)
+        {
+           if (this->willOverflow(i))
+           {
+              return(CG_SKIP_EXECUTION_ID_CODE); // Skip execution
+           }
+        }
+
+
+        return(CG_SUCCESS_ID_CODE);
+    };
+
+    int run() final {
+        SharedFrame<T> *a=this->getReadBuffer();
+
+        /* The input reference is given to the first output */
+        for(int k=0;k<ioSize;k++)
+        {
+           if (a[k].isValid())
+           {
+              a[k].retain(this->getNbOutputs()-1);
+           }
+        }
+        
+        for(unsigned int i=0;i<this->getNbOutputs();i++)
+        {
+           SharedFrame<T> *b=this->getWriteBuffer(i);
+           for(int k=0;k<ioSize;k++)
+           {
+              b[k] = a[k];
+           }
+        }
+        
+        return(CG_SUCCESS_ID_CODE);
+    };
+
+};
+
 template<typename IO, int inputOutputSize>
 class Duplicate<IO, inputOutputSize,
                 IO, inputOutputSize>:
@@ -14,6 +14,10 @@ extern uint32_t g_frame_available;
 
 #define CG_FREE(A) free((A));
 
+/* Each generated scheduler owns the scratch arena shared
+   by the CMSIS-CV nodes of its graph */
+#define CG_AFTER_INCLUDES static ScratchArena cv_scratch_arena;
+
 //#define CG_BEFORE_NODE_EXECUTION(A) \
 //printf("ID = %d\n",(A));
 
@@ -0,0 +1,194 @@
+/* ----------------------------------------------------------------------
+ * Project:      CMSIS CV Library
+ * Title:        test_generic_nodes.cpp
+ * Description:  Host tests of the FIFOs and nodes of GenericNodes.h
+ *
+ * Target Processor: Cortex-M
+ * -------------------------------------------------------------------- */
+/*
+ * Copyright (C) 2024 ARM Limited or its affiliates. All rights reserved.
+ *
+ * SPDX-License-Identifier: Apache-2.0
+ *
+ * Licensed under the Apache License, Version 2.0 (the License); you may
+ * not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ * www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an AS IS BASIS, WITHOUT
+ * WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdio>
+#include <cstdint>
+#include "cg_status.h"
+#include "GenericNodes.h"
+
+using namespace arm_cmsis_stream;
+
+static int nb_errors = 0;
+
+#define CHECK(COND)                                         \
+if (!(COND))                                                \
+{                                                           \
+    printf("%s:%d: %s failed\n",__FILE__,__LINE__,#COND);   \
+    nb_errors++;                                            \
+}
+
+// Frames of 2x5 pixels
+#define FRAME_W 2
+#define FRAME_H 5
+#define FRAME_SIZE (FRAME_W*FRAME_H)
+
+/* Ring of 3 frames with an initial delay of one frame. The frames
+   must be read in place in the order they were written */
+static void test_ring_fifo()
+{
+    static int8_t buf[3*FRAME_SIZE];
+    ImageRingFIFO<int8_t,3*FRAME_SIZE,0,1> fifo(buf,FRAME_SIZE,FRAME_W,FRAME_H);
+
+    CHECK(fifo.width() == FRAME_W);
+    CHECK(fifo.height() == FRAME_H);
+    CHECK(fifo.nbSamplesInFIFO() == FRAME_SIZE);
+
+    // The delay is the first slot
+    const int8_t *r = fifo.getReadBuffer(FRAME_SIZE);
+    CHECK(r == buf);
+    CHECK(fifo.willUnderflowWith(FRAME_SIZE));
+
+    for(int frame=1;frame<=7;frame++)
+    {
+        CHECK(!fifo.willOverflowWith(FRAME_SIZE));
+        int8_t *w = fifo.getWriteBuffer(FRAME_SIZE);
+        // Frames are written in the next slot, never across the end of the buffer
+        CHECK(w == buf + (frame % 3)*FRAME_SIZE);
+        for(int i=0;i<FRAME_SIZE;i++)
+        {
+            w[i] = (int8_t)frame;
+        }
+
+        // The consumer is one frame late
+        if (frame >= 2)
+        {
+            CHECK(!fifo.willUnderflowWith(FRAME_SIZE));
+            r = fifo.getReadBuffer(FRAME_SIZE);
+            CHECK(r == buf + ((frame - 1) % 3)*FRAME_SIZE);
+            CHECK(r[0] == frame - 1 && r[FRAME_SIZE-1] == frame - 1);
+        }
+    }
+
+    // Frame 7 is not read yet and there are two free slots
+    CHECK(fifo.nbSamplesInFIFO() == FRAME_SIZE);
+    CHECK(fifo.nbOfFreeSamplesInFIFO() == 2*FRAME_SIZE);
+    CHECK(fifo.getWriteBuffer(FRAME_SIZE) == buf + 2*FRAME_SIZE);
+    CHECK(fifo.getWriteBuffer(FRAME_SIZE) == buf);
+    CHECK(fifo.willOverflowWith(FRAME_SIZE));
+}
+
+/* A buffer is a ring of one frame, same behavior as the ImageFIFO buffer */
+static void test_ring_fifo_buffer()
+{
+    static int8_t buf[FRAME_SIZE];
+    ImageRingFIFO<int8_t,FRAME_SIZE,1,0> fifo(buf,0,FRAME_W,FRAME_H);
+
+    CHECK(fifo.getWriteBuffer(FRAME_SIZE) == buf);
+    CHECK(fifo.getReadBuffer(FRAME_SIZE) == buf);
+}
+
+/* Frames of a pool are given back when the last reference is released */
+static void test_frame_pool()
+{
+    static uint8_t buf[2*FRAME_SIZE];
+    FramePool<uint8_t> pool(buf,2,FRAME_SIZE);
+
+    CHECK(pool.nbFreeFrames() == 2);
+    SharedFrame<uint8_t> a = pool.acquire();
+    SharedFrame<uint8_t> b = pool.acquire();
+    SharedFrame<uint8_t> c = pool.acquire();
+    CHECK(a.isValid() && b.isValid());
+    CHECK(!c.isValid());
+    CHECK(pool.nbFreeFrames() == 0);
+    CHECK(a.get() != b.get());
+
+    // The producer is the only owner and can write the frame
+    CHECK(a.getWritable() == a.get());
+
+    // Once shared, the frame is read only
+    a.retain();
+    CHECK(a.getWritable() == nullptr);
+    a.release();
+    CHECK(!a.isValid());
+    CHECK(pool.nbFreeFrames() == 0);
+
+    b.release();
+    CHECK(pool.nbFreeFrames() == 1);
+}
+
+/* Duplicate of a frame handle to two consumers. The frame
+   is not copied and goes back to the pool when both
+   consumers have released it */
+static void test_duplicate_shared_frame()
+{
+    static uint8_t buf[2*FRAME_SIZE];
+    static SharedFrame<uint8_t> in_buf[2];
+    static SharedFrame<uint8_t> out1_buf[2];
+    static SharedFrame<uint8_t> out2_buf[2];
+
+    FramePool<uint8_t> pool(buf,2,FRAME_SIZE);
+    ImageRingFIFO<SharedFrame<uint8_t>,2,0,1> in(in_buf,0,FRAME_W,FRAME_H);
+    ImageRingFIFO<SharedFrame<uint8_t>,2,0,1> out1(out1_buf,0,FRAME_W,FRAME_H);
+    ImageRingFIFO<SharedFrame<uint8_t>,2,0,1> out2(out2_buf,0,FRAME_W,FRAME_H);
+    Duplicate<SharedFrame<uint8_t>,1,SharedFrame<uint8_t>,1> dup(in,{&out1,&out2});
+
+    // Nothing to duplicate
+    CHECK(dup.prepareForRunning() == CG_SKIP_EXECUTION_ID_CODE);
+
+    // Producer
+    SharedFrame<uint8_t> frame = pool.acquire();
+    uint8_t *pixels = frame.getWritable();
+    CHECK(pixels != nullptr);
+    for(int i=0;i<FRAME_SIZE;i++)
+    {
+        pixels[i] = (uint8_t)i;
+    }
+    *in.getWriteBuffer(1) = frame;
+    CHECK(pool.nbFreeFrames() == 1);
+
+    CHECK(dup.prepareForRunning() == CG_SUCCESS_ID_CODE);
+    CHECK(dup.run() == CG_SUCCESS_ID_CODE);
+    CHECK(in.nbSamplesInFIFO() == 0);
+
+    // Both consumers are reading the pixels of the producer
+    SharedFrame<uint8_t> *r1 = out1.getReadBuffer(1);
+    SharedFrame<uint8_t> *r2 = out2.getReadBuffer(1);
+    CHECK(r1->get() == pixels);
+    CHECK(r2->get() == pixels);
+    CHECK(r1->getWritable() == nullptr);
+    CHECK(r2->get()[FRAME_SIZE-1] == FRAME_SIZE-1);
+
+    r1->release();
+    CHECK(pool.nbFreeFrames() == 1);
+
+    // The last consumer can write the frame
+    CHECK(r2->getWritable() == pixels);
+    r2->release();
+    CHECK(pool.nbFreeFrames() == 2);
+}
+
+int main()
+{
+    test_ring_fifo();
+    test_ring_fifo_buffer();
+    test_frame_pool();
+    test_duplicate_shared_frame();
+
+    if (nb_errors == 0)
+    {
+        printf("All tests passed\n");
+    }
+    return(nb_errors != 0);
+}
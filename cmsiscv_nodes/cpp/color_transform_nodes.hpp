@@ -454,17 +454,10 @@ public:
         uint8_t *g=(uint8_t*)this->getReadBuffer();
         uint8_t *rgb=(uint8_t*)this->getWriteBuffer();
 
-        IMGIN input;
-        IMGOUT output;
-
-        input.width = this->inputWidth();
-        input.height = this->inputHeight();
-        input.pData = (typename _CVImageChannel<IMGIN>::type)g;
-
-        output.width = this->inputWidth();
-        output.height = this->inputHeight();
-        output.pData = (typename _CVImageChannel<IMGOUT>::type)rgb;
-
+        IMGIN input = ARM_CV_IMAGE_INIT(this->inputWidth(), this->inputHeight(),
+                                        (typename _CVImageChannel<IMGIN>::type)g);
+        IMGOUT output = ARM_CV_IMAGE_INIT(this->inputWidth(), this->inputHeight(),
+                                          (typename _CVImageChannel<IMGOUT>::type)rgb);
 
         _CVColorConvertFunc<IMGIN,IMGOUT>::convert(&input,&output);
         
@@ -2,6 +2,7 @@
 
 
 #include "cv/feature_detection.h"
+#include "scratch_arena.hpp"
 
 template<typename IN, int inputSize,
          typename OUT,int outputSize>
@@ -14,27 +15,19 @@ class CannyEdge<int8_t,inputSize,
                          int8_t,outputSize>
 {
 public:
-    /* Constructor needs the input and output FIFOs */
+    /* Constructor needs the input and output FIFOs,
+       the parameters and the scratch arena of the graph */
     CannyEdge(FIFOBase<int8_t> &src,
                 FIFOBase<int8_t> &dst,
-                uint32_t *params):
+                uint32_t *params,
+                ScratchArena &arena):
     GenericNode<int8_t,inputSize,int8_t,outputSize>(src,dst),
-    mParams(params){
-            
-            cannyBuffer = (q15_t*)CG_MALLOC(arm_cv_get_scratch_size_canny_sobel(src.width()));
-
-            mInitErrorOccured = false;
-            if (cannyBuffer == nullptr)
-            {
-                mInitErrorOccured = true;
-            }
+    mParams(params),
+    mArena(arena){
+            arm_cv_scratch_kernel_t kernel = {ARM_CV_SCRATCH_CANNY_SOBEL,0,(uint16_t)src.width(),nullptr};
+            mArena.reserve(kernel);
     };
 
-    ~CannyEdge()
-    {
-       CG_FREE(cannyBuffer);
-    }
-
     /* In asynchronous mode, node execution will be 
        skipped in case of underflow on the input 
        or overflow in the output.
@@ -58,21 +51,14 @@ public:
         int8_t *i=this->getReadBuffer();
         int8_t *o=this->getWriteBuffer();
 
-        if (mInitErrorOccured)
+        q15_t *cannyBuffer = (q15_t*)mArena.get();
+        if (cannyBuffer == nullptr)
         {
             return(CG_MEMORY_ALLOCATION_FAILURE);
         }
 
-        arm_cv_image_gray8_t input;
-        arm_cv_image_gray8_t output;
-
-        input.height=this->inputHeight();
-        input.width=this->inputWidth();
-        input.pData = (uint8_t*)i;
-
-        output.height=this->inputHeight();
-        output.width=this->inputWidth();
-        output.pData = (uint8_t*)o;
+        arm_cv_image_gray8_t input = ARM_CV_IMAGE_INIT(this->inputWidth(), this->inputHeight(), (uint8_t*)i);
+        arm_cv_image_gray8_t output = ARM_CV_IMAGE_INIT(this->inputWidth(), this->inputHeight(), (uint8_t*)o);
 
         uint32_t low,high;
         if (mParams == nullptr)
@@ -95,8 +81,7 @@ public:
         return(0);
     };
 protected:
-    q15_t* cannyBuffer;
-    bool mInitErrorOccured;
     uint32_t *mParams;
+    ScratchArena &mArena;
 };
 
@@ -47,16 +47,8 @@ public:
         uint8_t *gin=(uint8_t*)this->getReadBuffer();
         uint8_t *gout=(uint8_t*)this->getWriteBuffer();
 
-        arm_cv_image_gray8_t input;
-        arm_cv_image_gray8_t output;
-
-        input.width = this->inputWidth();
-        input.height = this->inputHeight();
-        input.pData = gin;
-
-        output.width = this->outputWidth();
-        output.height = this->outputHeight();
-        output.pData = gout;
+        arm_cv_image_gray8_t input = ARM_CV_IMAGE_INIT(this->inputWidth(), this->inputHeight(), gin);
+        arm_cv_image_gray8_t output = ARM_CV_IMAGE_INIT(this->outputWidth(), this->outputHeight(), gout);
 
         arm_crop_gray8(&input,&output,mLeft,mTop,mRight,mBottom);     
       
@@ -115,16 +107,8 @@ public:
         uint8_t *gin=(uint8_t*)this->getReadBuffer();
         uint8_t *gout=(uint8_t*)this->getWriteBuffer();
 
-        arm_cv_image_rgb24_t input;
-        arm_cv_image_rgb24_t output;
-
-        input.width = this->inputWidth();
-        input.height = this->inputHeight();
-        input.pData = gin;
-
-        output.width = this->outputWidth();
-        output.height = this->outputHeight();
-        output.pData = gout;
+        arm_cv_image_rgb24_t input = ARM_CV_IMAGE_INIT(this->inputWidth(), this->inputHeight(), gin);
+        arm_cv_image_rgb24_t output = ARM_CV_IMAGE_INIT(this->outputWidth(), this->outputHeight(), gout);
 
         arm_crop_rgb24(&input,&output,mLeft,mTop,mRight,mBottom);     
       
@@ -1,6 +1,7 @@
 #pragma once
 
 #include "cv/linear_filters.h"
+#include "scratch_arena.hpp"
 
 
 template<typename IN, int inputSize,
@@ -14,10 +15,16 @@ class GaussianFilter<int8_t,inputSize,
                          int8_t,outputSize>
 {
 public:
-    /* Constructor needs the input and output FIFOs */
+    /* Constructor needs the input and output FIFOs
+       and the scratch arena of the graph */
     GaussianFilter(FIFOBase<int8_t> &src,
-                FIFOBase<int8_t> &dst):
-    GenericNode<int8_t,inputSize,int8_t,outputSize>(src,dst){};
+                FIFOBase<int8_t> &dst,
+                ScratchArena &arena):
+    GenericNode<int8_t,inputSize,int8_t,outputSize>(src,dst),
+    mArena(arena){
+            arm_cv_scratch_kernel_t kernel = {ARM_CV_SCRATCH_LINEAR_BUFFER_15,0,(uint16_t)src.width(),nullptr};
+            mArena.reserve(kernel);
+    };
 
     /* In asynchronous mode, node execution will be 
        skipped in case of underflow on the input 
@@ -42,25 +49,22 @@ public:
         int8_t *i=this->getReadBuffer();
         int8_t *o=this->getWriteBuffer();
 
-        arm_cv_image_gray8_t src;
-        arm_cv_image_gray8_t dst;
-
-        src.height=this->inputHeight();
-        src.width=this->inputWidth();
-        src.pData = (uint8_t*)i;
+        arm_cv_image_gray8_t src = ARM_CV_IMAGE_INIT(this->inputWidth(), this->inputHeight(), (uint8_t*)i);
+        arm_cv_image_gray8_t dst = ARM_CV_IMAGE_INIT(this->inputWidth(), this->inputHeight(), (uint8_t*)o);
 
-        dst.height=this->inputHeight();
-        dst.width=this->inputWidth();
-        dst.pData = (uint8_t*)o;
-        
-        q15_t *buff = (q15_t *)malloc(arm_get_linear_scratch_size_buffer_15(src.width));
+        q15_t *buff = (q15_t *)mArena.get();
+        if (buff == nullptr)
+        {
+            return(CG_MEMORY_ALLOCATION_FAILURE);
+        }
 
         int bordertype = ARM_CV_BORDER_NEAREST;
 
         arm_gaussian_filter_3x3_fixp(&src,&dst, buff, bordertype);
 
-        free(buff);
         return(0);
     };
-   
+
+protected:
+    ScratchArena &mArena;
 };
\ No newline at end of file
@@ -0,0 +1,76 @@
+#pragma once
+
+#include <vector>
+#include "cv/scratch_planner.h"
+
+/*
+
+Scratch memory shared by the CMSIS-CV nodes of a graph.
+
+The nodes of a schedule are executed one after the other and never
+concurrently. So all the nodes of a graph can use the same scratch region.
+
+The arena is owned by the graph: it is declared in the generated
+scheduler (with the CG_AFTER_INCLUDES hook in the browser tests)
+and passed to the constructor of each node using a scratch.
+
+Each node reserves its kernel in its constructor. The region is
+allocated once, when a node gets it for the first time in run(),
+with the size computed by the scratch planner of the library for
+all the kernels of the graph. It is released by the destructor of
+the arena.
+
+*/
+class ScratchArena
+{
+public:
+    ScratchArena():mBuffer(nullptr),mAllocatedSize(0){};
+
+    ~ScratchArena()
+    {
+        if (mBuffer != nullptr)
+        {
+           CG_FREE(mBuffer);
+        }
+    };
+
+    /* The arena is owned by the graph and not made to be copied or moved */
+    ScratchArena(const ScratchArena&) = delete;
+    ScratchArena(ScratchArena&&) = delete;
+    ScratchArena& operator=(const ScratchArena&) = delete;
+    ScratchArena& operator=(ScratchArena&&) = delete;
+
+    void reserve(const arm_cv_scratch_kernel_t &kernel)
+    {
+        mKernels.push_back(kernel);
+    };
+
+    /* Scratch size in bytes required by the kernels of the graph */
+    uint32_t size() const
+    {
+        return(arm_cv_get_scratch_size_pipeline(mKernels.data(),
+                                                (uint32_t)mKernels.size()));
+    };
+
+    /* Return nullptr if the allocation failed */
+    void* get()
+    {
+        uint32_t required = size();
+        /* A node may have been created after the allocation */
+        if (mAllocatedSize < required)
+        {
+           if (mBuffer != nullptr)
+           {
+              CG_FREE(mBuffer);
+           }
+           mBuffer = CG_MALLOC(required);
+           mAllocatedSize = (mBuffer == nullptr) ? 0 : required;
+        }
+        return(mBuffer);
+    };
+
+protected:
+    void* mBuffer;
+    uint32_t mAllocatedSize;
+    std::vector<arm_cv_scratch_kernel_t> mKernels;
+};
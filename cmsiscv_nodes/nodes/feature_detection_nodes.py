@@ -22,7 +22,8 @@ class CannyEdge(GenericNode):
             else:
                self._paramBlock = 2
                self.addVariableArg("params2")
-        
+        self.addVariableArg("cv_scratch_arena")
+
     @property
     def typeName(self):
         """The name of the C++ class implementing this node"""
@@ -13,6 +13,7 @@ class GaussianFilter(GenericNode):
 
         self.addInput("i",src_t,src_t.nb_bytes)
         self.addOutput("o",dst_t,dst_t.nb_bytes)
+        self.addVariableArg("cv_scratch_arena")
 
     def __call__(self, i):
         g,n = i 
@@ -13,6 +13,14 @@ class ImageFIFO(StreamFIFO):
         return [f"{self._ctype.width}",
                 f"{self._ctype.height}"]
 
+# Ring of frames : the frames are never moved inside the FIFO.
+# It can be used as the defaultFIFOClass of a graph or
+# for a specific connection with the fifoClass argument
+class ImageRingFIFO(ImageFIFO):
+    @property
+    def cname(self):
+        return "ImageRingFIFO"
+
 #tfType = CStructType("TfLiteTensor",10)
 #posType = CStructType("struct_position",8)
 